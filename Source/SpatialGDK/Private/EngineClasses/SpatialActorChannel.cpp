@@ -14,6 +14,11 @@
 #include "Settings/LevelEditorPlaySettings.h"
 #endif
 
+#if WITH_PUSH_MODEL
+#include "Net/Core/PushModel/PushModel.h"
+#include "Net/Core/PushModel/Types/PushModelPerNetDriverState.h"
+#endif
+
 #include "EngineClasses/SpatialNetConnection.h"
 #include "EngineClasses/SpatialNetDriver.h"
 #include "EngineClasses/SpatialPackageMapClient.h"
@@ -32,6 +37,7 @@
 #include "Utils/EntityFactory.h"
 #include "Utils/GDKPropertyMacros.h"
 #include "Utils/InterestFactory.h"
+#include "Utils/RepFieldDispatchTable.h"
 #include "Utils/RepLayoutUtils.h"
 #include "Utils/SchemaOption.h"
 #include "Utils/SpatialActorUtils.h"
@@ -78,7 +84,8 @@ void UpdateChangelistHistory(TUniquePtr<FRepState>& RepState)
 
 		ensureAlwaysMsgf(HistoryItem.Changed.Num() > 0, TEXT("All active history items should contain a change list"));
 
-		HistoryItem.Changed.Empty();
+		// Keep the allocation, the slot is merged into again once the history wraps around.
+		HistoryItem.Changed.Reset();
 		HistoryItem.OutPacketIdRange = FPacketIdRange();
 		SendingRepState->HistoryStart++;
 	}
@@ -614,20 +621,23 @@ int64 USpatialActorChannel::ReplicateActor()
 	// Update the replicated property change list.
 	FRepChangelistState* ChangelistState = ActorReplicator->ChangelistMgr->GetRepChangelistState();
 
-
-	const ERepLayoutResult UpdateResult =
-		ActorReplicator->RepLayout->UpdateChangelistMgr(ActorReplicator->RepState->GetSendingRepState(), *ActorReplicator->ChangelistMgr,
-														Actor, Connection->Driver->ReplicationFrame, RepFlags, bForceCompareProperties);
-
-	if (UNLIKELY(ERepLayoutResult::FatalError == UpdateResult))
+	// An actor whose properties all use push model and are clean can't have changed, so comparing it would find nothing.
+	if (bCreatingNewEntity || !CanSkipPropertyComparison(*ActorReplicator, Actor))
 	{
-		// This happens when a replicated array is over the maximum size (UINT16_MAX).
-		// Native Unreal just closes the connection at this point, but we can't do that as
-		// it may lead to unexpected consequences for the deployment. Instead, we just early out.
-		// TODO: UNR-4667 - Investigate this behavior in more detail.
+		const ERepLayoutResult UpdateResult = ActorReplicator->RepLayout->UpdateChangelistMgr(
+			ActorReplicator->RepState->GetSendingRepState(), *ActorReplicator->ChangelistMgr, Actor, Connection->Driver->ReplicationFrame,
+			RepFlags, bForceCompareProperties);
 
-		// Connection->SetPendingCloseDueToReplicationFailure();
-		return 0;
+		if (UNLIKELY(ERepLayoutResult::FatalError == UpdateResult))
+		{
+			// This happens when a replicated array is over the maximum size (UINT16_MAX).
+			// Native Unreal just closes the connection at this point, but we can't do that as
+			// it may lead to unexpected consequences for the deployment. Instead, we just early out.
+			// TODO: UNR-4667 - Investigate this behavior in more detail.
+
+			// Connection->SetPendingCloseDueToReplicationFailure();
+			return 0;
+		}
 	}
 
 	FSendingRepState* SendingRepState = ActorReplicator->RepState->GetSendingRepState();
@@ -637,22 +647,7 @@ int64 USpatialActorChannel::ReplicateActor()
 	TArray<uint16>& RepChanged = PossibleNewHistoryItem.Changed;
 
 	// Gather all change lists that are new since we last looked, and merge them all together into a single CL
-	for (int32 i = SendingRepState->LastChangelistIndex; i < ChangelistState->HistoryEnd; i++)
-	{
-		const int32 HistoryIndex = i % FRepChangelistState::MAX_CHANGE_HISTORY;
-		FRepChangedHistory& HistoryItem = ChangelistState->ChangeHistory[HistoryIndex];
-		TArray<uint16> Temp = RepChanged;
-
-		if (HistoryItem.Changed.Num() > 0)
-		{
-			ActorReplicator->RepLayout->MergeChangeList((uint8*)Actor, HistoryItem.Changed, Temp, RepChanged);
-		}
-		else
-		{
-			UE_LOG(LogSpatialActorChannel, Warning, TEXT("EntityId: %lld Actor: %s Changelist with index %d has no changed items"),
-				   EntityId, *Actor->GetName(), i);
-		}
-	}
+	MergeChangelistHistory(*ActorReplicator, Actor, RepChanged);
 
 	SendingRepState->LastCompareIndex = ChangelistState->CompareIndex;
 
@@ -809,6 +804,86 @@ void USpatialActorChannel::DynamicallyAttachSubobject(UObject* Object)
 	NetDriver->ActorSystem->SendAddComponentForSubobject(this, Object, *Info, ReplicationBytesWritten);
 }
 
+void USpatialActorChannel::MergeChangelistHistory(FObjectReplicator& Replicator, UObject* Object, TArray<uint16>& OutRepChanged)
+{
+	const FRepChangelistState* ChangelistState = Replicator.ChangelistMgr->GetRepChangelistState();
+	const FSendingRepState* SendingRepState = Replicator.RepState->GetSendingRepState();
+	const FRepLayout& RepLayout = *Replicator.RepLayout;
+
+	TArray<const TArray<uint16>*, TInlineAllocator<FRepChangelistState::MAX_CHANGE_HISTORY>> Changelists;
+	for (int32 i = SendingRepState->LastChangelistIndex; i < ChangelistState->HistoryEnd; i++)
+	{
+		const int32 HistoryIndex = i % FRepChangelistState::MAX_CHANGE_HISTORY;
+		const FRepChangedHistory& HistoryItem = ChangelistState->ChangeHistory[HistoryIndex];
+
+		if (HistoryItem.Changed.Num() > 0)
+		{
+			Changelists.Add(&HistoryItem.Changed);
+		}
+		else
+		{
+			UE_LOG(LogSpatialActorChannel, Warning, TEXT("EntityId: %lld Actor: %s Object: %s Changelist with index %d has no changed items"),
+				   EntityId, *GetNameSafe(Actor), *Object->GetName(), i);
+		}
+	}
+
+	if (Changelists.Num() == 0)
+	{
+		return;
+	}
+
+	const auto IsDynamicArrayHandle = [&RepLayout](uint16 Handle) {
+		return RepLayout.Cmds[RepLayout.BaseHandleToCmdIndex[Handle - 1].CmdIndex].Type == ERepLayoutCmdType::DynamicArray;
+	};
+
+	if (ChangelistMerger.TryMergeFlat(RepLayout.BaseHandleToCmdIndex.Num(), Changelists, IsDynamicArrayHandle, OutRepChanged))
+	{
+		return;
+	}
+
+	// Changes to dynamic arrays are merged per element, against the current size of the arrays.
+	TArray<uint16>& PreviousRepChanged = ChangelistMerger.GetScratchChangelist();
+	for (const TArray<uint16>* Changelist : Changelists)
+	{
+		PreviousRepChanged = OutRepChanged;
+		RepLayout.MergeChangeList((uint8*)Object, *Changelist, PreviousRepChanged, OutRepChanged);
+	}
+}
+
+bool USpatialActorChannel::CanSkipPropertyComparison(const FObjectReplicator& Replicator, UObject* Object) const
+{
+#if WITH_PUSH_MODEL
+	if (!IS_PUSH_MODEL_ENABLED() || bForceCompareProperties)
+	{
+		return false;
+	}
+
+	const FRepChangelistState* ChangelistState = Replicator.ChangelistMgr->GetRepChangelistState();
+	if (!ChangelistState->PushModelObjectHandle.IsValid())
+	{
+		return false;
+	}
+
+	const UEPushModelPrivate::FPushModelPerNetDriverState* PushModelState =
+		UEPushModelPrivate::GetPerNetDriverState(ChangelistState->PushModelObjectHandle);
+	if (PushModelState == nullptr)
+	{
+		return false;
+	}
+
+	const FClassInfo& Info = NetDriver->ClassInfoManager->GetOrCreateClassInfoByObject(Object);
+	return CanSkipPropertyComparison(Info.FieldDispatchTable.Get(), PushModelState->HasDirtyProperties());
+#else
+	return false;
+#endif // WITH_PUSH_MODEL
+}
+
+bool USpatialActorChannel::CanSkipPropertyComparison(const SpatialGDK::FRepFieldDispatchTable* FieldDispatchTable, bool bHasDirtyProperties)
+{
+	// Properties without push model can change without marking anything dirty, those classes are always compared.
+	return FieldDispatchTable != nullptr && FieldDispatchTable->AreAllPropertiesPushBased() && !bHasDirtyProperties;
+}
+
 bool USpatialActorChannel::ReplicateSubobject(UObject* Object, const FReplicationFlags& RepFlags)
 {
 	SCOPE_CYCLE_COUNTER(STAT_SpatialActorChannelReplicateSubobject);
@@ -848,20 +923,22 @@ bool USpatialActorChannel::ReplicateSubobject(UObject* Object, const FReplicatio
 
 	FRepChangelistState* ChangelistState = Replicator.ChangelistMgr->GetRepChangelistState();
 
-
-	const ERepLayoutResult UpdateResult =
-		Replicator.RepLayout->UpdateChangelistMgr(Replicator.RepState->GetSendingRepState(), *Replicator.ChangelistMgr, Object,
-												  Replicator.Connection->Driver->ReplicationFrame, RepFlags, bForceCompareProperties);
-
-	if (UNLIKELY(ERepLayoutResult::FatalError == UpdateResult))
+	if (!CanSkipPropertyComparison(Replicator, Object))
 	{
-		// This happens when a replicated array is over the maximum size (UINT16_MAX).
-		// Native Unreal just closes the connection at this point, but we can't do that as
-		// it may lead to unexpected consequences for the deployment. Instead, we just early out.
-		// TODO: UNR-4667 - Investigate this behavior in more detail.
+		const ERepLayoutResult UpdateResult =
+			Replicator.RepLayout->UpdateChangelistMgr(Replicator.RepState->GetSendingRepState(), *Replicator.ChangelistMgr, Object,
+													  Replicator.Connection->Driver->ReplicationFrame, RepFlags, bForceCompareProperties);
 
-		// Connection->SetPendingCloseDueToReplicationFailure();
-		return false;
+		if (UNLIKELY(ERepLayoutResult::FatalError == UpdateResult))
+		{
+			// This happens when a replicated array is over the maximum size (UINT16_MAX).
+			// Native Unreal just closes the connection at this point, but we can't do that as
+			// it may lead to unexpected consequences for the deployment. Instead, we just early out.
+			// TODO: UNR-4667 - Investigate this behavior in more detail.
+
+			// Connection->SetPendingCloseDueToReplicationFailure();
+			return false;
+		}
 	}
 
 
@@ -872,23 +949,7 @@ bool USpatialActorChannel::ReplicateSubobject(UObject* Object, const FReplicatio
 	TArray<uint16>& RepChanged = PossibleNewHistoryItem.Changed;
 
 	// Gather all change lists that are new since we last looked, and merge them all together into a single CL
-	for (int32 i = SendingRepState->LastChangelistIndex; i < ChangelistState->HistoryEnd; i++)
-	{
-		const int32 HistoryIndex = i % FRepChangelistState::MAX_CHANGE_HISTORY;
-		FRepChangedHistory& HistoryItem = ChangelistState->ChangeHistory[HistoryIndex];
-		TArray<uint16> Temp = RepChanged;
-
-		if (HistoryItem.Changed.Num() > 0)
-		{
-			Replicator.RepLayout->MergeChangeList((uint8*)Object, HistoryItem.Changed, Temp, RepChanged);
-		}
-		else
-		{
-			UE_LOG(LogSpatialActorChannel, Warning,
-				   TEXT("EntityId: %lld Actor: %s Subobject: %s Changelist with index %d has no changed items"), EntityId,
-				   *Actor->GetName(), *Object->GetName(), i);
-		}
-	}
+	MergeChangelistHistory(Replicator, Object, RepChanged);
 
 	SendingRepState->LastCompareIndex = ChangelistState->CompareIndex;
 
@@ -1246,6 +1307,16 @@ void USpatialActorChannel::OnSubobjectDeleted(const FUnrealObjectRef& ObjectRef,
 		NetDriver->ActorSystem->CleanupRepStateMap(*SubObjectRefMap);
 		ObjectReferenceMap.Remove(ObjectWeakPtr);
 	}
+	SentDeltaArrayLengths.Remove(ObjectWeakPtr);
+}
+
+bool USpatialActorChannel::RecordSentDeltaArrayLength(UObject* Object, Schema_FieldId FieldId, int32 Length)
+{
+	TMap<Schema_FieldId, int32>& ObjectLengths = SentDeltaArrayLengths.FindOrAdd(Object);
+	const int32* PreviousLength = ObjectLengths.Find(FieldId);
+	const bool bCanSendDelta = PreviousLength != nullptr && Length >= *PreviousLength;
+	ObjectLengths.Add(FieldId, Length);
+	return bCanSendDelta;
 }
 
 void USpatialActorChannel::ResetShadowData(FRepLayout& RepLayout, FRepStateStaticBuffer& StaticBuffer, UObject* TargetObject)
@@ -17,6 +17,11 @@ FSpatialNetBitWriter::FSpatialNetBitWriter(USpatialPackageMapClient* InPackageMa
 {
 }
 
+FSpatialNetBitWriter::FSpatialNetBitWriter(USpatialPackageMapClient* InPackageMap, int64 InMaxBits)
+	: FNetBitWriter(InPackageMap, InMaxBits)
+{
+}
+
 void FSpatialNetBitWriter::SerializeObjectRef(FArchive& Archive, FUnrealObjectRef& ObjectRef)
 {
 	int64 EntityId = ObjectRef.Entity;
@@ -60,3 +65,121 @@ FArchive& FSpatialNetBitWriter::operator<<(FWeakObjectPtr& Value)
 
 	return *this;
 }
+
+namespace
+{
+// Buffer sizes in bytes. Writers that grew past the largest size class are freed instead of pooled.
+constexpr int64 WriterSizeClasses[] = { 64, 256, 1024, 4096 };
+constexpr int32 NumWriterSizeClasses = UE_ARRAY_COUNT(WriterSizeClasses);
+constexpr int32 MaxPooledWritersPerSizeClass = 16;
+
+int32 GetSizeClassForHint(int64 SizeHintBytes)
+{
+	for (int32 SizeClass = 0; SizeClass < NumWriterSizeClasses; ++SizeClass)
+	{
+		if (SizeHintBytes <= WriterSizeClasses[SizeClass])
+		{
+			return SizeClass;
+		}
+	}
+	return NumWriterSizeClasses - 1;
+}
+
+// The largest size class the writer's current buffer can fully back, or INDEX_NONE if it doesn't fit any.
+int32 GetSizeClassForCapacity(int64 CapacityBytes)
+{
+	for (int32 SizeClass = NumWriterSizeClasses - 1; SizeClass >= 0; --SizeClass)
+	{
+		if (CapacityBytes >= WriterSizeClasses[SizeClass])
+		{
+			return CapacityBytes <= WriterSizeClasses[NumWriterSizeClasses - 1] ? SizeClass : INDEX_NONE;
+		}
+	}
+	return INDEX_NONE;
+}
+
+struct FWriterPool
+{
+	TArray<TUniquePtr<FSpatialNetBitWriter>> Buckets[NumWriterSizeClasses];
+	FSpatialNetBitWriterPool::FStats Stats;
+};
+
+FWriterPool& GetThreadWriterPool()
+{
+	static thread_local FWriterPool Pool;
+	return Pool;
+}
+} // namespace
+
+FSpatialNetBitWriterPool::FScopedWriter::FScopedWriter(TUniquePtr<FSpatialNetBitWriter>&& InWriter)
+	: Writer(MoveTemp(InWriter))
+{
+}
+
+FSpatialNetBitWriterPool::FScopedWriter::FScopedWriter(FScopedWriter&& Other)
+	: Writer(MoveTemp(Other.Writer))
+{
+}
+
+FSpatialNetBitWriterPool::FScopedWriter::~FScopedWriter()
+{
+	if (Writer.IsValid())
+	{
+		FSpatialNetBitWriterPool::Release(MoveTemp(Writer));
+	}
+}
+
+FSpatialNetBitWriterPool::FScopedWriter FSpatialNetBitWriterPool::Acquire(USpatialPackageMapClient* PackageMap, int64 SizeHintBytes)
+{
+	FWriterPool& Pool = GetThreadWriterPool();
+	FStats& Stats = Pool.Stats;
+
+	Stats.NumAcquired++;
+	Stats.NumInUse++;
+	Stats.HighWaterInUse = FMath::Max(Stats.HighWaterInUse, Stats.NumInUse);
+
+	const int32 RequestedSizeClass = GetSizeClassForHint(SizeHintBytes);
+	for (int32 SizeClass = RequestedSizeClass; SizeClass < NumWriterSizeClasses; ++SizeClass)
+	{
+		TArray<TUniquePtr<FSpatialNetBitWriter>>& Bucket = Pool.Buckets[SizeClass];
+		if (Bucket.Num() > 0)
+		{
+			TUniquePtr<FSpatialNetBitWriter> Writer = Bucket.Pop(/* bAllowShrinking */ false);
+			Writer->PackageMap = PackageMap;
+			Stats.NumReused++;
+			Stats.NumPooled--;
+			return FScopedWriter(MoveTemp(Writer));
+		}
+	}
+
+	const int64 SizeBytes = WriterSizeClasses[RequestedSizeClass];
+	return FScopedWriter(MakeUnique<FSpatialNetBitWriter>(PackageMap, SizeBytes * 8));
+}
+
+void FSpatialNetBitWriterPool::Release(TUniquePtr<FSpatialNetBitWriter>&& Writer)
+{
+	FWriterPool& Pool = GetThreadWriterPool();
+	FStats& Stats = Pool.Stats;
+
+	Stats.NumInUse--;
+
+	const int64 CapacityBytes = Writer->GetMaxBits() / 8;
+	Stats.HighWaterBytes = FMath::Max(Stats.HighWaterBytes, CapacityBytes);
+
+	const int32 SizeClass = GetSizeClassForCapacity(CapacityBytes);
+	if (SizeClass == INDEX_NONE || Pool.Buckets[SizeClass].Num() >= MaxPooledWritersPerSizeClass)
+	{
+		Stats.NumDiscarded++;
+		return;
+	}
+
+	Writer->Reset();
+	Writer->PackageMap = nullptr;
+	Pool.Buckets[SizeClass].Push(MoveTemp(Writer));
+	Stats.NumPooled++;
+}
+
+FSpatialNetBitWriterPool::FStats FSpatialNetBitWriterPool::GetStats()
+{
+	return GetThreadWriterPool().Stats;
+}
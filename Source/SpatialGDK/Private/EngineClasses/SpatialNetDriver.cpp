@@ -70,6 +70,7 @@
 #include "Utils/ErrorCodeRemapping.h"
 #include "Utils/GDKPropertyMacros.h"
 #include "Utils/InterestFactory.h"
+#include "Utils/PartialSort.h"
 #include "Utils/SpatialDebugger.h"
 #include "Utils/SpatialDebuggerSystem.h"
 #include "Utils/SpatialLatencyTracer.h"
@@ -91,6 +92,7 @@ using SpatialGDK::RPCPayload;
 DEFINE_LOG_CATEGORY(LogSpatialOSNetDriver);
 
 DECLARE_CYCLE_STAT(TEXT("ServerReplicateActors"), STAT_SpatialServerReplicateActors, STATGROUP_SpatialNet);
+DECLARE_CYCLE_STAT(TEXT("BuildConsiderList"), STAT_SpatialBuildConsiderList, STATGROUP_SpatialNet);
 DECLARE_CYCLE_STAT(TEXT("ProcessPrioritizedActors"), STAT_SpatialProcessPrioritizedActors, STATGROUP_SpatialNet);
 DECLARE_CYCLE_STAT(TEXT("PrioritizeActors"), STAT_SpatialPrioritizeActors, STATGROUP_SpatialNet);
 DECLARE_CYCLE_STAT(TEXT("ProcessOps"), STAT_SpatialProcessOps, STATGROUP_SpatialNet);
@@ -716,11 +718,11 @@ void USpatialNetDriver::ClientOnGSMQuerySuccess()
 	if (bWaitingToSpawn && ClientCanSendPlayerSpawnRequests())
 	{
 		uint32 ServerHash = GlobalStateManager->GetSchemaHash();
-		if (ClassInfoManager->SchemaDatabase->SchemaBundleHash != ServerHash) // Are we running with the same schema hash as the server?
+		if (ClassInfoManager->GetSchemaHash() != ServerHash) // Are we running with the same schema hash as the server?
 		{
 			UE_LOG(LogSpatialOSNetDriver, Error,
 				   TEXT("Your client's schema does not match your deployment's schema. Client hash: '%u' Server hash: '%u'"),
-				   ClassInfoManager->SchemaDatabase->SchemaBundleHash, ServerHash);
+				   ClassInfoManager->GetSchemaHash(), ServerHash);
 
 			PendingNetworkFailure = {
 				ENetworkFailure::OutdatedClient,
@@ -1140,6 +1142,7 @@ void USpatialNetDriver::NotifyActorDestroyed(AActor* ThisActor, bool IsSeamlessT
 
 	// Remove this actor from the network object list
 	GetNetworkObjectList().Remove(ThisActor);
+	ReplicationSchedule.Remove(ThisActor);
 
 	// Remove from renamed list if destroyed
 	RenamedStartupActors.Remove(ThisActor->GetFName());
@@ -1151,6 +1154,8 @@ void USpatialNetDriver::Shutdown()
 
 	SpatialOutputDevice = nullptr;
 
+	ResetReplicationSchedule();
+
 	Super::Shutdown();
 
 	// This is done after Super::Shutdown so the NetDriver is given an opportunity to shutdown all open channels, and those
@@ -1224,6 +1229,37 @@ void USpatialNetDriver::Shutdown()
 	}
 }
 
+void USpatialNetDriver::SetWorld(UWorld* InWorld)
+{
+	Super::SetWorld(InWorld);
+
+	// The old world's network actors leave the list without going through RemoveNetworkActor.
+	ResetReplicationSchedule();
+}
+
+void USpatialNetDriver::AddNetworkActor(AActor* Actor)
+{
+	Super::AddNetworkActor(Actor);
+
+	if (IsServer() && World != nullptr && GetNetworkObjectList().GetActiveObjects().Contains(Actor))
+	{
+		ReplicationSchedule.Schedule(Actor, World->TimeSeconds);
+	}
+}
+
+void USpatialNetDriver::RemoveNetworkActor(AActor* Actor)
+{
+	Super::RemoveNetworkActor(Actor);
+
+	ReplicationSchedule.Remove(Actor);
+}
+
+void USpatialNetDriver::ResetReplicationSchedule()
+{
+	ReplicationSchedule.Empty();
+	NextReplicationScheduleReconcileTime = 0.0f;
+}
+
 void USpatialNetDriver::NotifyActorFullyDormantForConnection(AActor* Actor, UNetConnection* NetConnection)
 {
 	// Similar to NetDriver::NotifyActorFullyDormantForConnection, however we only care about a single connection
@@ -1236,6 +1272,24 @@ void USpatialNetDriver::NotifyActorFullyDormantForConnection(AActor* Actor, UNet
 	}
 
 	// Intentionally don't call Super::NotifyActorFullyDormantForConnection
+
+	// Flushing dormancy puts it back in the active list, where the consider list picks it up again.
+	ReplicationSchedule.Remove(Actor);
+}
+
+void USpatialNetDriver::ForceNetUpdate(AActor* Actor)
+{
+	Super::ForceNetUpdate(Actor);
+
+	WakeActorForReplication(Actor);
+}
+
+void USpatialNetDriver::WakeActorForReplication(AActor* Actor)
+{
+	if (IsServer())
+	{
+		ReplicationSchedule.Wake(Actor);
+	}
 }
 
 void USpatialNetDriver::OnOwnerUpdated(AActor* Actor, AActor* OldOwner)
@@ -1286,6 +1340,7 @@ void USpatialNetDriver::NotifyActorLevelUnloaded(AActor* Actor)
 	// until the server does, but we can clean it up because we don't send data through the channels.
 	// Cleaning it up also removes the references to the entity and channel from our maps.
 
+	// Also takes the actor off the network object list and the replication schedule.
 	NotifyActorDestroyed(Actor, true);
 
 	if (ServerConnection != nullptr)
@@ -1456,6 +1511,173 @@ int32 USpatialNetDriver::ServerReplicateActors_PrepConnections(const float Delta
 	return bFoundReadyConnection ? NumClientsToTick : 0;
 }
 
+// The replication schedule is checked against the active network object list at least this often, in case an actor left the list
+// without the net driver being told.
+static constexpr float ReplicationScheduleReconcileInterval = 1.0f;
+
+// Actors another worker is authoritative over are woken when this worker gains authority, and otherwise only looked at this often.
+static constexpr float NonAuthoritativeActorRecheckInterval = 1.0f;
+
+void USpatialNetDriver::ServerReplicateActors_BuildConsiderList(TArray<FNetworkObjectInfo*>& OutConsiderList, const float ServerTickTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_SpatialBuildConsiderList);
+
+	const float TimeSeconds = World->TimeSeconds;
+	const FNetworkObjectList::FNetworkObjectSet& ActiveObjects = GetNetworkObjectList().GetActiveObjects();
+
+	// SpatialGDK - Unreal walks every active network object here to find the ones due to replicate. We only visit the actors the
+	// replication schedule says are due. Actors are scheduled in AddNetworkActor and removed as they leave the list, so it only
+	// outgrows the schedule when actors are flushed out of dormancy. The list itself is only walked, without looking at the actors,
+	// then or every reconcile interval.
+	if (ActiveObjects.Num() > ReplicationSchedule.Num() || TimeSeconds >= NextReplicationScheduleReconcileTime)
+	{
+		for (const TSharedPtr<FNetworkObjectInfo>& ObjectInfo : ActiveObjects)
+		{
+			if (!ReplicationSchedule.IsTracked(ObjectInfo->Actor))
+			{
+				ReplicationSchedule.Schedule(ObjectInfo->Actor, ObjectInfo->bPendingNetUpdate ? TimeSeconds : ObjectInfo->NextUpdateTime);
+			}
+		}
+		NextReplicationScheduleReconcileTime = TimeSeconds + ReplicationScheduleReconcileInterval;
+	}
+
+	TArray<AActor*> DueActors;
+	ReplicationSchedule.PopDue(TimeSeconds, DueActors);
+
+	const bool bUseAdaptiveNetFrequency = IsAdaptiveNetUpdateFrequencyEnabled();
+	TArray<AActor*> ActorsToRemove;
+
+	for (AActor* Actor : DueActors)
+	{
+		const TSharedPtr<FNetworkObjectInfo>* ObjectInfo = ActiveObjects.Find(Actor);
+		if (ObjectInfo == nullptr)
+		{
+			// Left the active list without the schedule being told, it is scheduled again if it comes back.
+			continue;
+		}
+
+		FNetworkObjectInfo* ActorInfo = ObjectInfo->Get();
+
+		if (!ActorInfo->bPendingNetUpdate && TimeSeconds <= ActorInfo->NextUpdateTime)
+		{
+			// The update time was pushed back since the actor was scheduled.
+			ReplicationSchedule.Schedule(Actor, ActorInfo->NextUpdateTime);
+			continue;
+		}
+
+		if (Actor->IsPendingKillPending() || Actor->GetRemoteRole() == ROLE_None)
+		{
+			ActorsToRemove.Add(Actor);
+			continue;
+		}
+
+		// This actor may belong to a different net driver, make sure this is the correct one
+		if (Actor->GetNetDriverName() != NetDriverName)
+		{
+			UE_LOG(LogSpatialOSNetDriver, Error, TEXT("Actor %s in wrong network actors list! (Has net driver '%s', expected '%s')"),
+				   *Actor->GetName(), *Actor->GetNetDriverName().ToString(), *NetDriverName.ToString());
+			ReplicationSchedule.Schedule(Actor, TimeSeconds);
+			continue;
+		}
+
+		// Verify the actor is actually initialized (it might have been intentionally spawn deferred until a later frame)
+		// and isn't still streaming in or out.
+		ULevel* Level = Actor->GetLevel();
+		if (!Actor->IsActorInitialized() || Level->HasVisibilityChangeRequestPending() || Level->bIsAssociatingLevel)
+		{
+			ReplicationSchedule.Schedule(Actor, TimeSeconds);
+			continue;
+		}
+
+		if (Actor->NetDormancy == DORM_Initial && Actor->IsNetStartupActor())
+		{
+			ActorsToRemove.Add(Actor);
+			continue;
+		}
+
+		// SpatialGDK - Only the authoritative worker replicates an actor. Torn off actors are still considered, so their channel is closed.
+		if (!Actor->HasAuthority() && !Actor->GetTearOff())
+		{
+			ReplicationSchedule.Schedule(Actor, TimeSeconds + NonAuthoritativeActorRecheckInterval);
+			continue;
+		}
+
+		// Set defaults if this actor is replicating for first time
+		if (ActorInfo->LastNetReplicateTime == 0)
+		{
+			ActorInfo->LastNetReplicateTime = TimeSeconds;
+			ActorInfo->OptimalNetUpdateDelta = 1.0f / Actor->NetUpdateFrequency;
+		}
+
+		const float ScaleDownStartTime = 2.0f;
+		const float ScaleDownTimeRange = 5.0f;
+
+		const float LastReplicateDelta = TimeSeconds - ActorInfo->LastNetReplicateTime;
+
+		if (LastReplicateDelta > ScaleDownStartTime)
+		{
+			if (Actor->MinNetUpdateFrequency == 0.0f)
+			{
+				Actor->MinNetUpdateFrequency = 2.0f;
+			}
+
+			// Calculate min delta (max rate actor will update), and max delta (slowest rate actor will update)
+			const float MinOptimalDelta = 1.0f / Actor->NetUpdateFrequency;
+			const float MaxOptimalDelta = FMath::Max(1.0f / Actor->MinNetUpdateFrequency, MinOptimalDelta);
+
+			// Interpolate between MinOptimalDelta/MaxOptimalDelta based on how long it's been since this actor actually sent anything
+			const float Alpha = FMath::Clamp((LastReplicateDelta - ScaleDownStartTime) / ScaleDownTimeRange, 0.0f, 1.0f);
+			ActorInfo->OptimalNetUpdateDelta = FMath::Lerp(MinOptimalDelta, MaxOptimalDelta, Alpha);
+		}
+
+		// Don't push the update time back if an update was forced, as with Unreal.
+		if (!ActorInfo->bPendingNetUpdate)
+		{
+			const float NextUpdateDelta = bUseAdaptiveNetFrequency ? ActorInfo->OptimalNetUpdateDelta : 1.0f / Actor->NetUpdateFrequency;
+			ActorInfo->NextUpdateTime = TimeSeconds + UpdateDelayRandomStream.FRand() * ServerTickTime + NextUpdateDelta;
+			ActorInfo->LastNetUpdateTime = GetElapsedTime();
+		}
+
+		ActorInfo->bPendingNetUpdate = false;
+
+		ReplicationSchedule.Schedule(Actor, ActorInfo->NextUpdateTime);
+
+		OutConsiderList.Add(ActorInfo);
+
+		// Call PreReplication on all actors that will be considered
+		Actor->CallPreReplication(this);
+	}
+
+	for (AActor* Actor : ActorsToRemove)
+	{
+		RemoveNetworkActor(Actor);
+	}
+}
+
+// Higher priority first. Ties are common on servers, which often have no viewers to prioritize actors by distance to, and go to the
+// actor that has waited longest, so actors held back by the rate limits take turns instead of the same ones winning every tick.
+struct FCompareActorPriorityAndStarvation
+{
+	bool operator()(const FActorPriority& A, const FActorPriority& B) const
+	{
+		if (A.Priority != B.Priority)
+		{
+			return B.Priority < A.Priority;
+		}
+
+		return GetLastReplicationTime(A) < GetLastReplicationTime(B);
+	}
+
+	// Entities waiting to be created are aged from when they were first considered, other actors from when they were last replicated.
+	// Both persist across ticks, in the network object info and the channel.
+	static double GetLastReplicationTime(const FActorPriority& ActorPriority)
+	{
+		const USpatialActorChannel* Channel = Cast<USpatialActorChannel>(ActorPriority.Channel);
+		return (Channel != nullptr && !Channel->bCreatingNewEntity) ? Channel->LastUpdateTime
+																	: ActorPriority.ActorInfo->LastNetReplicateTime;
+	}
+};
+
 struct FCompareActorPriorityAndMigration
 {
 	FCompareActorPriorityAndMigration(FSpatialLoadBalancingHandler& InMigrationHandler)
@@ -1469,7 +1691,7 @@ struct FCompareActorPriorityAndMigration
 		const bool BMigrates = MigrationHandler.GetActorsToMigrate().Contains(B.ActorInfo->Actor);
 		if (AMigrates == BMigrates)
 		{
-			return B.Priority < A.Priority;
+			return FCompareActorPriorityAndStarvation()(A, B);
 		}
 
 		if (AMigrates)
@@ -1483,6 +1705,81 @@ struct FCompareActorPriorityAndMigration
 	const FSpatialLoadBalancingHandler& MigrationHandler;
 };
 
+// The number of entities ServerReplicateActors_ProcessPrioritizedActors creates each tick.
+static int32 GetMaxEntitiesToCreate()
+{
+	const uint32 EntityCreationRateLimit = GetDefault<USpatialGDKSettings>()->EntityCreationRateLimit;
+	return (EntityCreationRateLimit > 0) ? EntityCreationRateLimit : INT32_MAX;
+}
+
+// The number of actors ServerReplicateActors_ProcessPrioritizedActors updates each tick. Migrating actors are always replicated first.
+static int32 GetMaxActorsToReplicate(const int32 NumActorsMigrating)
+{
+	const uint32 ActorReplicationRateLimit = GetDefault<USpatialGDKSettings>()->ActorReplicationRateLimit;
+	const int32 MaxActorsToReplicate = (ActorReplicationRateLimit > 0) ? ActorReplicationRateLimit : INT32_MAX;
+	return FMath::Max(MaxActorsToReplicate, NumActorsMigrating);
+}
+
+// Moves the candidates ServerReplicateActors_ProcessPrioritizedActors will act on to the front of PriorityActors, and returns how many
+// there are: every torn off actor, then the highest priority entities to create and actors to update that fit in the rate limits.
+// Only those are sorted, so the cost grows with the number of candidates times the log of the limits.
+static int32 SelectActorsToProcess(FActorPriority** PriorityActors, const int32 NumCandidates,
+								   FSpatialLoadBalancingHandler& MigrationHandler)
+{
+	// Moves the candidates in [First, Last) matching Predicate to the front of that range, and returns how many there are.
+	auto Partition = [PriorityActors](const int32 First, const int32 Last, auto Predicate) {
+		int32 NumMatching = 0;
+		for (int32 Index = First; Index < Last; ++Index)
+		{
+			if (Predicate(*PriorityActors[Index]))
+			{
+				Swap(PriorityActors[First + NumMatching], PriorityActors[Index]);
+				++NumMatching;
+			}
+		}
+		return NumMatching;
+	};
+
+	// Actors whose channel was just closed are skipped when processing, so they mustn't take the place of one within the limits.
+	const int32 NumOpen = Partition(0, NumCandidates, [](const FActorPriority& ActorPriority) {
+		return ActorPriority.Channel == nullptr || ActorPriority.Channel->Actor != nullptr;
+	});
+
+	// Torn off actors replicate their final tick regardless of the limits.
+	const int32 NumTornOff = Partition(0, NumOpen, [](const FActorPriority& ActorPriority) {
+		return ActorPriority.ActorInfo->Actor->GetTearOff();
+	});
+
+	FActorPriority** const Creations = PriorityActors + NumTornOff;
+	const int32 NumCreations = Partition(NumTornOff, NumOpen, [](const FActorPriority& ActorPriority) {
+		const USpatialActorChannel* Channel = Cast<USpatialActorChannel>(ActorPriority.Channel);
+		return Channel == nullptr || Channel->bCreatingNewEntity;
+	});
+
+	FActorPriority** const Updates = Creations + NumCreations;
+	const int32 NumUpdates = NumOpen - NumTornOff - NumCreations;
+
+	const int32 NumCreationsToProcess = FMath::Min(NumCreations, GetMaxEntitiesToCreate());
+	SpatialGDK::PartialSort(Creations, NumCreations, NumCreationsToProcess, FCompareActorPriorityAndStarvation());
+
+	const int32 NumActorsMigrating = MigrationHandler.GetActorsToMigrate().Num();
+	const int32 NumUpdatesToProcess = FMath::Min(NumUpdates, GetMaxActorsToReplicate(NumActorsMigrating));
+	if (NumActorsMigrating > 0)
+	{
+		// Process actors migrating first, in order to not have them separated if they need to migrate together and replication rate
+		// limiting happens.
+		SpatialGDK::PartialSort(Updates, NumUpdates, NumUpdatesToProcess, FCompareActorPriorityAndMigration(MigrationHandler));
+	}
+	else
+	{
+		SpatialGDK::PartialSort(Updates, NumUpdates, NumUpdatesToProcess, FCompareActorPriorityAndStarvation());
+	}
+
+	FMemory::Memmove(Creations + NumCreationsToProcess, Updates, NumUpdatesToProcess * sizeof(FActorPriority*));
+
+	return NumTornOff + NumCreationsToProcess + NumUpdatesToProcess;
+}
+
 int32 USpatialNetDriver::ServerReplicateActors_PrioritizeActors(UNetConnection* InConnection, const TArray<FNetViewer>& ConnectionViewers,
 																FSpatialLoadBalancingHandler& MigrationHandler,
 																const TArray<FNetworkObjectInfo*> ConsiderList, const bool bCPUSaturated,
@@ -1507,6 +1804,7 @@ int32 USpatialNetDriver::ServerReplicateActors_PrioritizeActors(UNetConnection*
 	}
 
 	int32 FinalSortedCount = 0;
+	int32 NumPriorityEntries = 0;
 	int32 DeletedCount = 0;
 
 	const int32 MaxSortedActors = ConsiderList.Num() + DestroyedStartupOrDormantActors.Num();
@@ -1541,7 +1839,9 @@ int32 USpatialNetDriver::ServerReplicateActors_PrioritizeActors(UNetConnection*
 				Channel->StartBecomingDormant();
 			}
 
+#if !UE_BUILD_SHIPPING
 			UE_LOG(LogSpatialOSNetDriver, Verbose, TEXT("Actor %s will be replicated on the catch-all connection"), *Actor->GetName());
+#endif
 
 			// Check actor relevancy if Net Relevancy is enabled in the GDK settings
 			if (bNetRelevancyEnabled && !IsActorRelevantToConnection(Actor, Channel, ConnectionViewers))
@@ -1554,8 +1854,10 @@ int32 USpatialNetDriver::ServerReplicateActors_PrioritizeActors(UNetConnection*
 			// NOTE - We use NetTag to make sure SentTemporaries didn't already mark this actor to be skipped
 			if (Actor->NetTag != NetTag)
 			{
+#if !UE_BUILD_SHIPPING
 				UE_LOG(LogNetTraffic, Log, TEXT("Consider %s alwaysrelevant %d frequency %f "), *Actor->GetName(), Actor->bAlwaysRelevant,
 					   Actor->NetUpdateFrequency);
+#endif
 
 				Actor->NetTag = NetTag;
 
@@ -1572,32 +1874,32 @@ int32 USpatialNetDriver::ServerReplicateActors_PrioritizeActors(UNetConnection*
 			}
 		}
 
+		// SpatialGDK - Unreal sorts every entry by priority here. ServerReplicateActors_ProcessPrioritizedActors only creates and
+		// updates a limited number of entities each tick, so we only select and sort the highest priority candidates within the limits.
+		// Entries that weren't selected are still in OutPriorityList, so deletion entries are added after them.
+		NumPriorityEntries = FinalSortedCount;
+		FinalSortedCount = SelectActorsToProcess(OutPriorityActors, FinalSortedCount, MigrationHandler);
+
 		// Add in deleted actors
 		for (auto It = InConnection->GetDestroyedStartupOrDormantActorGUIDs().CreateIterator(); It; ++It)
 		{
 			FActorDestructionInfo& DInfo = *DestroyedStartupOrDormantActors.FindChecked(*It);
-			OutPriorityList[FinalSortedCount] = FActorPriority(InConnection, &DInfo, ConnectionViewers);
-			OutPriorityActors[FinalSortedCount] = OutPriorityList + FinalSortedCount;
+			OutPriorityList[NumPriorityEntries] = FActorPriority(InConnection, &DInfo, ConnectionViewers);
+			OutPriorityActors[FinalSortedCount] = OutPriorityList + NumPriorityEntries;
+			NumPriorityEntries++;
 			FinalSortedCount++;
 			DeletedCount++;
 		}
-
-		if (MigrationHandler.GetActorsToMigrate().Num() > 0)
-		{
-			// Process actors migrating first, in order to not have them separated if they need to migrate together and replication rate
-			// limiting happens.
-			Sort(OutPriorityActors, FinalSortedCount, FCompareActorPriorityAndMigration(MigrationHandler));
-		}
-		else
-		{
-			// Sort by priority
-			Sort(OutPriorityActors, FinalSortedCount, FCompareFActorPriority());
-		}
 	}
 
 	UE_LOG(LogNetTraffic, Log, TEXT("ServerReplicateActors_PrioritizeActors: Potential %04i ConsiderList %03i FinalSortedCount %03i"),
 		   MaxSortedActors, ConsiderList.Num(), FinalSortedCount);
 
+#if !UE_BUILD_SHIPPING
+	// Counted before selection, the metrics display compares it with the rate limits to show the replication backlog.
+	ConsiderListSize = NumPriorityEntries;
+#endif
+
 	return FinalSortedCount;
 }
 
@@ -1628,18 +1930,16 @@ void USpatialNetDriver::ServerReplicateActors_ProcessPrioritizedActors(UNetConne
 	const int32 NumActorsMigrating = MigrationHandler.GetActorsToMigrate().Num();
 
 	// SpatialGDK - Entity creation rate limiting based on config value.
-	uint32 EntityCreationRateLimit = GetDefault<USpatialGDKSettings>()->EntityCreationRateLimit;
-	int32 MaxEntitiesToCreate = (EntityCreationRateLimit > 0) ? EntityCreationRateLimit : INT32_MAX;
+	const int32 MaxEntitiesToCreate = GetMaxEntitiesToCreate();
 	int32 FinalCreationCount = 0;
 
 	// SpatialGDK - Actor replication rate limiting based on config value.
-	uint32 ActorReplicationRateLimit = GetDefault<USpatialGDKSettings>()->ActorReplicationRateLimit;
-	int32 MaxActorsToReplicate = (ActorReplicationRateLimit > 0) ? ActorReplicationRateLimit : INT32_MAX;
-	if (MaxActorsToReplicate < NumActorsMigrating)
+	const int32 MaxActorsToReplicate = GetMaxActorsToReplicate(NumActorsMigrating);
+	const int32 ConfiguredMaxActorsToReplicate = GetMaxActorsToReplicate(0);
+	if (MaxActorsToReplicate > ConfiguredMaxActorsToReplicate)
 	{
 		UE_LOG(LogSpatialOSNetDriver, Warning, TEXT("ActorReplicationRateLimit of %i ignored because %i actors need to migrate"),
-			   MaxActorsToReplicate, NumActorsMigrating);
-		MaxActorsToReplicate = NumActorsMigrating;
+			   ConfiguredMaxActorsToReplicate, NumActorsMigrating);
 	}
 	int32 FinalReplicatedCount = 0;
 
@@ -1658,9 +1958,11 @@ void USpatialNetDriver::ServerReplicateActors_ProcessPrioritizedActors(UNetConne
 			UActorChannel* Channel = (UActorChannel*)InConnection->CreateChannelByName(NAME_Actor, EChannelCreateFlags::OpenedLocally);
 			if (Channel)
 			{
+#if !UE_BUILD_SHIPPING
 				UE_LOG(LogNetTraffic, Log, TEXT("Server replicate actor creating destroy channel for NetGUID <%s,%s> Priority: %d"),
 					   *PriorityActors[j]->DestructionInfo->NetGUID.ToString(), *PriorityActors[j]->DestructionInfo->PathName,
 					   PriorityActors[j]->Priority);
+#endif
 
 				InConnection->GetDestroyedStartupOrDormantActorGUIDs().Remove(
 					PriorityActors[j]->DestructionInfo->NetGUID); // Remove from connections to-be-destroyed list (close bunch of reliable,
@@ -1683,7 +1985,9 @@ void USpatialNetDriver::ServerReplicateActors_ProcessPrioritizedActors(UNetConne
 
 		// Normal actor replication
 		USpatialActorChannel* Channel = Cast<USpatialActorChannel>(PriorityActors[j]->Channel);
+#if !UE_BUILD_SHIPPING
 		UE_LOG(LogNetTraffic, Log, TEXT(" Maybe Replicate %s"), *PriorityActors[j]->ActorInfo->Actor->GetName());
+#endif
 		if (Channel == nullptr || Channel->Actor != nullptr) // Make sure didn't just close this channel.
 		{
 			AActor* Actor = PriorityActors[j]->ActorInfo->Actor;
@@ -1749,8 +2053,11 @@ void USpatialNetDriver::ServerReplicateActors_ProcessPrioritizedActors(UNetConne
 					Channel = GetOrCreateSpatialActorChannel(Actor);
 					if ((Channel == nullptr) && (Actor->NetUpdateFrequency < 1.0f))
 					{
+#if !UE_BUILD_SHIPPING
 						UE_LOG(LogNetTraffic, Log, TEXT("Unable to replicate %s"), *Actor->GetName());
+#endif
 						PriorityActors[j]->ActorInfo->NextUpdateTime = Actor->GetWorld()->TimeSeconds + 0.2f * FMath::FRand();
+						ReplicationSchedule.Schedule(Actor, PriorityActors[j]->ActorInfo->NextUpdateTime);
 					}
 				}
 
@@ -1764,7 +2071,9 @@ void USpatialNetDriver::ServerReplicateActors_ProcessPrioritizedActors(UNetConne
 					if (Channel->IsNetReady(0))
 					{
 						// Replicate the actor.
+#if !UE_BUILD_SHIPPING
 						UE_LOG(LogNetTraffic, Log, TEXT("- Replicate %s. %d"), *Actor->GetName(), PriorityActors[j]->Priority);
+#endif
 						if (DebugRelevantActors)
 						{
 							LastRelevantActors.Add(Actor);
@@ -1803,7 +2112,9 @@ void USpatialNetDriver::ServerReplicateActors_ProcessPrioritizedActors(UNetConne
 			// in a SpatialOS game. Might be worth an investigation in future as a performance win - UNR-3063
 			if (Actor->GetTearOff() && Channel != NULL)
 			{
+#if !UE_BUILD_SHIPPING
 				UE_LOG(LogNetTraffic, Log, TEXT("- Closing channel for no longer relevant actor %s"), *Actor->GetName());
+#endif
 				Channel->Close(Actor->GetTearOff() ? EChannelCloseReason::TearOff : EChannelCloseReason::Relevancy);
 			}
 		}
@@ -1907,6 +2218,10 @@ void USpatialNetDriver::ProcessRPC(AActor* Actor, UObject* SubObject, UFunction*
 		Payload.Index = Info.Index;
 		Payload.Offset = CallingObjectRef.Offset;
 		Payload.PayloadData = RPCs->CreateRPCPayloadData(Function, Parameters);
+		if (SpatialMetrics != nullptr)
+		{
+			SpatialMetrics->TrackRPCBandwidth(SpatialGDK::EBandwidthDirection::Sent, Function, Actor, Payload.PayloadData.Num());
+		}
 		FSpatialGDKSpanId SpanId = RPCs->CreatePushRPCEvent(CallingObject, Function);
 
 		SpatialGDK::TRPCQueue<FRPCPayload, FSpatialGDKSpanId>* Queue = nullptr;
@@ -2233,10 +2548,6 @@ int32 USpatialNetDriver::ServerReplicateActors(float DeltaSeconds)
 		DebugRelevantActors = false;
 	}
 
-#if !UE_BUILD_SHIPPING
-	ConsiderListSize = FinalSortedCount;
-#endif
-
 	return Updated;
 #else
 	return 0;
@@ -2251,8 +2562,23 @@ void USpatialNetDriver::TickDispatch(float DeltaTime)
 	if (Connection != nullptr)
 	{
 		const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
+		SpatialGDK::FNetworkFrameProfiler* FrameProfiler = GetFrameProfiler();
 
-		Connection->Advance(DeltaTime);
+		{
+			SpatialGDK::FNetworkFrameStageScope StageScope(FrameProfiler, SpatialGDK::ENetworkFrameStage::ConnectionAdvance);
+			Connection->Advance(DeltaTime);
+		}
+
+		if (FrameProfiler != nullptr && Connection->HasValidCoordinator())
+		{
+			const SpatialGDK::FViewAdvanceTimings& Timings = Connection->GetCoordinator().GetLastAdvanceTimings();
+			FrameProfiler->AddStageCycles(SpatialGDK::ENetworkFrameStage::OpRetrieval, Timings.OpRetrievalCycles);
+			FrameProfiler->AddStageCycles(SpatialGDK::ENetworkFrameStage::ViewDelta, Timings.ViewDeltaCycles);
+			FrameProfiler->AddStageCycles(SpatialGDK::ENetworkFrameStage::DispatcherCallbacks, Timings.DispatcherCycles);
+			FrameProfiler->AddStageCycles(SpatialGDK::ENetworkFrameStage::SubViewAdvance, Timings.SubViewCycles);
+			FrameProfiler->AddCounter(SpatialGDK::ENetworkFrameCounter::OpsReceived, Timings.NumOps);
+			FrameProfiler->AddCounter(SpatialGDK::ENetworkFrameCounter::EntityDeltas, Timings.NumEntityDeltas);
+		}
 
 		if (Connection->HasDisconnected())
 		{
@@ -2281,14 +2607,18 @@ void USpatialNetDriver::TickDispatch(float DeltaTime)
 				Connection->Flush();
 			}
 
-			if (RPCService.IsValid())
 			{
-				RPCService->AdvanceView();
-			}
+				SpatialGDK::FNetworkFrameStageScope StageScope(FrameProfiler, SpatialGDK::ENetworkFrameStage::RPCServices);
 
-			if (RPCs.IsValid())
-			{
-				RPCs->AdvanceView();
+				if (RPCService.IsValid())
+				{
+					RPCService->AdvanceView();
+				}
+
+				if (RPCs.IsValid())
+				{
+					RPCs->AdvanceView();
+				}
 			}
 
 			if (DebugCtx != nullptr)
@@ -2310,24 +2640,29 @@ void USpatialNetDriver::TickDispatch(float DeltaTime)
 
 			if (ActorSystem.IsValid())
 			{
-				ActorSystem->Advance();
+				ActorSystem->Advance(FrameProfiler);
 			}
 
 			{
 				SCOPE_CYCLE_COUNTER(STAT_SpatialProcessOps);
+				SpatialGDK::FNetworkFrameStageScope StageScope(FrameProfiler, SpatialGDK::ENetworkFrameStage::ProcessOps);
 				Dispatcher->ProcessOps(GetOpsFromEntityDeltas(Connection->GetEntityDeltas()));
 				Dispatcher->ProcessOps(Connection->GetWorkerMessages());
 				CrossServerRPCHandler->ProcessMessages(Connection->GetWorkerMessages(), DeltaTime);
 			}
 
-			if (RPCService.IsValid())
 			{
-				RPCService->ProcessChanges(GetElapsedTime());
-			}
+				SpatialGDK::FNetworkFrameStageScope StageScope(FrameProfiler, SpatialGDK::ENetworkFrameStage::RPCServices);
 
-			if (RPCs.IsValid())
-			{
-				RPCs->ProcessReceivedRPCs();
+				if (RPCService.IsValid())
+				{
+					RPCService->ProcessChanges(GetElapsedTime());
+				}
+
+				if (RPCs.IsValid())
+				{
+					RPCs->ProcessReceivedRPCs();
+				}
 			}
 
 			if (WellKnownEntitySystem.IsValid())
@@ -2381,6 +2716,11 @@ void USpatialNetDriver::TickDispatch(float DeltaTime)
 			PackageMap->Advance();
 		}
 
+		if (Connection->HasValidCoordinator())
+		{
+			Connection->GetCoordinator().RecordOpListsApplied();
+		}
+
 		if (!bIsReadyToStart)
 		{
 			TryFinishStartup();
@@ -2540,6 +2880,8 @@ void USpatialNetDriver::TickFlush(float DeltaTime)
 {
 	const USpatialGDKSettings* SpatialGDKSettings = GetDefault<USpatialGDKSettings>();
 
+	SpatialGDK::FNetworkFrameProfiler* FrameProfiler = GetFrameProfiler();
+
 	PollPendingLoads();
 
 	if (IsServer() && GetSpatialOSNetConnection() != nullptr && bIsReadyToStart)
@@ -2557,7 +2899,16 @@ void USpatialNetDriver::TickFlush(float DeltaTime)
 		}
 		else
 		{
-			int32 Updated = ServerReplicateActors(DeltaTime);
+			int32 Updated = 0;
+			{
+				SpatialGDK::FNetworkFrameStageScope StageScope(FrameProfiler, SpatialGDK::ENetworkFrameStage::ServerReplicateActors);
+				Updated = ServerReplicateActors(DeltaTime);
+			}
+
+			if (FrameProfiler != nullptr)
+			{
+				FrameProfiler->AddCounter(SpatialGDK::ENetworkFrameCounter::ActorsReplicated, Updated);
+			}
 
 			static int32 LastUpdateCount = 0;
 			// Only log the zero replicated actors once after replicating an actor
@@ -2575,14 +2926,18 @@ void USpatialNetDriver::TickFlush(float DeltaTime)
 #endif // WITH_SERVER_CODE
 	}
 
-	if (RPCService != nullptr)
 	{
-		RPCService->PushUpdates();
-	}
+		SpatialGDK::FNetworkFrameStageScope StageScope(FrameProfiler, SpatialGDK::ENetworkFrameStage::RPCServices);
 
-	if (RPCs.IsValid())
-	{
-		RPCs->FlushRPCUpdates();
+		if (RPCService != nullptr)
+		{
+			RPCService->PushUpdates();
+		}
+
+		if (RPCs.IsValid())
+		{
+			RPCs->FlushRPCUpdates();
+		}
 	}
 
 	if (IsServer())
@@ -2596,14 +2951,25 @@ void USpatialNetDriver::TickFlush(float DeltaTime)
 
 	if (Connection != nullptr)
 	{
+		SpatialGDK::FNetworkFrameStageScope StageScope(FrameProfiler, SpatialGDK::ENetworkFrameStage::Flush);
 		Connection->Flush();
 	}
 
+	if (FrameProfiler != nullptr)
+	{
+		FrameProfiler->EndFrame();
+	}
+
 	// Super::TickFlush() will not call ReplicateActors() because Spatial connections have InternalAck set to true.
 	// In our case, our Spatial actor interop is triggered through ReplicateActors() so we want to call it regardless.
 	Super::TickFlush(DeltaTime);
 }
 
+SpatialGDK::FNetworkFrameProfiler* USpatialNetDriver::GetFrameProfiler() const
+{
+	return SpatialMetrics != nullptr ? &SpatialMetrics->GetFrameProfiler() : nullptr;
+}
+
 USpatialNetConnection* USpatialNetDriver::GetSpatialOSNetConnection() const
 {
 	if (ServerConnection)
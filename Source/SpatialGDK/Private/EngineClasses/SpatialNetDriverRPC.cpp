@@ -2,6 +2,7 @@
 
 #include "EngineClasses/SpatialNetDriverRPC.h"
 #include "EngineClasses/SpatialNetBitReader.h"
+#include "EngineClasses/SpatialNetBitWriter.h"
 #include "EngineClasses/SpatialNetDriver.h"
 #include "EngineClasses/SpatialPackageMapClient.h"
 #include "Interop/Connection/SpatialWorkerConnection.h"
@@ -11,6 +12,7 @@
 #include "Interop/RPCs/RPC_RingBufferWithACK_Sender.h"
 #include "Utils/RPCRingBuffer.h"
 #include "Utils/RepLayoutUtils.h"
+#include "Utils/SpatialMetrics.h"
 
 #include "Algo/AnyOf.h"
 
@@ -97,16 +99,20 @@ void FSpatialNetDriverRPC::OnUpdateWritten(TArray<UpdateToSend>& OutUpdates, Wor
 			Update.Update.component_id = ComponentId;
 			Update.Update.schema_type = nullptr;
 		}
-		FWorkerComponentUpdate& Update = OutUpdates.Last().Update;
-		if (Update.schema_type == nullptr)
-		{
-			Update.schema_type = InUpdate;
-		}
-		else
-		{
-			Schema_MergeComponentUpdateIntoUpdate(InUpdate, Update.schema_type,ComponentId);
-			Schema_DestroyComponentUpdate(InUpdate);
-		}
+		MergeUpdate(OutUpdates.Last().Update, InUpdate);
+	}
+}
+
+void FSpatialNetDriverRPC::MergeUpdate(FWorkerComponentUpdate& Update, Schema_ComponentUpdate* InUpdate)
+{
+	if (Update.schema_type == nullptr)
+	{
+		Update.schema_type = InUpdate;
+	}
+	else
+	{
+		Schema_MergeComponentUpdateIntoUpdate(InUpdate, Update.schema_type, Update.component_id);
+		Schema_DestroyComponentUpdate(InUpdate);
 	}
 }
 
@@ -138,6 +144,22 @@ RPCCallbacks::UpdateWritten FSpatialNetDriverRPC::MakeUpdateWriteCallback()
 	};
 }
 
+RPCCallbacks::UpdateWritten FSpatialNetDriverRPC::MakeACKWriteCallback()
+{
+	check(bUpdateCacheInUse.load());
+	return [this](Worker_EntityId EntityId, Worker_ComponentId ComponentId, Schema_ComponentUpdate* InUpdate) {
+		if (const int32* Index = PendingUpdateIndices_Cache.Find(EntityComponentId(EntityId, ComponentId)))
+		{
+			if (ensure(InUpdate != nullptr))
+			{
+				MergeUpdate(UpdateToSend_Cache[*Index].Update, InUpdate);
+			}
+			return;
+		}
+		OnUpdateWritten(UpdateToSend_Cache, EntityId, ComponentId, InUpdate);
+	};
+}
+
 FSpatialNetDriverRPC::FSpatialNetDriverRPC(USpatialNetDriver& InNetDriver, const SpatialGDK::FSubView& InActorAuthSubView,
 										   const SpatialGDK::FSubView& InActorNonAuthSubView)
 	: NetDriver(InNetDriver)
@@ -249,11 +271,37 @@ void FSpatialNetDriverRPC::FlushRPCUpdates()
 {
 	RAIIUpdateContext UpdateCtx(*this);
 
+	// Outgoing RPCs are written first, so that ACKs can be merged into updates already sent for the same entity.
+	WriteQueuedRPCs();
+	WriteACKs();
+}
+
+void FSpatialNetDriverRPC::WriteQueuedRPCs() {}
+
+void FSpatialNetDriverRPC::WriteRPCQueue(StandardQueue& Queue)
+{
+	RPCWritingContext Ctx(Queue.Name, MakeUpdateWriteCallback());
+	Queue.FlushAll(Ctx, MakeRPCSentCallback());
+}
+
+void FSpatialNetDriverRPC::WriteACKs()
+{
+	PendingUpdateIndices_Cache.Reset();
+	for (int32 Index = 0; Index < UpdateToSend_Cache.Num(); ++Index)
+	{
+		const UpdateToSend& Update = UpdateToSend_Cache[Index];
+		PendingUpdateIndices_Cache.Add(EntityComponentId(Update.EntityId, Update.Update.component_id), Index);
+	}
+
+	auto HasPendingUpdate = [this](Worker_EntityId EntityId, Worker_ComponentId ComponentId) {
+		return PendingUpdateIndices_Cache.Contains(EntityComponentId(EntityId, ComponentId));
+	};
+
 	const TMap<FName, RPCService::RPCReceiverDescription>& Receivers = RPCService->GetReceivers();
 	for (const auto& Receiver : Receivers)
 	{
-		RPCWritingContext Ctx(Receiver.Key, MakeUpdateWriteCallback());
-		Receiver.Value.Receiver->FlushUpdates(Ctx);
+		RPCWritingContext Ctx(Receiver.Key, MakeACKWriteCallback());
+		Receiver.Value.Receiver->FlushUpdates(Ctx, HasPendingUpdate);
 	}
 }
 
@@ -261,8 +309,7 @@ void FSpatialNetDriverRPC::FlushRPCQueue(StandardQueue& Queue)
 {
 	RAIIUpdateContext UpdateCtx(*this);
 
-	RPCWritingContext Ctx(Queue.Name, MakeUpdateWriteCallback());
-	Queue.FlushAll(Ctx, MakeRPCSentCallback());
+	WriteRPCQueue(Queue);
 }
 
 void FSpatialNetDriverRPC::FlushRPCQueueForEntity(Worker_EntityId EntityId, StandardQueue& Queue)
@@ -289,12 +336,55 @@ FSpatialGDKSpanId FSpatialNetDriverRPC::CreatePushRPCEvent(UObject* TargetObject
 	return SpanId;
 }
 
+ERPCFlowControl FSpatialNetDriverRPC::GetFlowControl(Worker_EntityId EntityId, ERPCType RPCType) const
+{
+	const SenderAndQueue* Entry = SendersByType.Find(RPCType);
+	if (Entry == nullptr)
+	{
+		return ERPCFlowControl::Open;
+	}
+
+	// RPCs waiting in the local queue means the ring buffer could not take them.
+	if (Entry->Queue->GetNumQueued(EntityId) > 0)
+	{
+		return ERPCFlowControl::Saturated;
+	}
+
+	return Entry->Sender->GetFlowControl(EntityId);
+}
+
+TOptional<RPCSenderStats> FSpatialNetDriverRPC::GetSenderStats(Worker_EntityId EntityId, ERPCType RPCType) const
+{
+	const SenderAndQueue* Entry = SendersByType.Find(RPCType);
+	return Entry != nullptr ? Entry->Sender->GetStats(EntityId) : TOptional<RPCSenderStats>();
+}
+
+SIZE_T FSpatialNetDriverRPC::GetAllocatedSize() const
+{
+	SIZE_T Size = SendersByType.GetAllocatedSize() + UpdateToSend_Cache.GetAllocatedSize() + PendingUpdateIndices_Cache.GetAllocatedSize();
+	for (const UpdateToSend& Update : UpdateToSend_Cache)
+	{
+		Size += Update.Spans.GetAllocatedSize();
+	}
+	if (RPCService.IsValid())
+	{
+		Size += RPCService->GetAllocatedSize();
+	}
+	return Size;
+}
+
 TArray<uint8> FSpatialNetDriverRPC::CreateRPCPayloadData(UFunction* Function, void* Parameters)
 {
-	FSpatialNetBitWriter PayloadWriter(NetDriver.PackageMap);
+	FSpatialNetBitWriterPool::FScopedWriter PayloadWriter = FSpatialNetBitWriterPool::Acquire(NetDriver.PackageMap, Function->ParmsSize);
 	const TSharedPtr<FRepLayout> RepLayout = NetDriver.GetFunctionRepLayout(Function);
-	SpatialGDK::RepLayout_SendPropertiesForRPC(*RepLayout, PayloadWriter, Parameters);
-	return TArray<uint8>(PayloadWriter.GetData(), PayloadWriter.GetNumBytes());
+	SpatialGDK::RepLayout_SendPropertiesForRPC(*RepLayout, *PayloadWriter, Parameters);
+
+	if (SpatialGDK::FNetworkFrameProfiler* FrameProfiler = NetDriver.GetFrameProfiler())
+	{
+		FrameProfiler->AddCounter(SpatialGDK::ENetworkFrameCounter::RPCPayloadBytesSent, PayloadWriter->GetNumBytes());
+	}
+
+	return TArray<uint8>(PayloadWriter->GetData(), PayloadWriter->GetNumBytes());
 }
 
 bool FSpatialNetDriverRPC::CanExtractRPC(Worker_EntityId EntityId) const
@@ -471,6 +561,13 @@ bool FSpatialNetDriverRPC::ApplyRPC(Worker_EntityId EntityId, const FRPCPayload&
 		EventTracer->PopFromStack();
 	}
 
+	if (NetDriver.SpatialMetrics != nullptr)
+	{
+		const UObject* Actor = TargetObject->IsA<AActor>() ? TargetObject : TargetObject->GetTypedOuter<AActor>();
+		NetDriver.SpatialMetrics->TrackRPCBandwidth(SpatialGDK::EBandwidthDirection::Received, Function, Actor, RPCData.PayloadData.Num());
+		NetDriver.SpatialMetrics->RecordLatencySince(ESpatialLatencyMetric::RPCReceiveToExecute, MetaData.Timestamp);
+	}
+
 	return RPCConsumed;
 }
 
@@ -487,7 +584,12 @@ void FSpatialNetDriverRPC::MakeRingBufferWithACKSender(ERPCType RPCType, Worker_
 														RPCDesc.SchemaFieldStart, RPCRingBufferUtils::GetAckComponentId(RPCType),
 														RPCRingBufferUtils::GetAckFieldId(RPCType));
 
-	auto Sender = MakeUnique<ClientServerSender>(MoveTemp(Serializer), RPCDesc.RingBufferSize);
+	const USpatialGDKSettings* Settings = GetDefault<USpatialGDKSettings>();
+	RPCAdaptiveCapacitySettings AdaptiveCapacity;
+	AdaptiveCapacity.bEnabled = Settings->bEnableAdaptiveRPCRingBufferCapacity;
+	AdaptiveCapacity.MinCapacity = Settings->MinAdaptiveRPCRingBufferSize;
+
+	auto Sender = MakeUnique<ClientServerSender>(MoveTemp(Serializer), RPCDesc.RingBufferSize, AdaptiveCapacity);
 
 	RPCService::RPCQueueDescription Desc;
 	Desc.Sender = Sender.Get();
@@ -505,6 +607,7 @@ void FSpatialNetDriverRPC::MakeRingBufferWithACKSender(ERPCType RPCType, Worker_
 	Desc.Authority = AuthoritySet;
 
 	RPCService->AddRPCQueue(RPCName, MoveTemp(Desc));
+	SendersByType.Add(RPCType, { Sender.Get(), QueuePtr.Get() });
 	SenderPtr.Reset(Sender.Release());
 }
 
@@ -519,8 +622,22 @@ void FSpatialNetDriverRPC::MakeRingBufferWithACKReceiver(ERPCType RPCType, Worke
 
 	FName RPCName(SpatialConstants::RPCTypeToString(RPCType));
 
+	const USpatialGDKSettings* Settings = GetDefault<USpatialGDKSettings>();
+	RPCACKPolicy ACKPolicy;
+	ACKPolicy.EveryNRPCs = FMath::Max(1u, Settings->RPCACKBatchSize);
+	ACKPolicy.MaxDelayMs = Settings->RPCACKMaxDelayMs;
+	ACKPolicy.SenderCapacityRatio = Settings->RPCACKSenderCapacityRatio;
+	if (ACKPolicy.EveryNRPCs > 1 && ACKPolicy.MaxDelayMs == 0)
+	{
+		UE_LOG(LogSpatialNetDriverRPC, Warning,
+			   TEXT("RPCACKBatchSize is %u but RPCACKMaxDelayMs is 0. Batched ACKs need a timer, using %u ms instead."),
+			   ACKPolicy.EveryNRPCs, RPCACKPolicy::DefaultBatchedMaxDelayMs);
+		ACKPolicy.MaxDelayMs = RPCACKPolicy::DefaultBatchedMaxDelayMs;
+	}
+
 	ReceiverPtr = MakeUnique<ClientServerReceiver>(MoveTemp(Serializer), RPCDesc.RingBufferSize,
-												   TimestampAndETWrapper<FRPCPayload>(RPCName, Serializer.GetComponentId(), EventTracer));
+												   TimestampAndETWrapper<FRPCPayload>(RPCName, Serializer.GetComponentId(), EventTracer),
+												   ACKPolicy);
 
 	RPCService::RPCReceiverDescription Desc;
 	Desc.Authority = AuthoritySet;
@@ -551,11 +668,10 @@ FSpatialNetDriverServerRPC::FSpatialNetDriverServerRPC(USpatialNetDriver& InNetD
 	}
 }
 
-void FSpatialNetDriverServerRPC::FlushRPCUpdates()
+void FSpatialNetDriverServerRPC::WriteQueuedRPCs()
 {
-	FSpatialNetDriverRPC::FlushRPCUpdates();
-	FlushRPCQueue(*ClientReliableQueue);
-	FlushRPCQueue(*ClientUnreliableQueue);
+	WriteRPCQueue(*ClientReliableQueue);
+	WriteRPCQueue(*ClientUnreliableQueue);
 }
 
 void FSpatialNetDriverServerRPC::ProcessReceivedRPCs()
@@ -600,11 +716,10 @@ FSpatialNetDriverClientRPC::FSpatialNetDriverClientRPC(USpatialNetDriver& InNetD
 	MakeRingBufferWithACKReceiver(ERPCType::ClientUnreliable, RequiredAuth, ClientUnreliableReceiver);
 }
 
-void FSpatialNetDriverClientRPC::FlushRPCUpdates()
+void FSpatialNetDriverClientRPC::WriteQueuedRPCs()
 {
-	FSpatialNetDriverRPC::FlushRPCUpdates();
-	FlushRPCQueue(*ServerReliableQueue);
-	FlushRPCQueue(*ServerUnreliableQueue);
+	WriteRPCQueue(*ServerReliableQueue);
+	WriteRPCQueue(*ServerUnreliableQueue);
 }
 
 void FSpatialNetDriverClientRPC::ProcessReceivedRPCs()
@@ -231,8 +231,7 @@ FNetworkGUID USpatialPackageMapClient::GetNetGUIDFromUnrealObjectRef(const FUnre
 FNetworkGUID USpatialPackageMapClient::GetNetGUIDFromEntityId(const Worker_EntityId& EntityId) const
 {
 	FSpatialNetGUIDCache* SpatialGuidCache = static_cast<FSpatialNetGUIDCache*>(GuidCache.Get());
-	FUnrealObjectRef ObjectRef(EntityId, 0);
-	return GetNetGUIDFromUnrealObjectRef(ObjectRef);
+	return SpatialGuidCache->GetNetGUIDFromEntityId(EntityId);
 }
 
 TWeakObjectPtr<UObject> USpatialPackageMapClient::GetObjectFromUnrealObjectRef(const FUnrealObjectRef& ObjectRef)
@@ -270,8 +269,8 @@ Worker_EntityId USpatialPackageMapClient::GetEntityIdFromObject(const UObject* O
 		return SpatialConstants::INVALID_ENTITY_ID;
 	}
 
-	FNetworkGUID NetGUID = GetNetGUIDFromObject(Object);
-	return GetUnrealObjectRefFromNetGUID(NetGUID).Entity;
+	FSpatialNetGUIDCache* SpatialGuidCache = static_cast<FSpatialNetGUIDCache*>(GuidCache.Get());
+	return SpatialGuidCache->GetEntityIdFromNetGUID(GetNetGUIDFromObject(Object));
 }
 
 bool USpatialPackageMapClient::CanClientLoadObject(UObject* Object)
@@ -415,7 +414,7 @@ FNetworkGUID FSpatialNetGUIDCache::AssignNewEntityActorNetGUID(AActor* Actor, Wo
 		NetGUID = AssignNewStablyNamedObjectNetGUID(Actor);
 
 		// We register the entity id ref here.
-		UnrealObjectRefToNetGUID.Emplace(EntityObjectRef, NetGUID);
+		AddNetGUIDLookup(EntityObjectRef, NetGUID);
 
 		// Once we have an entity id, we should always be using it to refer to entities.
 		// Since the path ref may have been registered previously, we first try to remove it
@@ -460,7 +459,7 @@ FNetworkGUID FSpatialNetGUIDCache::AssignNewEntityActorNetGUID(AActor* Actor, Wo
 													 !CanClientLoadObject(Subobject, SubobjectNetGUID));
 
 			// This is the only extra object ref that has to be registered for the subobject.
-			UnrealObjectRefToNetGUID.Emplace(StablyNamedSubobjectRef, SubobjectNetGUID);
+			AddNetGUIDLookup(StablyNamedSubobjectRef, SubobjectNetGUID);
 
 			// As the subobject may have be referred to previously in replication flow, it would
 			// have it's stable name registered as it's UnrealObjectRef inside NetGUIDToUnrealObjectRef.
@@ -556,16 +555,16 @@ void FSpatialNetGUIDCache::RemoveEntityNetGUID(Worker_EntityId EntityId)
 		for (auto& SubobjectInfoPair : Info.SubobjectInfo)
 		{
 			FUnrealObjectRef SubobjectRef(EntityId, SubobjectInfoPair.Key);
-			if (FNetworkGUID* SubobjectNetGUID = UnrealObjectRefToNetGUID.Find(SubobjectRef))
+			if (const FNetworkGUID* SubobjectNetGUID = FindNetGUID(SubobjectRef))
 			{
 				NetGUIDToUnrealObjectRef.Remove(*SubobjectNetGUID);
-				UnrealObjectRefToNetGUID.Remove(SubobjectRef);
+				RemoveNetGUIDLookup(SubobjectRef);
 
 				if (StablyNamedRefOption.IsSet())
 				{
 					// bNoLoadOnClient is set to a fixed value because it does not affect equality
-					UnrealObjectRefToNetGUID.Remove(FUnrealObjectRef(0, 0, SubobjectInfoPair.Value->SubobjectName.ToString(),
-																	 StablyNamedRefOption.GetValue(), /*bNoLoadOnClient*/ false));
+					RemoveNetGUIDLookup(FUnrealObjectRef(0, 0, SubobjectInfoPair.Value->SubobjectName.ToString(),
+														 StablyNamedRefOption.GetValue(), /*bNoLoadOnClient*/ false));
 				}
 			}
 		}
@@ -580,7 +579,7 @@ void FSpatialNetGUIDCache::RemoveEntityNetGUID(Worker_EntityId EntityId)
 			{
 				if (FUnrealObjectRef* SubobjectRef = NetGUIDToUnrealObjectRef.Find(*SubobjectNetGUID))
 				{
-					UnrealObjectRefToNetGUID.Remove(*SubobjectRef);
+					RemoveNetGUIDLookup(*SubobjectRef);
 					NetGUIDToUnrealObjectRef.Remove(*SubobjectNetGUID);
 				}
 			}
@@ -592,18 +591,18 @@ void FSpatialNetGUIDCache::RemoveEntityNetGUID(Worker_EntityId EntityId)
 	// TODO: Figure out why NetGUIDToUnrealObjectRef might not have this GUID. UNR-989
 	if (FUnrealObjectRef* ActorRef = NetGUIDToUnrealObjectRef.Find(EntityNetGUID))
 	{
-		UnrealObjectRefToNetGUID.Remove(*ActorRef);
+		RemoveNetGUIDLookup(*ActorRef);
 	}
 	NetGUIDToUnrealObjectRef.Remove(EntityNetGUID);
 	if (StablyNamedRefOption.IsSet())
 	{
-		UnrealObjectRefToNetGUID.Remove(StablyNamedRefOption.GetValue());
+		RemoveNetGUIDLookup(StablyNamedRefOption.GetValue());
 	}
 }
 
 void FSpatialNetGUIDCache::RemoveSubobjectNetGUID(const FUnrealObjectRef& SubobjectRef)
 {
-	if (!UnrealObjectRefToNetGUID.Contains(SubobjectRef))
+	if (FindNetGUID(SubobjectRef) == nullptr)
 	{
 		return;
 	}
@@ -641,14 +640,14 @@ void FSpatialNetGUIDCache::RemoveSubobjectNetGUID(const FUnrealObjectRef& Subobj
 			if (StablyNamedRefOption.IsSet())
 			{
 				// bNoLoadOnClient is set to a fixed value because it does not affect equality
-				UnrealObjectRefToNetGUID.Remove(FUnrealObjectRef(0, 0, SubobjectInfoPtr->Get().SubobjectName.ToString(),
-																 StablyNamedRefOption.GetValue(), /*bNoLoadOnClient*/ false));
+				RemoveNetGUIDLookup(FUnrealObjectRef(0, 0, SubobjectInfoPtr->Get().SubobjectName.ToString(),
+													 StablyNamedRefOption.GetValue(), /*bNoLoadOnClient*/ false));
 			}
 		}
 	}
-	FNetworkGUID SubobjectNetGUID = UnrealObjectRefToNetGUID[SubobjectRef];
+	const FNetworkGUID SubobjectNetGUID = *FindNetGUID(SubobjectRef);
 	NetGUIDToUnrealObjectRef.Remove(SubobjectNetGUID);
-	UnrealObjectRefToNetGUID.Remove(SubobjectRef);
+	RemoveNetGUIDLookup(SubobjectRef);
 }
 
 FNetworkGUID FSpatialNetGUIDCache::GetNetGUIDFromUnrealObjectRef(const FUnrealObjectRef& ObjectRef)
@@ -658,7 +657,7 @@ FNetworkGUID FSpatialNetGUIDCache::GetNetGUIDFromUnrealObjectRef(const FUnrealOb
 
 FNetworkGUID FSpatialNetGUIDCache::GetNetGUIDFromUnrealObjectRefInternal(const FUnrealObjectRef& ObjectRef)
 {
-	FNetworkGUID* CachedGUID = UnrealObjectRefToNetGUID.Find(ObjectRef);
+	const FNetworkGUID* CachedGUID = FindNetGUID(ObjectRef);
 	FNetworkGUID NetGUID = CachedGUID ? *CachedGUID : FNetworkGUID{};
 	if (!NetGUID.IsValid() && ObjectRef.Path.IsSet())
 	{
@@ -712,12 +711,50 @@ void FSpatialNetGUIDCache::NetworkRemapObjectRefPaths(FUnrealObjectRef& ObjectRe
 
 void FSpatialNetGUIDCache::UnregisterActorObjectRefOnly(const FUnrealObjectRef& ObjectRef)
 {
-	if (FNetworkGUID* NetGUID = UnrealObjectRefToNetGUID.Find(ObjectRef))
+	if (const FNetworkGUID* NetGUID = FindNetGUID(ObjectRef))
 	{
 		// Remove ObjectRef first so the reference above isn't destroyed
 		NetGUIDToUnrealObjectRef.Remove(*NetGUID);
-		UnrealObjectRefToNetGUID.Remove(ObjectRef);
+		RemoveNetGUIDLookup(ObjectRef);
+	}
+}
+
+namespace
+{
+SIZE_T GetObjectRefAllocatedSize(const FUnrealObjectRef& ObjectRef)
+{
+	SIZE_T Size = 0;
+	if (ObjectRef.Path.IsSet())
+	{
+		Size += sizeof(FString) + ObjectRef.Path->GetAllocatedSize();
+	}
+	if (ObjectRef.Outer.IsSet())
+	{
+		Size += sizeof(FUnrealObjectRef) + GetObjectRefAllocatedSize(*ObjectRef.Outer);
+	}
+	return Size;
+}
+} // anonymous namespace
+
+SIZE_T FSpatialNetGUIDCache::GetAllocatedSize() const
+{
+	SIZE_T Size = ObjectLookup.GetAllocatedSize() + NetGUIDLookup.GetAllocatedSize() + NetGUIDToUnrealObjectRef.GetAllocatedSize()
+				  + UnrealObjectRefToNetGUID.GetAllocatedSize() + EntityObjectNetGUIDs.GetAllocatedSize();
+
+	for (const auto& Pair : NetGUIDToUnrealObjectRef)
+	{
+		Size += GetObjectRefAllocatedSize(Pair.Value);
 	}
+	for (const auto& Pair : UnrealObjectRefToNetGUID)
+	{
+		Size += GetObjectRefAllocatedSize(Pair.Key);
+	}
+	for (const auto& Pair : EntityObjectNetGUIDs)
+	{
+		Size += Pair.Value.GetAllocatedSize();
+	}
+
+	return Size;
 }
 
 FUnrealObjectRef FSpatialNetGUIDCache::GetUnrealObjectRefFromNetGUID(const FNetworkGUID& NetGUID) const
@@ -729,10 +766,87 @@ FUnrealObjectRef FSpatialNetGUIDCache::GetUnrealObjectRefFromNetGUID(const FNetw
 FNetworkGUID FSpatialNetGUIDCache::GetNetGUIDFromEntityId(Worker_EntityId EntityId) const
 {
 	FUnrealObjectRef ObjRef(EntityId, 0);
-	const FNetworkGUID* NetGUID = UnrealObjectRefToNetGUID.Find(ObjRef);
+	const FNetworkGUID* NetGUID = FindNetGUID(ObjRef);
 	return (NetGUID == nullptr) ? FNetworkGUID(0) : *NetGUID;
 }
 
+Worker_EntityId FSpatialNetGUIDCache::GetEntityIdFromNetGUID(const FNetworkGUID& NetGUID) const
+{
+	const FUnrealObjectRef* ObjRef = NetGUIDToUnrealObjectRef.Find(NetGUID);
+	return ObjRef ? ObjRef->Entity : SpatialConstants::INVALID_ENTITY_ID;
+}
+
+bool FSpatialNetGUIDCache::IsEntityObjectRef(const FUnrealObjectRef& ObjectRef)
+{
+	return ObjectRef.Entity != SpatialConstants::INVALID_ENTITY_ID && !ObjectRef.Path.IsSet() && !ObjectRef.Outer.IsSet()
+		   && !ObjectRef.bUseClassPathToLoadObject;
+}
+
+const FNetworkGUID* FSpatialNetGUIDCache::FindNetGUID(const FUnrealObjectRef& ObjectRef) const
+{
+	if (!IsEntityObjectRef(ObjectRef))
+	{
+		return UnrealObjectRefToNetGUID.Find(ObjectRef);
+	}
+
+	if (const FEntityObjectNetGUIDs* EntityNetGUIDs = EntityObjectNetGUIDs.Find(ObjectRef.Entity))
+	{
+		for (const TPair<ObjectOffset, FNetworkGUID>& OffsetNetGUID : *EntityNetGUIDs)
+		{
+			if (OffsetNetGUID.Key == ObjectRef.Offset)
+			{
+				return &OffsetNetGUID.Value;
+			}
+		}
+	}
+	return nullptr;
+}
+
+void FSpatialNetGUIDCache::AddNetGUIDLookup(const FUnrealObjectRef& ObjectRef, const FNetworkGUID& NetGUID)
+{
+	if (!IsEntityObjectRef(ObjectRef))
+	{
+		UnrealObjectRefToNetGUID.Emplace(ObjectRef, NetGUID);
+		return;
+	}
+
+	FEntityObjectNetGUIDs& EntityNetGUIDs = EntityObjectNetGUIDs.FindOrAdd(ObjectRef.Entity);
+	for (TPair<ObjectOffset, FNetworkGUID>& OffsetNetGUID : EntityNetGUIDs)
+	{
+		if (OffsetNetGUID.Key == ObjectRef.Offset)
+		{
+			OffsetNetGUID.Value = NetGUID;
+			return;
+		}
+	}
+	EntityNetGUIDs.Emplace(ObjectRef.Offset, NetGUID);
+}
+
+void FSpatialNetGUIDCache::RemoveNetGUIDLookup(const FUnrealObjectRef& ObjectRef)
+{
+	if (!IsEntityObjectRef(ObjectRef))
+	{
+		UnrealObjectRefToNetGUID.Remove(ObjectRef);
+		return;
+	}
+
+	FEntityObjectNetGUIDs* EntityNetGUIDs = EntityObjectNetGUIDs.Find(ObjectRef.Entity);
+	if (EntityNetGUIDs == nullptr)
+	{
+		return;
+	}
+
+	EntityNetGUIDs->RemoveAllSwap(
+		[&ObjectRef](const TPair<ObjectOffset, FNetworkGUID>& OffsetNetGUID) {
+			return OffsetNetGUID.Key == ObjectRef.Offset;
+		},
+		/* bAllowShrinking */ false);
+	if (EntityNetGUIDs->Num() == 0)
+	{
+		EntityObjectNetGUIDs.Remove(ObjectRef.Entity);
+	}
+}
+
 FNetworkGUID FSpatialNetGUIDCache::RegisterNetGUIDFromPathForStaticObject(const FString& PathName, const FNetworkGUID& OuterGUID,
 																		  bool bNoLoadOnClient)
 {
@@ -820,11 +934,9 @@ void FSpatialNetGUIDCache::RegisterObjectRef(FNetworkGUID NetGUID, const FUnreal
 				   || (NetGUIDToUnrealObjectRef.Contains(NetGUID) && NetGUIDToUnrealObjectRef.FindChecked(NetGUID) == RemappedObjectRef),
 			   TEXT("NetGUID to UnrealObjectRef mismatch - NetGUID: %s ObjRef in map: %s ObjRef expected: %s"), *NetGUID.ToString(),
 			   *NetGUIDToUnrealObjectRef.FindChecked(NetGUID).ToString(), *RemappedObjectRef.ToString());
-	checkfSlow(
-		!UnrealObjectRefToNetGUID.Contains(RemappedObjectRef)
-			|| (UnrealObjectRefToNetGUID.Contains(RemappedObjectRef) && UnrealObjectRefToNetGUID.FindChecked(RemappedObjectRef) == NetGUID),
-		TEXT("UnrealObjectRef to NetGUID mismatch - UnrealObjectRef: %s NetGUID in map: %s NetGUID expected: %s"), *NetGUID.ToString(),
-		*UnrealObjectRefToNetGUID.FindChecked(RemappedObjectRef).ToString(), *RemappedObjectRef.ToString());
+	checkfSlow(FindNetGUID(RemappedObjectRef) == nullptr || *FindNetGUID(RemappedObjectRef) == NetGUID,
+			   TEXT("UnrealObjectRef to NetGUID mismatch - UnrealObjectRef: %s NetGUID in map: %s NetGUID expected: %s"),
+			   *NetGUID.ToString(), *FindNetGUID(RemappedObjectRef)->ToString(), *RemappedObjectRef.ToString());
 	NetGUIDToUnrealObjectRef.Emplace(NetGUID, RemappedObjectRef);
-	UnrealObjectRefToNetGUID.Emplace(RemappedObjectRef, NetGUID);
+	AddNetGUIDLookup(RemappedObjectRef, NetGUID);
 }
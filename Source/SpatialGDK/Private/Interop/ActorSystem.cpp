@@ -10,6 +10,7 @@
 #include "Interop/InitialOnlyFilter.h"
 #include "Interop/SpatialReceiver.h"
 #include "Interop/SpatialSender.h"
+#include "Schema/AuthorityIntent.h"
 #include "Schema/Restricted.h"
 #include "Schema/Tombstone.h"
 #include "SpatialConstants.h"
@@ -20,7 +21,9 @@
 #include "Utils/EntityFactory.h"
 #include "Utils/InterestFactory.h"
 #include "Utils/RepLayoutUtils.h"
+#include "Utils/SchemaUtils.h"
 #include "Utils/SpatialActorUtils.h"
+#include "Utils/SpatialMetrics.h"
 
 DEFINE_LOG_CATEGORY(LogActorSystem);
 
@@ -176,8 +179,9 @@ void ActorSystem::ProcessAdds(const FEntitySubViewUpdate& SubViewUpdate)
 		if (Delta.Type == EntityDelta::ADD || Delta.Type == EntityDelta::TEMPORARILY_REMOVED)
 		{
 			const Worker_EntityId EntityId = Delta.EntityId;
+			const bool bWasPresent = PresentEntities.Contains(Delta.EntityId);
 
-			if (!PresentEntities.Contains(Delta.EntityId))
+			if (!bWasPresent)
 			{
 				// Create new actor for the entity.
 				EntityAdded(Delta.EntityId);
@@ -196,6 +200,12 @@ void ActorSystem::ProcessAdds(const FEntitySubViewUpdate& SubViewUpdate)
 																		: SpatialConstants::CLIENT_AUTH_COMPONENT_SET_ID;
 
 				AuthorityGained(EntityId, AuthorityComponentSet);
+
+				// Only entities we already had in view were handed over, rather than checked out with authority.
+				if (bWasPresent && SubViewUpdate.SubViewType == ENetRole::ROLE_Authority)
+				{
+					RecordAuthorityHandoverLatency(EntityId);
+				}
 			}
 		}
 	}
@@ -237,6 +247,7 @@ ActorSystem::ActorSystem(const FSubView& InActorSubView, const FSubView& InAutho
 	, EventTracer(InEventTracer)
 	, ClientNetLoadActorHelper(*InNetDriver)
 	, ClaimPartitionHandler(*InNetDriver->Connection)
+	, ReplicationLatencySampler(GetDefault<USpatialGDKSettings>()->ReplicationLatencySampleRate)
 {
 }
 
@@ -253,7 +264,7 @@ static void ValidateNoSubviewIntersections(const FSubView& Lhs, const FSubView&
 }
 #endif // DO_CHECK
 
-void ActorSystem::Advance()
+void ActorSystem::Advance(FNetworkFrameProfiler* FrameProfiler)
 {
 	for (const EntityDelta& Delta : ActorSubView->GetViewDelta().EntityDeltas)
 	{
@@ -287,19 +298,28 @@ void ActorSystem::Advance()
 		{ SimulatedSubView, ENetRole::ROLE_SimulatedProxy },
 	};
 
-	for (const FEntitySubView& SubView : SubViews)
 	{
-		ProcessRemoves(SubView);
+		FNetworkFrameStageScope StageScope(FrameProfiler, ENetworkFrameStage::ActorSystemRemoves);
+		for (const FEntitySubView& SubView : SubViews)
+		{
+			ProcessRemoves(SubView);
+		}
 	}
 
-	for (const FEntitySubView& SubView : SubViews)
 	{
-		ProcessUpdates(SubView);
+		FNetworkFrameStageScope StageScope(FrameProfiler, ENetworkFrameStage::ActorSystemUpdates);
+		for (const FEntitySubView& SubView : SubViews)
+		{
+			ProcessUpdates(SubView);
+		}
 	}
 
-	for (const FEntitySubView& SubView : SubViews)
 	{
-		ProcessAdds(SubView);
+		FNetworkFrameStageScope StageScope(FrameProfiler, ENetworkFrameStage::ActorSystemAdds);
+		for (const FEntitySubView& SubView : SubViews)
+		{
+			ProcessAdds(SubView);
+		}
 	}
 
 	for (const EntityDelta& Delta : TombstoneSubView->GetViewDelta().EntityDeltas)
@@ -400,6 +420,25 @@ void ActorSystem::AuthorityGained(Worker_EntityId EntityId, Worker_ComponentSetI
 	HandleActorAuthority(EntityId, ComponentSetId, WORKER_AUTHORITY_AUTHORITATIVE);
 }
 
+void ActorSystem::RecordAuthorityHandoverLatency(const Worker_EntityId EntityId) const
+{
+	if (NetDriver->SpatialMetrics == nullptr)
+	{
+		return;
+	}
+
+	const TOptional<AuthorityIntent> Intent = DeserializeComponent<AuthorityIntent>(NetDriver->Connection->GetCoordinator(), EntityId);
+	if (!Intent.IsSet() || Intent->ChangeTimeTicks == 0)
+	{
+		return;
+	}
+
+	const int64 NowTicks = FDateTime::UtcNow().GetTicks();
+	const uint64 LatencyMicroseconds =
+		NowTicks > Intent->ChangeTimeTicks ? static_cast<uint64>((NowTicks - Intent->ChangeTimeTicks) / ETimespan::TicksPerMicrosecond) : 0;
+	NetDriver->SpatialMetrics->RecordLatency(ESpatialLatencyMetric::AuthorityHandover, LatencyMicroseconds);
+}
+
 void ActorSystem::HandleActorAuthority(const Worker_EntityId EntityId, const Worker_ComponentSetId ComponentSetId,
 									   const Worker_Authority Authority)
 {
@@ -493,6 +532,9 @@ void ActorSystem::HandleActorAuthority(const Worker_EntityId EntityId, const Wor
 
 					// We still want to call OnAuthorityGained if the Actor migrated to this worker or was loaded from a snapshot.
 					Actor->OnAuthorityGained();
+
+					// Actors we weren't authoritative over are only rarely considered for replication, so catch up now.
+					NetDriver->WakeActorForReplication(Actor);
 				}
 				else
 				{
@@ -959,6 +1001,12 @@ void ActorSystem::ApplyComponentData(USpatialActorChannel& Channel, UObject& Tar
 
 	ESchemaComponentType ComponentType = NetDriver->ClassInfoManager->GetCategoryByComponentId(ComponentId);
 
+	if (NetDriver->SpatialMetrics != nullptr && NetDriver->SpatialMetrics->IsBandwidthAccountingEnabled())
+	{
+		NetDriver->SpatialMetrics->TrackComponentBandwidth(EBandwidthDirection::Received, ComponentId, Channel.Actor,
+														   GetSerializedSize(Data));
+	}
+
 	if (ComponentType != SCHEMA_Invalid)
 	{
 		if (ComponentType == SCHEMA_Data && TargetObject.IsA<UActorComponent>())
@@ -996,6 +1044,7 @@ void ActorSystem::ResolvePendingOperations(UObject* Object, const FUnrealObjectR
 		   *ObjectRef.ToString());
 
 	ResolveIncomingOperations(Object, ObjectRef);
+	NetDriver->RPCService->OnObjectRefResolved(ObjectRef);
 
 	// When resolving an Actor that should uniquely exist in a deployment, e.g. GameMode, GameState, LevelScriptActors, we also
 	// resolve using class path (in case any properties were set from a server that hasn't resolved the Actor yet).
@@ -1005,11 +1054,9 @@ void ActorSystem::ResolvePendingOperations(UObject* Object, const FUnrealObjectR
 		if (ClassObjectRef.IsValid())
 		{
 			ResolveIncomingOperations(Object, ClassObjectRef);
+			NetDriver->RPCService->OnObjectRefResolved(ClassObjectRef);
 		}
 	}
-
-	// TODO: UNR-1650 We're trying to resolve all queues, which introduces more overhead.
-	NetDriver->RPCService->ProcessIncomingRPCs();
 }
 
 void ActorSystem::ResolveIncomingOperations(UObject* Object, const FUnrealObjectRef& ObjectRef)
@@ -1259,6 +1306,23 @@ USpatialActorChannel* ActorSystem::GetOrRecreateChannelForDormantActor(AActor* A
 void ActorSystem::ApplyComponentUpdate(const Worker_ComponentId ComponentId, Schema_ComponentUpdate* ComponentUpdate, UObject& TargetObject,
 									   USpatialActorChannel& Channel)
 {
+	if (NetDriver->SpatialMetrics != nullptr)
+	{
+		if (NetDriver->SpatialMetrics->IsBandwidthAccountingEnabled())
+		{
+			NetDriver->SpatialMetrics->TrackComponentBandwidth(EBandwidthDirection::Received, ComponentId, Channel.Actor,
+															   GetSerializedSize(ComponentUpdate));
+		}
+
+		if (const TOptional<FReplicationLatencyStamp> Stamp = FReplicationLatencyStamp::ReadFromUpdate(ComponentUpdate))
+		{
+			const uint64 LatencyMicroseconds = Stamp->GetMicrosecondsSinceSent(FDateTime::UtcNow().GetTicks());
+			NetDriver->SpatialMetrics->RecordReplicationLatency(TargetObject.GetClass(), LatencyMicroseconds);
+			UE_LOG(LogActorSystem, VeryVerbose, TEXT("Applied sampled update of component %d on %s %lluus after it was sent on frame %llu"),
+				   ComponentId, *TargetObject.GetName(), LatencyMicroseconds, Stamp->FrameNumber);
+		}
+	}
+
 	RepStateUpdateHelper RepStateHelper(Channel, TargetObject);
 
 	ComponentReader Reader(NetDriver, RepStateHelper.GetRefMap(), NetDriver->Connection->GetEventTracer());
@@ -1959,10 +2023,26 @@ void ActorSystem::SendComponentUpdates(UObject* Object, const FClassInfo& Info,
 		}
 	}
 
+	USpatialMetrics* SpatialMetrics = NetDriver->SpatialMetrics;
+	const bool bTrackBandwidth = SpatialMetrics != nullptr && SpatialMetrics->IsBandwidthAccountingEnabled();
+
 	for (int i = 0; i < ComponentUpdates.Num(); i++)
 	{
 		FWorkerComponentUpdate& Update = ComponentUpdates[i];
 
+		if (ReplicationLatencySampler.IsEnabled()
+			&& NetDriver->ClassInfoManager->GetCategoryByComponentId(Update.component_id) != SCHEMA_Invalid
+			&& ReplicationLatencySampler.ShouldStamp())
+		{
+			FReplicationLatencyStamp::Now().WriteToUpdate(Update.schema_type);
+		}
+
+		if (bTrackBandwidth)
+		{
+			SpatialMetrics->TrackComponentBandwidth(EBandwidthDirection::Sent, Update.component_id, Channel->Actor,
+													GetSerializedSize(Update.schema_type));
+		}
+
 		FSpatialGDKSpanId SpanId;
 		if (EventTracer != nullptr)
 		{
@@ -2086,6 +2166,15 @@ void ActorSystem::SendCreateEntityRequest(USpatialActorChannel& ActorChannel, ui
 	// If the Actor was loaded rather than dynamically spawned, associate it with its owning sublevel.
 	ComponentDatas.Add(SpatialGDK::ActorSystem::CreateLevelComponentData(*Actor, *NetDriver->GetWorld(), *NetDriver->ClassInfoManager));
 
+	if (NetDriver->SpatialMetrics != nullptr && NetDriver->SpatialMetrics->IsBandwidthAccountingEnabled())
+	{
+		for (FWorkerComponentData& ComponentData : ComponentDatas)
+		{
+			NetDriver->SpatialMetrics->TrackComponentBandwidth(EBandwidthDirection::Sent, ComponentData.component_id, Actor,
+															   GetSerializedSize(ComponentData.schema_type));
+		}
+	}
+
 	FSpatialGDKSpanId SpanId;
 	if (EventTracer != nullptr)
 	{
@@ -2327,12 +2416,13 @@ FString ActorSystem::GetObjectNameFromRepState(const FSpatialObjectRepState& Rep
 
 void ActorSystem::CreateEntityWithRetries(Worker_EntityId EntityId, FString EntityName, TArray<FWorkerComponentData> EntityComponents)
 {
+	const uint64 RequestSentCycles = FPlatformTime::Cycles64();
 	const Worker_RequestId RequestId =
 		NetDriver->Connection->SendCreateEntityRequest(CopyEntityComponentData(EntityComponents), &EntityId, RETRY_UNTIL_COMPLETE);
 
 	CreateEntityDelegate Delegate;
 
-	Delegate.BindLambda([this, EntityId, Name = MoveTemp(EntityName),
+	Delegate.BindLambda([this, EntityId, RequestSentCycles, Name = MoveTemp(EntityName),
 						 Components = MoveTemp(EntityComponents)](const Worker_CreateEntityResponseOp& Op) mutable {
 		switch (Op.status_code)
 		{
@@ -2341,6 +2431,10 @@ void ActorSystem::CreateEntityWithRetries(Worker_EntityId EntityId, FString Enti
 				   TEXT("Created entity. "
 						"Entity name: %s, entity id: %lld"),
 				   *Name, EntityId);
+			if (NetDriver->SpatialMetrics != nullptr)
+			{
+				NetDriver->SpatialMetrics->RecordLatencySince(ESpatialLatencyMetric::EntityCreationRoundTrip, RequestSentCycles);
+			}
 			DeleteEntityComponentData(Components);
 			break;
 		case WORKER_STATUS_CODE_TIMEOUT:
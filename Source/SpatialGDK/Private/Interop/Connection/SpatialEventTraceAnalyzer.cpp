@@ -0,0 +1,359 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Interop/Connection/SpatialEventTraceAnalyzer.h"
+
+#include "Interop/Connection/SpatialTraceEventDataBuilder.h"
+
+namespace SpatialGDK
+{
+namespace
+{
+// Guards against cycles of causes in malformed files, and against walking the whole trace for deeply merged spans.
+constexpr int32 MaxChainLength = 64;
+
+double GetPercentile(const TArray<double>& SortedValues, double Percentile)
+{
+	if (SortedValues.Num() == 0)
+	{
+		return 0.0;
+	}
+
+	const double Rank = FMath::Clamp(Percentile, 0.0, 100.0) / 100.0 * (SortedValues.Num() - 1);
+	return SortedValues[FMath::RoundToInt(Rank)];
+}
+
+double GetMicrosecondsBetween(const FDateTime& Start, const FDateTime& End)
+{
+	return (End - Start).GetTotalMicroseconds();
+}
+} // anonymous namespace
+
+FSpatialEventTraceAnalyzer::FSpanKey::FSpanKey(const TArray<uint8>& SpanId)
+{
+	FMemory::Memcpy(Bytes, SpanId.GetData(), FMath::Min<int32>(SpanId.Num(), sizeof(Bytes)));
+}
+
+TArray<FSpatialEventTraceAnalyzer::FChainDefinition> FSpatialEventTraceAnalyzer::GetDefaultChainDefinitions()
+{
+	return { { TEXT("rpc"), PUSH_RPC_EVENT_NAME, APPLY_RPC_EVENT_NAME },
+			 { TEXT("property_update"), PROPERTY_CHANGED_EVENT_NAME, RECEIVE_PROPERTY_UPDATE_EVENT_NAME },
+			 { TEXT("cross_server_rpc"), SEND_CROSS_SERVER_RPC_EVENT_NAME, APPLY_CROSS_SERVER_RPC_EVENT_NAME } };
+}
+
+FSpatialEventTraceAnalyzer::FSpatialEventTraceAnalyzer(TArray<FChainDefinition> InChainDefinitions, int32 InMaxSlowestChains,
+													   FTimespan InChainTimeout)
+	: ChainDefinitions(MoveTemp(InChainDefinitions))
+	, MaxKeptSlowestChains(FMath::Max(InMaxSlowestChains, 0))
+	, ChainTimeout(InChainTimeout)
+{
+	CompletedChains.ChainLatencies.SetNum(ChainDefinitions.Num());
+}
+
+TArray<FString> FSpatialEventTraceAnalyzer::AddFiles(const TArray<FTraceFile>& Files)
+{
+	struct FFileCursor
+	{
+		TUniquePtr<FSpatialEventTraceReader> Reader;
+		FSpatialEventTraceReader::FItem Item;
+		FName Worker;
+	};
+
+	TArray<FString> UnreadFiles;
+	TArray<FFileCursor> Cursors;
+	for (const FTraceFile& File : Files)
+	{
+		FFileCursor Cursor;
+		Cursor.Reader = MakeUnique<FSpatialEventTraceReader>();
+		Cursor.Worker = File.Worker;
+		if (!Cursor.Reader->Open(File.FilePath))
+		{
+			UnreadFiles.Add(File.FilePath);
+		}
+		else if (Cursor.Reader->ReadNextItem(Cursor.Item))
+		{
+			Cursors.Add(MoveTemp(Cursor));
+		}
+	}
+
+	// Each file is in write order, which is close to timestamp order, so always taking the earliest next item merges them.
+	const auto IsEarlier = [](const FFileCursor& A, const FFileCursor& B) {
+		return A.Item.Timestamp < B.Item.Timestamp;
+	};
+	Cursors.Heapify(IsEarlier);
+	while (Cursors.Num() > 0)
+	{
+		FFileCursor Cursor;
+		Cursors.HeapPop(Cursor, IsEarlier, /* bAllowShrinking */ false);
+		AddItem(Cursor.Item, Cursor.Worker);
+		if (Cursor.Reader->ReadNextItem(Cursor.Item))
+		{
+			Cursors.HeapPush(MoveTemp(Cursor), IsEarlier);
+		}
+	}
+
+	return UnreadFiles;
+}
+
+bool FSpatialEventTraceAnalyzer::AddFile(const FString& FilePath, FName Worker)
+{
+	return AddFiles({ { FilePath, Worker } }).Num() == 0;
+}
+
+void FSpatialEventTraceAnalyzer::AddItem(const FSpatialEventTraceReader::FItem& Item, FName Worker)
+{
+	const FSpanKey Key(Item.SpanId);
+	FSpanNode& Node = Nodes.FindOrAdd(Key);
+	LatestTimestamp = FMath::Max(LatestTimestamp, Item.Timestamp);
+
+	if (Item.Type == ESpatialTraceItemType::Span)
+	{
+		Node.Causes.Reserve(Node.Causes.Num() + Item.Causes.Num());
+		for (const TArray<uint8>& Cause : Item.Causes)
+		{
+			Node.Causes.Add(FSpanKey(Cause));
+		}
+		// Spans without events expire from when they were created.
+		if (Node.EventType.IsNone())
+		{
+			Node.Timestamp = Item.Timestamp;
+		}
+	}
+	else
+	{
+		const FName EventType(*Item.EventType);
+		Node.EventType = EventType;
+		Node.Worker = Worker;
+		Node.Timestamp = Item.Timestamp;
+
+		FWorkerState& WorkerState = Workers.FindOrAdd(Worker);
+		WorkerState.EventCounts.FindOrAdd(EventType)++;
+		WorkerState.NumEvents++;
+		WorkerState.FirstEventTime = FMath::Min(WorkerState.FirstEventTime, Item.Timestamp);
+		WorkerState.LastEventTime = FMath::Max(WorkerState.LastEventTime, Item.Timestamp);
+
+		for (int32 DefinitionIndex = 0; DefinitionIndex < ChainDefinitions.Num(); ++DefinitionIndex)
+		{
+			if (EventType == ChainDefinitions[DefinitionIndex].TerminalEventType)
+			{
+				PendingChains.Add({ Key, DefinitionIndex });
+			}
+		}
+	}
+
+	if (LatestTimestamp >= NextExpiryCheck)
+	{
+		DropExpiredSpans();
+		// Checking every half timeout keeps at most one and a half timeouts of spans.
+		NextExpiryCheck = LatestTimestamp + ChainTimeout * 0.5;
+	}
+}
+
+void FSpatialEventTraceAnalyzer::DropExpiredSpans()
+{
+	const auto IsExpired = [this](const FSpanNode& Node) {
+		return LatestTimestamp - Node.Timestamp > ChainTimeout;
+	};
+
+	TSet<FSpanKey> CompleteTerminals;
+	PendingChains.RemoveAll([this, &IsExpired, &CompleteTerminals](const FPendingChain& Pending) {
+		if (TryCompleteChain(Pending, CompletedChains))
+		{
+			CompleteTerminals.Add(Pending.Terminal);
+			return true;
+		}
+		if (IsExpired(Nodes.FindChecked(Pending.Terminal)))
+		{
+			CompletedChains.NumIncompleteChains++;
+			return true;
+		}
+		return false;
+	});
+
+	// A terminal event can end chains of several definitions, and is only dropped once all of them are.
+	for (const FPendingChain& Pending : PendingChains)
+	{
+		CompleteTerminals.Remove(Pending.Terminal);
+	}
+	for (const FSpanKey& Terminal : CompleteTerminals)
+	{
+		Nodes.Remove(Terminal);
+	}
+
+	for (auto It = Nodes.CreateIterator(); It; ++It)
+	{
+		if (IsExpired(It.Value()))
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+bool FSpatialEventTraceAnalyzer::TryCompleteChain(const FPendingChain& Pending, FChainResults& OutResults) const
+{
+	const FChainDefinition& Definition = ChainDefinitions[Pending.DefinitionIndex];
+
+	TSet<FSpanKey> Visited;
+	TArray<const FSpanNode*> Path;
+	if (!FindPathToRoot(Pending.Terminal, Definition.RootEventType, Visited, Path))
+	{
+		return false;
+	}
+
+	const FSpanNode* Terminal = Path[0];
+	const FSpanNode* Root = Path.Last();
+	const double LatencyMicroseconds = GetMicrosecondsBetween(Root->Timestamp, Terminal->Timestamp);
+	OutResults.ChainLatencies[Pending.DefinitionIndex].Add(LatencyMicroseconds);
+
+	// The path runs from the terminal back to the root, spans without events are skipped.
+	const FSpanNode* Next = nullptr;
+	for (const FSpanNode* Node : Path)
+	{
+		if (Node->EventType.IsNone())
+		{
+			continue;
+		}
+		if (Next != nullptr)
+		{
+			const FString HopName = FString::Printf(TEXT("%s -> %s"), *Node->EventType.ToString(), *Next->EventType.ToString());
+			OutResults.HopLatencies.FindOrAdd(HopName).Add(GetMicrosecondsBetween(Node->Timestamp, Next->Timestamp));
+		}
+		Next = Node;
+	}
+
+	// Only the steps of chains that can still be reported are copied, as the spans are dropped later.
+	TArray<FChain>& SlowestChains = OutResults.SlowestChains;
+	if (MaxKeptSlowestChains == 0
+		|| (SlowestChains.Num() == MaxKeptSlowestChains && LatencyMicroseconds <= SlowestChains.Last().LatencyMicroseconds))
+	{
+		return true;
+	}
+
+	int32 InsertIndex = SlowestChains.IndexOfByPredicate([LatencyMicroseconds](const FChain& Chain) {
+		return Chain.LatencyMicroseconds < LatencyMicroseconds;
+	});
+	if (InsertIndex == INDEX_NONE)
+	{
+		InsertIndex = SlowestChains.Num();
+	}
+	if (SlowestChains.Num() == MaxKeptSlowestChains)
+	{
+		SlowestChains.Pop(/* bAllowShrinking */ false);
+	}
+
+	FChain& Chain = SlowestChains.InsertDefaulted_GetRef(InsertIndex);
+	Chain.ChainName = Definition.Name;
+	Chain.LatencyMicroseconds = LatencyMicroseconds;
+	for (int32 PathIndex = Path.Num() - 1; PathIndex >= 0; --PathIndex)
+	{
+		if (!Path[PathIndex]->EventType.IsNone())
+		{
+			Chain.Steps.Add({ Path[PathIndex]->Worker, Path[PathIndex]->EventType, Path[PathIndex]->Timestamp });
+		}
+	}
+	return true;
+}
+
+bool FSpatialEventTraceAnalyzer::FindPathToRoot(const FSpanKey& Key, FName RootEventType, TSet<FSpanKey>& Visited,
+												TArray<const FSpanNode*>& OutPath) const
+{
+	if (OutPath.Num() >= MaxChainLength)
+	{
+		return false;
+	}
+
+	bool bAlreadyVisited = false;
+	Visited.Add(Key, &bAlreadyVisited);
+	if (bAlreadyVisited)
+	{
+		return false;
+	}
+
+	const FSpanNode* Node = Nodes.Find(Key);
+	if (Node == nullptr)
+	{
+		return false;
+	}
+
+	OutPath.Push(Node);
+	if (Node->EventType == RootEventType)
+	{
+		return true;
+	}
+
+	for (const FSpanKey& Cause : Node->Causes)
+	{
+		if (FindPathToRoot(Cause, RootEventType, Visited, OutPath))
+		{
+			return true;
+		}
+	}
+
+	OutPath.Pop(/* bAllowShrinking */ false);
+	return false;
+}
+
+FSpatialEventTraceAnalyzer::FLatencyStats FSpatialEventTraceAnalyzer::MakeLatencyStats(FString Name, TArray<double>& Values)
+{
+	Values.Sort();
+
+	FLatencyStats Stats;
+	Stats.Name = MoveTemp(Name);
+	Stats.Count = Values.Num();
+	Stats.P50Microseconds = GetPercentile(Values, 50.0);
+	Stats.P90Microseconds = GetPercentile(Values, 90.0);
+	Stats.P99Microseconds = GetPercentile(Values, 99.0);
+	Stats.MaxMicroseconds = GetPercentile(Values, 100.0);
+	return Stats;
+}
+
+FSpatialEventTraceAnalyzer::FResults FSpatialEventTraceAnalyzer::Analyze(int32 MaxSlowestChains) const
+{
+	// Chains still waiting for their root are completed on a copy, as more items may be added after analyzing.
+	FChainResults Chains = CompletedChains;
+	for (const FPendingChain& Pending : PendingChains)
+	{
+		if (!TryCompleteChain(Pending, Chains))
+		{
+			Chains.NumIncompleteChains++;
+		}
+	}
+
+	FResults Results;
+	Results.NumIncompleteChains = Chains.NumIncompleteChains;
+
+	for (int32 DefinitionIndex = 0; DefinitionIndex < ChainDefinitions.Num(); ++DefinitionIndex)
+	{
+		if (Chains.ChainLatencies[DefinitionIndex].Num() > 0)
+		{
+			Results.ChainLatencies.Add(
+				MakeLatencyStats(ChainDefinitions[DefinitionIndex].Name.ToString(), Chains.ChainLatencies[DefinitionIndex]));
+		}
+	}
+
+	for (auto& Pair : Chains.HopLatencies)
+	{
+		Results.HopLatencies.Add(MakeLatencyStats(Pair.Key, Pair.Value));
+	}
+	Results.HopLatencies.Sort([](const FLatencyStats& A, const FLatencyStats& B) {
+		return A.Name < B.Name;
+	});
+
+	for (const auto& Pair : Workers)
+	{
+		FWorkerThroughput& Throughput = Results.Workers.AddDefaulted_GetRef();
+		Throughput.Worker = Pair.Key;
+		Throughput.NumEvents = Pair.Value.NumEvents;
+		Throughput.EventCounts = Pair.Value.EventCounts;
+		Throughput.DurationSeconds = (Pair.Value.LastEventTime - Pair.Value.FirstEventTime).GetTotalSeconds();
+		Throughput.EventsPerSecond = Throughput.DurationSeconds > 0.0 ? Throughput.NumEvents / Throughput.DurationSeconds : 0.0;
+	}
+	Results.Workers.Sort([](const FWorkerThroughput& A, const FWorkerThroughput& B) {
+		return A.Worker.LexicalLess(B.Worker);
+	});
+
+	const int32 NumSlowest = FMath::Clamp(MaxSlowestChains, 0, Chains.SlowestChains.Num());
+	Results.SlowestChains.Append(Chains.SlowestChains.GetData(), NumSlowest);
+
+	return Results;
+}
+} // namespace SpatialGDK
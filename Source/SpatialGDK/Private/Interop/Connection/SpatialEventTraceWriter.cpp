@@ -0,0 +1,609 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Interop/Connection/SpatialEventTraceWriter.h"
+
+#include "Interop/Connection/SpatialEventTracer.h"
+#include "Interop/Connection/SpatialTraceEventDataBuilder.h"
+
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFile.h"
+#include "HAL/PlatformFilemanager.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/Paths.h"
+
+namespace SpatialGDK
+{
+namespace
+{
+constexpr uint32 MinRingBufferSize = 64 * 1024;
+constexpr int32 StagingBufferSize = 64 * 1024;
+constexpr float WriterWaitTimeMs = 10.0f;
+constexpr float FlushTimeoutSeconds = 5.0f;
+
+uint16 GetClampedStringLength(const char* String)
+{
+	return String != nullptr ? static_cast<uint16>(FMath::Min<SIZE_T>(FCStringAnsi::Strlen(String), MAX_uint16)) : 0;
+}
+
+// Writes fixed size values into a pre-sized record.
+class FRecordWriter
+{
+public:
+	explicit FRecordWriter(uint8* InCursor)
+		: Cursor(InCursor)
+	{
+	}
+
+	template <typename T>
+	void Write(T Value)
+	{
+		FMemory::Memcpy(Cursor, &Value, sizeof(T));
+		Cursor += sizeof(T);
+	}
+
+	void WriteBytes(const void* Bytes, uint32 Size)
+	{
+		if (Size > 0)
+		{
+			FMemory::Memcpy(Cursor, Bytes, Size);
+			Cursor += Size;
+		}
+	}
+
+	void WriteString(const char* String)
+	{
+		const uint16 Length = GetClampedStringLength(String);
+		Write(Length);
+		WriteBytes(String, Length);
+	}
+
+private:
+	uint8* Cursor;
+};
+
+// Reads values from a record, failing once the record is exhausted.
+class FRecordReader
+{
+public:
+	FRecordReader(const uint8* InCursor, uint32 InSize)
+		: Cursor(InCursor)
+		, End(InCursor + InSize)
+	{
+	}
+
+	template <typename T>
+	bool Read(T& OutValue)
+	{
+		if (Cursor + sizeof(T) > End)
+		{
+			return false;
+		}
+		FMemory::Memcpy(&OutValue, Cursor, sizeof(T));
+		Cursor += sizeof(T);
+		return true;
+	}
+
+	bool ReadBytes(TArray<uint8>& OutBytes, uint32 Size)
+	{
+		if (Cursor + Size > End)
+		{
+			return false;
+		}
+		OutBytes.SetNumUninitialized(Size);
+		FMemory::Memcpy(OutBytes.GetData(), Cursor, Size);
+		Cursor += Size;
+		return true;
+	}
+
+	bool ReadString(FString& OutString)
+	{
+		uint16 Length;
+		if (!Read(Length) || Cursor + Length > End)
+		{
+			return false;
+		}
+		const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Cursor), Length);
+		OutString = FString(Converted.Length(), Converted.Get());
+		Cursor += Length;
+		return true;
+	}
+
+private:
+	const uint8* Cursor;
+	const uint8* End;
+};
+} // anonymous namespace
+
+// ---- FEventTraceRingBuffer ----
+
+FEventTraceRingBuffer::FEventTraceRingBuffer(uint32 InCapacity)
+	: Capacity(FMath::RoundUpToPowerOfTwo(FMath::Max(InCapacity, MinRingBufferSize)))
+	, Mask(Capacity - 1)
+{
+	Storage.SetNumZeroed(Capacity / sizeof(uint64));
+	Data = reinterpret_cast<uint8*>(Storage.GetData());
+}
+
+uint8* FEventTraceRingBuffer::BeginWrite(uint32 Size, uint64& OutRecordPosition)
+{
+	const uint64 RecordSize = GetRecordSize(Size);
+	if (RecordSize > Capacity / 2)
+	{
+		return nullptr;
+	}
+
+	uint64 Position = WritePosition.load(std::memory_order_relaxed);
+	uint64 PaddingSize;
+	do
+	{
+		// Records are contiguous, so a record which would straddle the end of the buffer starts at the beginning instead.
+		const uint64 Offset = Position & Mask;
+		PaddingSize = Offset + RecordSize > Capacity ? Capacity - Offset : 0;
+		if (Position + PaddingSize + RecordSize - ReadPosition.load(std::memory_order_acquire) > Capacity)
+		{
+			return nullptr;
+		}
+	} while (!WritePosition.compare_exchange_weak(Position, Position + PaddingSize + RecordSize, std::memory_order_acq_rel,
+												  std::memory_order_relaxed));
+
+	if (PaddingSize > 0)
+	{
+		FPlatformAtomics::AtomicStore(GetHeader(Position), static_cast<int64>(PublishedBit | PaddingBit));
+	}
+
+	OutRecordPosition = Position + PaddingSize;
+	return Data + (OutRecordPosition & Mask) + HeaderSize;
+}
+
+void FEventTraceRingBuffer::EndWrite(uint64 RecordPosition, uint32 Size)
+{
+	FPlatformAtomics::AtomicStore(GetHeader(RecordPosition), static_cast<int64>(PublishedBit | Size));
+}
+
+// ---- FSpatialEventTraceWriter ----
+
+FSpatialEventTraceWriter::FSpatialEventTraceWriter(FParameters InParameters)
+	: Parameters(MoveTemp(InParameters))
+	, RingBuffer(Parameters.BufferSizeBytes)
+{
+	StagingBuffer.Reserve(StagingBufferSize);
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	if (!PlatformFile.CreateDirectoryTree(*Parameters.FolderPath))
+	{
+		UE_LOG(LogSpatialEventTracer, Error, TEXT("Error creating directory tree to %s"), *Parameters.FolderPath);
+		return;
+	}
+
+	if (!OpenNextFile())
+	{
+		return;
+	}
+
+	bIsValid = true;
+	WakeEvent = FPlatformProcess::GetSynchEventFromPool();
+	if (FPlatformProcess::SupportsMultithreading())
+	{
+		Thread = FRunnableThread::Create(this, TEXT("SpatialEventTraceWriter"), 0, TPri_BelowNormal);
+	}
+}
+
+FSpatialEventTraceWriter::~FSpatialEventTraceWriter()
+{
+	if (Thread != nullptr)
+	{
+		// Kill waits for the thread to finish, and Run drains anything left in the ring buffer before returning.
+		Thread->Kill(/* bShouldWait */ true);
+		delete Thread;
+		Thread = nullptr;
+	}
+	else if (bIsValid)
+	{
+		DrainRingBuffer();
+		FlushStagingBuffer();
+	}
+
+	if (WakeEvent != nullptr)
+	{
+		FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+		WakeEvent = nullptr;
+	}
+
+	const FStats Stats = GetStats();
+	if (Stats.ItemsDropped > 0 || Stats.ItemsDiscardedFileFull > 0)
+	{
+		UE_LOG(LogSpatialEventTracer, Warning,
+			   TEXT("Event trace writer dropped %llu items (%llu bytes) because its buffer was full, and discarded %llu items because "
+					"the trace file was full. %llu items were written."),
+			   Stats.ItemsDropped, Stats.BytesDropped, Stats.ItemsDiscardedFileFull, Stats.ItemsWritten);
+	}
+}
+
+void FSpatialEventTraceWriter::WriteItem(const Trace_Item& Item, const FSpatialTraceEventDataBuilder* EventData)
+{
+	if (!bIsValid)
+	{
+		return;
+	}
+
+	if (Item.item_type == TRACE_ITEM_TYPE_EVENT)
+	{
+		WriteEvent(Item.item.event, EventData);
+	}
+	else if (Item.item_type == TRACE_ITEM_TYPE_SPAN)
+	{
+		WriteSpan(Item.item.span);
+	}
+}
+
+void FSpatialEventTraceWriter::WriteEvent(const Trace_Event& Event, const FSpatialTraceEventDataBuilder* EventData)
+{
+	const int32 NumFields = EventData != nullptr ? FMath::Min<int32>(EventData->GetNumKeyValues(), MAX_uint16) : 0;
+
+	uint32 Size = sizeof(uint8) + sizeof(uint64) + TRACE_SPAN_ID_SIZE_BYTES;
+	Size += sizeof(uint16) + GetClampedStringLength(Event.type);
+	Size += sizeof(uint16) + GetClampedStringLength(Event.Message);
+	Size += sizeof(uint16);
+	for (int32 FieldIndex = 0; FieldIndex < NumFields; ++FieldIndex)
+	{
+		Size += sizeof(uint16) + GetClampedStringLength(EventData->GetKey(FieldIndex));
+		Size += sizeof(uint16) + GetClampedStringLength(EventData->GetValue(FieldIndex));
+	}
+
+	uint64 RecordPosition;
+	uint8* Record = RingBuffer.BeginWrite(Size, RecordPosition);
+	if (Record == nullptr)
+	{
+		CountDroppedItem(Size);
+		return;
+	}
+
+	FRecordWriter Writer(Record);
+	Writer.Write(static_cast<uint8>(ESpatialTraceItemType::Event));
+	Writer.Write(FPlatformTime::Cycles64());
+	Writer.WriteBytes(Event.span_id != nullptr ? Event.span_id : Trace_SpanId_Null(), TRACE_SPAN_ID_SIZE_BYTES);
+	Writer.WriteString(Event.type);
+	Writer.WriteString(Event.Message);
+	Writer.Write(static_cast<uint16>(NumFields));
+	for (int32 FieldIndex = 0; FieldIndex < NumFields; ++FieldIndex)
+	{
+		Writer.WriteString(EventData->GetKey(FieldIndex));
+		Writer.WriteString(EventData->GetValue(FieldIndex));
+	}
+
+	RingBuffer.EndWrite(RecordPosition, Size);
+	OnItemPublished();
+}
+
+void FSpatialEventTraceWriter::WriteSpan(const Trace_Span& Span)
+{
+	const uint16 NumCauses = static_cast<uint16>(FMath::Min<uint64>(Span.cause_count, MAX_uint16));
+	const uint32 Size = sizeof(uint8) + sizeof(uint64) + TRACE_SPAN_ID_SIZE_BYTES + sizeof(uint16) + NumCauses * TRACE_SPAN_ID_SIZE_BYTES;
+
+	uint64 RecordPosition;
+	uint8* Record = RingBuffer.BeginWrite(Size, RecordPosition);
+	if (Record == nullptr)
+	{
+		CountDroppedItem(Size);
+		return;
+	}
+
+	FRecordWriter Writer(Record);
+	Writer.Write(static_cast<uint8>(ESpatialTraceItemType::Span));
+	Writer.Write(FPlatformTime::Cycles64());
+	Writer.WriteBytes(Span.id != nullptr ? Span.id : Trace_SpanId_Null(), TRACE_SPAN_ID_SIZE_BYTES);
+	Writer.Write(NumCauses);
+	Writer.WriteBytes(Span.causes, NumCauses * TRACE_SPAN_ID_SIZE_BYTES);
+
+	RingBuffer.EndWrite(RecordPosition, Size);
+	OnItemPublished();
+}
+
+void FSpatialEventTraceWriter::OnItemPublished()
+{
+	if (Thread == nullptr)
+	{
+		// Without a writer thread, behave like a synchronous writer.
+		DrainRingBuffer();
+		if (bFlushOnWrite.load(std::memory_order_relaxed))
+		{
+			FlushStagingBuffer();
+		}
+	}
+	else if (bFlushOnWrite.load(std::memory_order_relaxed))
+	{
+		WakeEvent->Trigger();
+	}
+}
+
+void FSpatialEventTraceWriter::CountDroppedItem(uint32 Size)
+{
+	ItemsDropped.fetch_add(1, std::memory_order_relaxed);
+	BytesDropped.fetch_add(Size, std::memory_order_relaxed);
+
+	if (!bHasLoggedDrop.exchange(true, std::memory_order_relaxed))
+	{
+		UE_LOG(LogSpatialEventTracer, Warning,
+			   TEXT("Event trace buffer is full, trace items are being dropped. Consider increasing EventTracingWriteBufferSizeBytes."));
+	}
+}
+
+void FSpatialEventTraceWriter::Flush()
+{
+	if (!bIsValid)
+	{
+		return;
+	}
+
+	if (Thread == nullptr)
+	{
+		DrainRingBuffer();
+		FlushStagingBuffer();
+		return;
+	}
+
+	const uint64 FlushId = FlushesRequested.fetch_add(1, std::memory_order_acq_rel) + 1;
+	WakeEvent->Trigger();
+
+	const double TimeoutTime = FPlatformTime::Seconds() + FlushTimeoutSeconds;
+	while (FlushesCompleted.load(std::memory_order_acquire) < FlushId)
+	{
+		if (FPlatformTime::Seconds() > TimeoutTime)
+		{
+			UE_LOG(LogSpatialEventTracer, Warning, TEXT("Timed out waiting for the event trace writer to flush."));
+			return;
+		}
+		FPlatformProcess::Sleep(0.001f);
+	}
+}
+
+void FSpatialEventTraceWriter::SetFlushOnWrite(bool bValue)
+{
+	bFlushOnWrite.store(bValue, std::memory_order_relaxed);
+}
+
+FSpatialEventTraceWriter::FStats FSpatialEventTraceWriter::GetStats() const
+{
+	FStats Stats;
+	Stats.ItemsWritten = ItemsWritten.load(std::memory_order_relaxed);
+	Stats.BytesWritten = BytesWritten.load(std::memory_order_relaxed);
+	Stats.ItemsDropped = ItemsDropped.load(std::memory_order_relaxed);
+	Stats.BytesDropped = BytesDropped.load(std::memory_order_relaxed);
+	Stats.ItemsDiscardedFileFull = ItemsDiscardedFileFull.load(std::memory_order_relaxed);
+	return Stats;
+}
+
+uint32 FSpatialEventTraceWriter::Run()
+{
+	while (!bStopping.load(std::memory_order_relaxed))
+	{
+		WakeEvent->Wait(WriterWaitTimeMs);
+
+		const uint64 FlushId = FlushesRequested.load(std::memory_order_acquire);
+		DrainRingBuffer();
+
+		if (FlushId != FlushesCompleted.load(std::memory_order_relaxed) || bFlushOnWrite.load(std::memory_order_relaxed))
+		{
+			FlushStagingBuffer();
+			FlushesCompleted.store(FlushId, std::memory_order_release);
+		}
+		else if (StagingBuffer.Num() >= StagingBufferSize)
+		{
+			FlushStagingBuffer();
+		}
+	}
+
+	DrainRingBuffer();
+	FlushStagingBuffer();
+	FlushesCompleted.store(FlushesRequested.load(std::memory_order_acquire), std::memory_order_release);
+	return 0;
+}
+
+void FSpatialEventTraceWriter::Stop()
+{
+	bStopping.store(true, std::memory_order_relaxed);
+	if (WakeEvent != nullptr)
+	{
+		WakeEvent->Trigger();
+	}
+}
+
+void FSpatialEventTraceWriter::DrainRingBuffer()
+{
+	RingBuffer.ConsumePublished([this](const uint8* Payload, uint32 PayloadSize) {
+		WriteToFile(Payload, PayloadSize);
+	});
+}
+
+void FSpatialEventTraceWriter::WriteToFile(const uint8* Payload, uint32 PayloadSize)
+{
+	const int64 RecordSize = sizeof(uint32) + PayloadSize;
+	if (Parameters.MaxFileSizeBytes > 0 && CurrentFileSize + RecordSize > Parameters.MaxFileSizeBytes)
+	{
+		if (!Parameters.bRotateFiles || bFileFull || !OpenNextFile())
+		{
+			bFileFull = true;
+			ItemsDiscardedFileFull.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+	}
+
+	StagingBuffer.Append(reinterpret_cast<const uint8*>(&PayloadSize), sizeof(uint32));
+	StagingBuffer.Append(Payload, PayloadSize);
+	CurrentFileSize += RecordSize;
+
+	ItemsWritten.fetch_add(1, std::memory_order_relaxed);
+	BytesWritten.fetch_add(RecordSize, std::memory_order_relaxed);
+
+	if (StagingBuffer.Num() >= StagingBufferSize)
+	{
+		FlushStagingBuffer();
+	}
+}
+
+void FSpatialEventTraceWriter::FlushStagingBuffer()
+{
+	if (File.IsValid())
+	{
+		if (StagingBuffer.Num() > 0 && !File->Write(StagingBuffer.GetData(), StagingBuffer.Num()))
+		{
+			UE_LOG(LogSpatialEventTracer, Error, TEXT("Failed to write %d bytes of event trace data."), StagingBuffer.Num());
+		}
+		File->Flush();
+	}
+	StagingBuffer.Reset();
+}
+
+bool FSpatialEventTraceWriter::OpenNextFile()
+{
+	FlushStagingBuffer();
+	File.Reset();
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	++CurrentFileIndex;
+
+	auto GetFilePath = [this](int32 FileIndex) {
+		const FString FileName = Parameters.bRotateFiles
+									 ? FString::Printf(TEXT("%s-%d%s"), *Parameters.FileName, FileIndex, *Parameters.FileExtension)
+									 : FString::Printf(TEXT("%s%s"), *Parameters.FileName, *Parameters.FileExtension);
+		return FPaths::Combine(Parameters.FolderPath, FileName);
+	};
+
+	if (Parameters.bRotateFiles && Parameters.MaxFileCount > 0 && CurrentFileIndex >= Parameters.MaxFileCount)
+	{
+		PlatformFile.DeleteFile(*GetFilePath(CurrentFileIndex - Parameters.MaxFileCount));
+	}
+
+	const FString FilePath = GetFilePath(CurrentFileIndex);
+	File.Reset(PlatformFile.OpenWrite(*FilePath));
+	if (!File.IsValid())
+	{
+		UE_LOG(LogSpatialEventTracer, Error, TEXT("Failed to open event trace file %s"), *FilePath);
+		return false;
+	}
+
+	const int32 HeaderIndex = StagingBuffer.AddUninitialized(SpatialEventTraceFormat::FileHeaderSize);
+	FRecordWriter Writer(StagingBuffer.GetData() + HeaderIndex);
+	Writer.Write(SpatialEventTraceFormat::Magic);
+	Writer.Write(SpatialEventTraceFormat::Version);
+	Writer.Write(static_cast<uint16>(TRACE_SPAN_ID_SIZE_BYTES));
+	Writer.Write(FDateTime::UtcNow().GetTicks());
+	Writer.Write(FPlatformTime::Cycles64());
+	Writer.Write(FPlatformTime::GetSecondsPerCycle64());
+	CurrentFileSize = SpatialEventTraceFormat::FileHeaderSize;
+
+	return true;
+}
+
+// ---- FSpatialEventTraceReader ----
+
+bool FSpatialEventTraceReader::Open(const FString& FilePath)
+{
+	File.Reset(IFileManager::Get().CreateFileReader(*FilePath, FILEREAD_Silent));
+	if (!File.IsValid())
+	{
+		return false;
+	}
+
+	FileSize = File->TotalSize();
+	if (FileSize < SpatialEventTraceFormat::FileHeaderSize)
+	{
+		File.Reset();
+		return false;
+	}
+
+	uint8 Header[SpatialEventTraceFormat::FileHeaderSize];
+	File->Serialize(Header, SpatialEventTraceFormat::FileHeaderSize);
+
+	FRecordReader Reader(Header, SpatialEventTraceFormat::FileHeaderSize);
+	uint32 Magic;
+	uint16 Version;
+	if (File->IsError() || !Reader.Read(Magic) || Magic != SpatialEventTraceFormat::Magic || !Reader.Read(Version)
+		|| Version != SpatialEventTraceFormat::Version || !Reader.Read(SpanIdSize) || !Reader.Read(StartUtcTicks)
+		|| !Reader.Read(StartCycles) || !Reader.Read(SecondsPerCycle))
+	{
+		File.Reset();
+		return false;
+	}
+
+	return true;
+}
+
+bool FSpatialEventTraceReader::ReadNextItem(FItem& OutItem)
+{
+	if (!File.IsValid())
+	{
+		return false;
+	}
+
+	uint32 PayloadSize;
+	const int64 Remaining = FileSize - File->Tell();
+	if (Remaining < static_cast<int64>(sizeof(uint32)))
+	{
+		return false;
+	}
+	File->Serialize(&PayloadSize, sizeof(uint32));
+	// A size past the end of the file is a truncated or corrupt record, and mustn't size the buffer.
+	if (PayloadSize > Remaining - static_cast<int64>(sizeof(uint32)))
+	{
+		return false;
+	}
+
+	RecordBuffer.SetNumUninitialized(PayloadSize, /* bAllowShrinking */ false);
+	File->Serialize(RecordBuffer.GetData(), PayloadSize);
+	if (File->IsError())
+	{
+		return false;
+	}
+
+	FRecordReader Reader(RecordBuffer.GetData(), PayloadSize);
+
+	uint8 ItemType;
+	uint64 Cycles;
+	if (!Reader.Read(ItemType) || !Reader.Read(Cycles) || !Reader.ReadBytes(OutItem.SpanId, SpanIdSize))
+	{
+		return false;
+	}
+
+	OutItem.Type = static_cast<ESpatialTraceItemType>(ItemType);
+	const double SecondsSinceStart = (static_cast<int64>(Cycles) - static_cast<int64>(StartCycles)) * SecondsPerCycle;
+	OutItem.Timestamp = FDateTime(StartUtcTicks) + FTimespan::FromSeconds(SecondsSinceStart);
+	OutItem.Causes.Reset();
+	OutItem.EventType.Reset();
+	OutItem.Message.Reset();
+	OutItem.Data.Reset();
+
+	if (OutItem.Type == ESpatialTraceItemType::Span)
+	{
+		uint16 NumCauses;
+		if (!Reader.Read(NumCauses))
+		{
+			return false;
+		}
+		for (uint16 CauseIndex = 0; CauseIndex < NumCauses; ++CauseIndex)
+		{
+			if (!Reader.ReadBytes(OutItem.Causes.AddDefaulted_GetRef(), SpanIdSize))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	uint16 NumFields;
+	if (!Reader.ReadString(OutItem.EventType) || !Reader.ReadString(OutItem.Message) || !Reader.Read(NumFields))
+	{
+		return false;
+	}
+	for (uint16 FieldIndex = 0; FieldIndex < NumFields; ++FieldIndex)
+	{
+		TPair<FString, FString>& Field = OutItem.Data.AddDefaulted_GetRef();
+		if (!Reader.ReadString(Field.Key) || !Reader.ReadString(Field.Value))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+} // namespace SpatialGDK
@@ -2,62 +2,51 @@
 
 #include "Interop/Connection/SpatialEventTracer.h"
 
-#include "HAL/PlatformFile.h"
-#include "HAL/PlatformFilemanager.h"
 #include "SpatialGDKSettings.h"
 
 DEFINE_LOG_CATEGORY(LogSpatialEventTracer);
 
 namespace SpatialGDK
 {
+namespace
+{
+// Event data of the event currently being added on this thread, so that the trace callback can serialize its fields.
+thread_local const FSpatialTraceEventDataBuilder* EventDataBeingAdded = nullptr;
+} // anonymous namespace
+
 void SpatialEventTracer::TraceCallback(void* UserData, const Trace_Item* Item)
 {
 	SpatialEventTracer* EventTracer = static_cast<SpatialEventTracer*>(UserData);
 
-	Io_Stream* Stream = EventTracer->Stream.Get();
-	if (!ensure(Stream != nullptr))
+	FSpatialEventTraceWriter* Writer = EventTracer->Writer.Get();
+	if (!ensure(Writer != nullptr) || Item == nullptr)
 	{
 		return;
 	}
 
-	uint32_t ItemSize = Trace_GetSerializedItemSize(Item);
-	// Depends whether we are using rotating logs or single-log mode (where we track max size).
-	const bool bTrackFileSize = EventTracer->MaxFileSize != 0;
-	if (!bTrackFileSize || (EventTracer->BytesWrittenToStream + ItemSize <= EventTracer->MaxFileSize))
-	{
-		if (bTrackFileSize)
-		{
-			EventTracer->BytesWrittenToStream += ItemSize;
-		}
-
-		int Code = Trace_SerializeItemToStream(Stream, Item, ItemSize);
-		if (Code == WORKER_RESULT_FAILURE)
-		{
-			UE_LOG(LogSpatialEventTracer, Error, TEXT("Failed to serialize to with error code %d (%s)"), Code,
-				   ANSI_TO_TCHAR(Trace_GetLastError()));
-		}
-
-		if (FPlatformAtomics::AtomicRead_Relaxed(&EventTracer->FlushOnWriteAtomic))
-		{
-			if (Io_Stream_Flush(Stream) == -1)
-			{
-				UE_LOG(LogSpatialEventTracer, Error, TEXT("Failed to flush stream with error code %d (%s)"), Code,
-					   ANSI_TO_TCHAR(Io_Stream_GetLastError(Stream)));
-			}
-		}
-	}
-	else
+	const FSpatialTraceEventDataBuilder* EventData = nullptr;
+	if (Item->item_type == TRACE_ITEM_TYPE_EVENT && EventDataBeingAdded != nullptr
+		&& EventDataBeingAdded->GetEventData() == Item->item.event.data)
 	{
-		// Went over max capacity so stop writing here.
-		EventTracer->BytesWrittenToStream = EventTracer->MaxFileSize;
+		EventData = EventDataBeingAdded;
 	}
+
+	Writer->WriteItem(*Item, EventData);
+}
+
+void SpatialEventTracer::AddEvent(Trace_Event& Event, const FSpatialTraceEventDataBuilder& EventData) const
+{
+	EventDataBeingAdded = &EventData;
+	Trace_EventTracer_AddEvent(EventTracer, &Event);
+	EventDataBeingAdded = nullptr;
 }
 
 SpatialScopedActiveSpanId::SpatialScopedActiveSpanId(SpatialEventTracer* InEventTracer, const FSpatialGDKSpanId& InCurrentSpanId)
 	: CurrentSpanId(InCurrentSpanId)
 	, EventTracer(nullptr)
 {
-	if (InEventTracer == nullptr)
+	// The unsampled span ID is local to the GDK's sampler.
+	if (InEventTracer == nullptr || FSpatialTraceSampler::IsUnsampledSpanId(CurrentSpanId.GetConstId()))
 	{
 		return;
 	}
@@ -77,7 +66,6 @@ SpatialScopedActiveSpanId::~SpatialScopedActiveSpanId()
 SpatialEventTracer::SpatialEventTracer(const FString& WorkerId)
 {
 	const USpatialGDKSettings* Settings = GetDefault<USpatialGDKSettings>();
-	MaxFileSize = Settings->bEnableEventTracingRotatingLogs ? 0 : Settings->EventTracingSingleLogMaxFileSizeBytes; // 0 indicates unbounded.
 
 	Trace_EventTracer_Parameters Parameters = {};
 	Parameters.user_data = this;
@@ -106,6 +94,18 @@ SpatialEventTracer::SpatialEventTracer(const FString& WorkerId)
 		SpanSamplingProbabilities.Add({ AnsiStrings.Get(AnsiStrings.AddFString(EventName)), Pair.Value });
 	}
 
+	const auto ToSamplerBudget = [](const FEventTracingRateLimit& RateLimit) {
+		return FSpatialTraceSampler::FBudget{ RateLimit.EventsPerSecond, RateLimit.BurstSize };
+	};
+
+	Sampler.SetDefaultBudget(ToSamplerBudget(SamplingSettings->DefaultRateLimit));
+	for (const auto& Pair : SamplingSettings->EventRateLimitOverrides)
+	{
+		UE_LOG(LogSpatialEventTracer, Log, TEXT("Adding trace event rate limit. Event: %s Events per second: %f Burst size: %f."),
+			   *Pair.Key.ToString(), Pair.Value.EventsPerSecond, Pair.Value.BurstSize);
+		Sampler.SetCategoryBudget(Pair.Key, ToSamplerBudget(Pair.Value));
+	}
+
 	Parameters.span_sampling_parameters.probabilistic_parameters.default_probability = SamplingSettings->SamplingProbability;
 	Parameters.span_sampling_parameters.probabilistic_parameters.probability_count = SpanSamplingProbabilities.Num();
 	Parameters.span_sampling_parameters.probabilistic_parameters.probabilities = SpanSamplingProbabilities.GetData();
@@ -133,43 +133,27 @@ SpatialEventTracer::SpatialEventTracer(const FString& WorkerId)
 	FolderPath = EventTracePath;
 	const FString FolderWorkerPath = FPaths::Combine(EventTracePath, WorkerId);
 
-	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
-	const FString FileName = TEXT("gdk");
-	const FString FileExt = TEXT(".etlog");
-	if (PlatformFile.CreateDirectoryTree(*FolderWorkerPath))
-	{
-		UE_LOG(LogSpatialEventTracer, Log, TEXT("Capturing trace file%s to %s."),
-			   (Settings->bEnableEventTracingRotatingLogs) ? TEXT("s") : TEXT(""), *FolderWorkerPath);
-
-		if (Settings->bEnableEventTracingRotatingLogs)
-		{
-			FString FullFilePathPrefix = FString::Printf(TEXT("%s-"), *FPaths::Combine(FolderWorkerPath, FileName));
-			const FString FullFilePathSuffix = FileExt;
-
-			Io_RotatingFileStreamParameters FileParamters;
-			FileParamters.filename_prefix = AnsiStrings.Get(AnsiStrings.AddFString(FullFilePathPrefix));
-			FileParamters.filename_suffix = AnsiStrings.Get(AnsiStrings.AddFString(FullFilePathSuffix));
-			FileParamters.max_file_size_bytes = Settings->EventTracingRotatingLogsMaxFileSizeBytes;
-			FileParamters.max_file_count = Settings->EventTracingRotatingLogsMaxFileCount;
-			Stream.Reset(Io_CreateRotatingFileStream(&FileParamters));
-		}
-		else
-		{
-			const FString FullFilename = FString::Printf(TEXT("%s%s"), *FileName, *FileExt);
-			const FString FullFilePath = FPaths::Combine(FolderWorkerPath, FullFilename);
-			Stream.Reset(Io_CreateFileStream(TCHAR_TO_ANSI(*FullFilePath), Io_OpenMode::IO_OPEN_MODE_WRITE));
-		}
-	}
-	else
-	{
-		UE_LOG(LogSpatialEventTracer, Error, TEXT("Error creating directory tree to %s"), *FolderWorkerPath);
-	}
+	FSpatialEventTraceWriter::FParameters WriterParameters;
+	WriterParameters.FolderPath = FolderWorkerPath;
+	WriterParameters.FileName = SpatialEventTraceFormat::FileName;
+	WriterParameters.FileExtension = SpatialEventTraceFormat::FileExtension;
+	WriterParameters.BufferSizeBytes = Settings->EventTracingWriteBufferSizeBytes;
+	WriterParameters.bRotateFiles = Settings->bEnableEventTracingRotatingLogs;
+	WriterParameters.MaxFileSizeBytes = Settings->bEnableEventTracingRotatingLogs ? Settings->EventTracingRotatingLogsMaxFileSizeBytes
+																			   : Settings->EventTracingSingleLogMaxFileSizeBytes;
+	WriterParameters.MaxFileCount = Settings->EventTracingRotatingLogsMaxFileCount;
+
+	UE_LOG(LogSpatialEventTracer, Log, TEXT("Capturing trace file%s to %s."),
+		   (Settings->bEnableEventTracingRotatingLogs) ? TEXT("s") : TEXT(""), *FolderWorkerPath);
+
+	Writer = MakeUnique<FSpatialEventTraceWriter>(MoveTemp(WriterParameters));
 }
 
 SpatialEventTracer::~SpatialEventTracer()
 {
 	UE_LOG(LogSpatialEventTracer, Log, TEXT("Spatial event tracing disabled."));
 	Trace_EventTracer_Destroy(EventTracer);
+	Writer.Reset();
 }
 
 FUserSpanId SpatialEventTracer::GDKSpanIdToUserSpanId(const FSpatialGDKSpanId& SpanId)
@@ -345,7 +329,23 @@ FSpatialGDKSpanId SpatialEventTracer::PopLatentPropertyUpdateSpanId(const TWeakO
 
 void SpatialEventTracer::SetFlushOnWrite(bool bValue)
 {
-	FPlatformAtomics::AtomicStore_Relaxed(&FlushOnWriteAtomic, bValue ? 1 : 0);
+	if (Writer.IsValid())
+	{
+		Writer->SetFlushOnWrite(bValue);
+	}
+}
+
+void SpatialEventTracer::Flush()
+{
+	if (Writer.IsValid())
+	{
+		Writer->Flush();
+	}
+}
+
+FSpatialEventTraceWriter::FStats SpatialEventTracer::GetWriterStats() const
+{
+	return Writer.IsValid() ? Writer->GetStats() : FSpatialEventTraceWriter::FStats();
 }
 
 } // namespace SpatialGDK
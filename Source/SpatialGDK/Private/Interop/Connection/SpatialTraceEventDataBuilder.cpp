@@ -205,6 +205,7 @@ void FSpatialTraceEventDataBuilder::AddKeyValue(int32 KeyHandle, int32 ValueHand
 	const char* Key = StringConverter.Get(KeyHandle);
 	const char* Value = StringConverter.Get(ValueHandle);
 	Trace_EventData_AddStringFields(EventData, 1, &Key, &Value);
+	KeyValueHandles.Emplace(KeyHandle, ValueHandle);
 }
 
 const char* FSpatialTraceEventDataBuilder::AuthorityToString(Worker_Authority Authority)
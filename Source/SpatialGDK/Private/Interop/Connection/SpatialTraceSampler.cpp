@@ -0,0 +1,238 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Interop/Connection/SpatialTraceSampler.h"
+
+namespace SpatialGDK
+{
+namespace
+{
+const Trace_SpanIdType UnsampledSpanId[TRACE_SPAN_ID_SIZE_BYTES] = { 0xFF, 0xFF, 0xFF, 0xFF };
+static_assert(TRACE_SPAN_ID_SIZE_BYTES == 4, "Update UnsampledSpanId to the span ID size");
+
+double GetBurstSize(const FSpatialTraceSampler::FBudget& Budget)
+{
+	return Budget.BurstSize > 0.0 ? Budget.BurstSize : FMath::Max(Budget.TokensPerSecond, 1.0);
+}
+} // anonymous namespace
+
+void FSpatialTraceSampler::FTokenBucket::SetBudget(const FBudget& InBudget, double NowSeconds)
+{
+	Budget = InBudget;
+	const double Interval = Budget.TokensPerSecond > 0.0 ? 1.0 / Budget.TokensPerSecond : 0.0;
+	EmissionInterval.store(Interval, std::memory_order_relaxed);
+	BurstTolerance.store(GetBurstSize(Budget) * Interval, std::memory_order_relaxed);
+	// A full bucket.
+	TheoreticalArrivalSeconds.store(NowSeconds, std::memory_order_relaxed);
+}
+
+bool FSpatialTraceSampler::FTokenBucket::TryConsume(double NowSeconds)
+{
+	const double Interval = EmissionInterval.load(std::memory_order_relaxed);
+	if (Interval <= 0.0)
+	{
+		return true;
+	}
+
+	// Allow for rounding, so a burst of N tokens always fits N events.
+	const double Tolerance = BurstTolerance.load(std::memory_order_relaxed) + Interval * 1e-6;
+	double ArrivalSeconds = TheoreticalArrivalSeconds.load(std::memory_order_relaxed);
+	for (;;)
+	{
+		const double NewArrivalSeconds = FMath::Max(ArrivalSeconds, NowSeconds) + Interval;
+		if (NewArrivalSeconds - NowSeconds > Tolerance)
+		{
+			return false;
+		}
+		if (TheoreticalArrivalSeconds.compare_exchange_weak(ArrivalSeconds, NewArrivalSeconds, std::memory_order_relaxed))
+		{
+			return true;
+		}
+	}
+}
+
+FSpatialTraceSampler::FSpatialTraceSampler(const FBudget& InDefaultBudget, const TMap<FName, FBudget>& InCategoryBudgets)
+	: DefaultBudget(InDefaultBudget)
+{
+	const double NowSeconds = FPlatformTime::Seconds();
+	for (const auto& Pair : InCategoryBudgets)
+	{
+		FTokenBucket& Bucket = FindOrAddBucketLocked(Pair.Key, NowSeconds);
+		Bucket.bHasCategoryBudget = true;
+		Bucket.SetBudget(Pair.Value, NowSeconds);
+	}
+}
+
+bool FSpatialTraceSampler::ShouldSample(const char* EventType, const Trace_SpanIdType* Causes, int32 NumCauses)
+{
+	return ShouldSample(EventType, Causes, NumCauses, FPlatformTime::Seconds());
+}
+
+bool FSpatialTraceSampler::ShouldSample(const char* EventType, const Trace_SpanIdType* Causes, int32 NumCauses, double NowSeconds)
+{
+	FTokenBucket& Bucket = FindOrAddBucket(EventType, NowSeconds);
+
+	// Events only caused by dropped events are dropped with them, and count as rate limited.
+	const bool bSampled =
+		HasSampledCause(Causes, NumCauses) || (!HasUnsampledCause(Causes, NumCauses) && Bucket.TryConsume(NowSeconds));
+	(bSampled ? Bucket.NumSampled : Bucket.NumRateLimited).fetch_add(1, std::memory_order_relaxed);
+	return bSampled;
+}
+
+void FSpatialTraceSampler::SetDefaultBudget(const FBudget& Budget)
+{
+	const double NowSeconds = FPlatformTime::Seconds();
+
+	FWriteScopeLock Lock(BucketsLock);
+	DefaultBudget = Budget;
+	for (auto& Pair : Buckets)
+	{
+		if (!Pair.Value->bHasCategoryBudget)
+		{
+			Pair.Value->SetBudget(Budget, NowSeconds);
+		}
+	}
+}
+
+void FSpatialTraceSampler::SetCategoryBudget(FName Category, const FBudget& Budget)
+{
+	const double NowSeconds = FPlatformTime::Seconds();
+
+	FWriteScopeLock Lock(BucketsLock);
+	FTokenBucket& Bucket = FindOrAddBucketLocked(Category, NowSeconds);
+	Bucket.bHasCategoryBudget = true;
+	Bucket.SetBudget(Budget, NowSeconds);
+}
+
+void FSpatialTraceSampler::ClearCategoryBudget(FName Category)
+{
+	const double NowSeconds = FPlatformTime::Seconds();
+
+	FWriteScopeLock Lock(BucketsLock);
+	if (TUniquePtr<FTokenBucket>* Bucket = Buckets.Find(Category))
+	{
+		(*Bucket)->bHasCategoryBudget = false;
+		(*Bucket)->SetBudget(DefaultBudget, NowSeconds);
+	}
+}
+
+TArray<FSpatialTraceSampler::FCategoryStats> FSpatialTraceSampler::GetStats() const
+{
+	FReadScopeLock Lock(BucketsLock);
+
+	TArray<FCategoryStats> Stats;
+	Stats.Reserve(Buckets.Num());
+	for (const auto& Pair : Buckets)
+	{
+		Stats.Add({ Pair.Key, Pair.Value->Budget, Pair.Value->NumSampled.load(std::memory_order_relaxed),
+					Pair.Value->NumRateLimited.load(std::memory_order_relaxed) });
+	}
+	return Stats;
+}
+
+void FSpatialTraceSampler::ResetStats()
+{
+	FReadScopeLock Lock(BucketsLock);
+	for (auto& Pair : Buckets)
+	{
+		Pair.Value->NumSampled.store(0, std::memory_order_relaxed);
+		Pair.Value->NumRateLimited.store(0, std::memory_order_relaxed);
+	}
+}
+
+bool FSpatialTraceSampler::HasSampledCause(const Trace_SpanIdType* Causes, int32 NumCauses)
+{
+	if (Causes == nullptr)
+	{
+		return false;
+	}
+
+	for (int32 CauseIndex = 0; CauseIndex < NumCauses; ++CauseIndex)
+	{
+		const Trace_SpanIdType* Cause = Causes + CauseIndex * TRACE_SPAN_ID_SIZE_BYTES;
+		if (!Trace_SpanId_IsNull(Cause) && !IsUnsampledSpanId(Cause))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+bool FSpatialTraceSampler::HasUnsampledCause(const Trace_SpanIdType* Causes, int32 NumCauses)
+{
+	if (Causes == nullptr)
+	{
+		return false;
+	}
+
+	for (int32 CauseIndex = 0; CauseIndex < NumCauses; ++CauseIndex)
+	{
+		if (IsUnsampledSpanId(Causes + CauseIndex * TRACE_SPAN_ID_SIZE_BYTES))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+int32 FSpatialTraceSampler::CopySampledCauses(const Trace_SpanIdType* Causes, int32 NumCauses, FCauseArray& OutCauses)
+{
+	OutCauses.Reset();
+	for (int32 CauseIndex = 0; CauseIndex < NumCauses; ++CauseIndex)
+	{
+		const Trace_SpanIdType* Cause = Causes + CauseIndex * TRACE_SPAN_ID_SIZE_BYTES;
+		if (!IsUnsampledSpanId(Cause))
+		{
+			OutCauses.Append(Cause, TRACE_SPAN_ID_SIZE_BYTES);
+		}
+	}
+	return OutCauses.Num() / TRACE_SPAN_ID_SIZE_BYTES;
+}
+
+const Trace_SpanIdType* FSpatialTraceSampler::GetUnsampledSpanId()
+{
+	return UnsampledSpanId;
+}
+
+bool FSpatialTraceSampler::IsUnsampledSpanId(const Trace_SpanIdType* SpanId)
+{
+	return SpanId != nullptr && FMemory::Memcmp(SpanId, UnsampledSpanId, TRACE_SPAN_ID_SIZE_BYTES) == 0;
+}
+
+FSpatialTraceSampler::FTokenBucket& FSpatialTraceSampler::FindOrAddBucket(const char* EventType, double NowSeconds)
+{
+	{
+		FReadScopeLock Lock(BucketsLock);
+		// The pointer may have been reused for another event type built at runtime, so the name is checked too.
+		FTokenBucket* const* CachedBucket = BucketsByEventType.Find(EventType);
+		if (CachedBucket != nullptr && FCStringAnsi::Stricmp((*CachedBucket)->Category.GetData(), EventType) == 0)
+		{
+			return **CachedBucket;
+		}
+	}
+
+	const FName Category(EventType);
+
+	FWriteScopeLock Lock(BucketsLock);
+	FTokenBucket& Bucket = FindOrAddBucketLocked(Category, NowSeconds);
+	if (BucketsByEventType.Num() >= MaxCachedEventTypes)
+	{
+		BucketsByEventType.Reset();
+	}
+	BucketsByEventType.Add(EventType, &Bucket);
+	return Bucket;
+}
+
+FSpatialTraceSampler::FTokenBucket& FSpatialTraceSampler::FindOrAddBucketLocked(FName Category, double NowSeconds)
+{
+	if (TUniquePtr<FTokenBucket>* Bucket = Buckets.Find(Category))
+	{
+		return **Bucket;
+	}
+
+	FTokenBucket& Bucket = *Buckets.Add(Category, MakeUnique<FTokenBucket>());
+	const FString CategoryString = Category.ToString();
+	Bucket.Category.Append(TCHAR_TO_ANSI(*CategoryString), CategoryString.Len() + 1);
+	Bucket.SetBudget(DefaultBudget, NowSeconds);
+	return Bucket;
+}
+} // namespace SpatialGDK
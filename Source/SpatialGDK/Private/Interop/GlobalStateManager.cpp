@@ -77,7 +77,7 @@ void UGlobalStateManager::ApplyDeploymentMapData(Schema_ComponentData* Data)
 
 	DeploymentSessionId = Schema_GetInt32(ComponentObject, SpatialConstants::DEPLOYMENT_MAP_SESSION_ID);
 
-	SchemaHash = Schema_GetUint32(ComponentObject, SpatialConstants::DEPLOYMENT_MAP_SCHEMA_HASH);
+	SetSchemaHash(Schema_GetUint32(ComponentObject, SpatialConstants::DEPLOYMENT_MAP_SCHEMA_HASH));
 }
 
 void UGlobalStateManager::ApplySnapshotVersionData(Schema_ComponentData* Data)
@@ -166,7 +166,18 @@ void UGlobalStateManager::ApplyDeploymentMapUpdate(Schema_ComponentUpdate* Updat
 
 	if (Schema_GetObjectCount(ComponentObject, SpatialConstants::DEPLOYMENT_MAP_SCHEMA_HASH) == 1)
 	{
-		SchemaHash = Schema_GetUint32(ComponentObject, SpatialConstants::DEPLOYMENT_MAP_SCHEMA_HASH);
+		SetSchemaHash(Schema_GetUint32(ComponentObject, SpatialConstants::DEPLOYMENT_MAP_SCHEMA_HASH));
+	}
+}
+
+void UGlobalStateManager::SetSchemaHash(uint32 InSchemaHash)
+{
+	SchemaHash = InSchemaHash;
+
+	// Clients are disconnected on a mismatch instead, see USpatialNetDriver::ClientOnGSMQuerySuccess.
+	if (NetDriver != nullptr && NetDriver->IsServer() && NetDriver->ClassInfoManager != nullptr)
+	{
+		NetDriver->ClassInfoManager->OnDeploymentSchemaHashChanged(SchemaHash);
 	}
 }
 
@@ -291,7 +302,7 @@ void UGlobalStateManager::SetDeploymentState()
 
 	// Send the component update that we can now accept players.
 	UE_LOG(LogGlobalStateManager, Log, TEXT("Setting deployment URL to '%s'"), *CurrentWorld->URL.Map);
-	UE_LOG(LogGlobalStateManager, Log, TEXT("Setting schema hash to '%u'"), NetDriver->ClassInfoManager->SchemaDatabase->SchemaBundleHash);
+	UE_LOG(LogGlobalStateManager, Log, TEXT("Setting schema hash to '%u'"), NetDriver->ClassInfoManager->GetSchemaHash());
 
 	FWorkerComponentUpdate Update = {};
 	Update.component_id = SpatialConstants::DEPLOYMENT_MAP_COMPONENT_ID;
@@ -302,8 +313,7 @@ void UGlobalStateManager::SetDeploymentState()
 	AddStringToSchema(UpdateObject, SpatialConstants::DEPLOYMENT_MAP_MAP_URL_ID, CurrentWorld->RemovePIEPrefix(CurrentWorld->URL.Map));
 
 	// Set the schema hash for connecting workers to check against
-	Schema_AddUint32(UpdateObject, SpatialConstants::DEPLOYMENT_MAP_SCHEMA_HASH,
-					 NetDriver->ClassInfoManager->SchemaDatabase->SchemaBundleHash);
+	Schema_AddUint32(UpdateObject, SpatialConstants::DEPLOYMENT_MAP_SCHEMA_HASH, NetDriver->ClassInfoManager->GetSchemaHash());
 
 	// Component updates are short circuited so we set the updated state here and then send the component update.
 	NetDriver->Connection->SendComponentUpdate(GlobalStateManagerEntityId, &Update);
@@ -132,6 +132,31 @@ uint64 ClientServerRPCService::GetAckFromView(const Worker_EntityId EntityId, co
 	}
 }
 
+SIZE_T ClientServerRPCService::GetAllocatedSize() const
+{
+	SIZE_T Size = ClientServerDataStore.GetAllocatedSize() + LastAckedRPCIds.GetAllocatedSize() + LastSeenRPCIds.GetAllocatedSize()
+				  + OverflowedRPCs.GetAllocatedSize();
+
+	for (const auto& Pair : ClientServerDataStore)
+	{
+		const ClientServerEndpoints& Endpoints = Pair.Value;
+		Size += Endpoints.Client.ReliableRPCBuffer.GetAllocatedSize() + Endpoints.Client.UnreliableRPCBuffer.GetAllocatedSize()
+				+ Endpoints.Client.AlwaysWriteRPCBuffer.GetAllocatedSize() + Endpoints.Server.ReliableRPCBuffer.GetAllocatedSize()
+				+ Endpoints.Server.UnreliableRPCBuffer.GetAllocatedSize();
+	}
+
+	for (const auto& Pair : OverflowedRPCs)
+	{
+		Size += Pair.Value.GetAllocatedSize();
+		for (const PendingRPCPayload& Payload : Pair.Value)
+		{
+			Size += Payload.Payload.PayloadData.GetAllocatedSize();
+		}
+	}
+
+	return Size;
+}
+
 void ClientServerRPCService::SetEntityData(Worker_EntityId EntityId)
 {
 	for (const Worker_ComponentId ComponentId : SubView->GetView()[EntityId].Authority)
@@ -44,7 +44,7 @@ EPushRPCResult CrossServerRPCService::PushCrossServerRPC(Worker_EntityId EntityI
 		EndpointObject = Schema_GetComponentUpdateFields(RPCStore.GetOrCreateComponentUpdate(SenderEndpointId));
 	}
 
-	CrossServer::WriterState& SenderState = Endpoints->SenderState;
+	CrossServer::SlotWriterState& SenderState = Endpoints->SenderState;
 
 	TOptional<uint32> Slot = SenderState.Alloc.ReserveSlot();
 	if (!Slot)
@@ -66,12 +66,7 @@ EPushRPCResult CrossServerRPCService::PushCrossServerRPC(Worker_EntityId EntityI
 	Schema_ClearField(EndpointObject, Descriptor.LastSentRPCFieldId);
 	Schema_AddUint64(EndpointObject, Descriptor.LastSentRPCFieldId, SenderState.LastSentRPCId);
 
-	CrossServer::RPCKey RPCKey(Sender.Entity, NewRPCId);
-	CrossServer::SentRPCEntry Entry;
-	Entry.Target = Target;
-	Entry.SourceSlot = SlotIdx;
-
-	SenderState.Mailbox.Add(RPCKey, Entry);
+	SenderState.Mailbox.Add(SlotIdx, NewRPCId);
 
 	return EPushRPCResult::Success;
 }
@@ -247,7 +242,7 @@ void CrossServerRPCService::OnEndpointAuthorityGained(const Worker_EntityId Enti
 	case SpatialConstants::CROSS_SERVER_SENDER_ENDPOINT_COMPONENT_ID:
 	{
 		CrossServerEndpoint SenderEndpoint(Component.GetUnderlying());
-		CrossServer::WriterState& SenderState = CrossServerDataStore.FindChecked(EntityId).SenderState;
+		CrossServer::SlotWriterState& SenderState = CrossServerDataStore.FindChecked(EntityId).SenderState;
 		SenderState.LastSentRPCId = SenderEndpoint.ReliableRPCBuffer.LastSentRPCId;
 		for (int32 SlotIdx = 0; SlotIdx < SenderEndpoint.ReliableRPCBuffer.RingBuffer.Num(); ++SlotIdx)
 		{
@@ -257,13 +252,7 @@ void CrossServerRPCService::OnEndpointAuthorityGained(const Worker_EntityId Enti
 				const TOptional<CrossServerRPCInfo>& TargetRef = SenderEndpoint.ReliableRPCBuffer.Counterpart[SlotIdx];
 				check(TargetRef.IsSet());
 
-				CrossServer::RPCKey RPCKey(EntityId, TargetRef.GetValue().RPCId);
-
-				CrossServer::SentRPCEntry NewEntry;
-				NewEntry.Target = RPCTarget(TargetRef.GetValue());
-				NewEntry.SourceSlot = SlotIdx;
-
-				SenderState.Mailbox.Add(RPCKey, NewEntry);
+				SenderState.Mailbox.Add(SlotIdx, TargetRef.GetValue().RPCId);
 				SenderState.Alloc.Occupied[SlotIdx] = true;
 			}
 		}
@@ -386,76 +375,97 @@ void CrossServerRPCService::WriteCrossServerACKFor(Worker_EntityId Receiver, con
 
 void CrossServerRPCService::UpdateSentRPCsACKs(Worker_EntityId SenderId, const CrossServerEndpointACK& ACKComponent)
 {
+	CrossServer::SlotWriterState& SenderState = CrossServerDataStore.FindChecked(SenderId).SenderState;
+
+	bool bAnyACKedSlot = false;
+
 	for (int32 SlotIdx = 0; SlotIdx < ACKComponent.ACKArray.Num(); ++SlotIdx)
 	{
 		if (ACKComponent.ACKArray[SlotIdx])
 		{
 			const ACKItem& ACK = ACKComponent.ACKArray[SlotIdx].GetValue();
-
-			CrossServer::RPCKey RPCKey(ACK.Sender, ACK.RPCId);
-
-			CrossServer::WriterState& SenderState = CrossServerDataStore.FindChecked(SenderId).SenderState;
-			CrossServer::SentRPCEntry* SentRPC = SenderState.Mailbox.Find(RPCKey);
-			if (SentRPC != nullptr)
+			if (ACK.Sender != SenderId)
 			{
-				SenderState.Alloc.FreeSlot(SentRPC->SourceSlot);
-				SenderState.Mailbox.Remove(RPCKey);
+				continue;
+			}
 
-				EntityComponentId Pair(ACK.Sender, SpatialConstants::CROSS_SERVER_SENDER_ENDPOINT_COMPONENT_ID);
-				RPCStore.GetOrCreateComponentUpdate(Pair);
+			TOptional<uint32> SentSlot = SenderState.Mailbox.FindSlot(SenderState.Alloc.Occupied, ACK.RPCId);
+			if (SentSlot.IsSet())
+			{
+				SenderState.Alloc.FreeSlot(SentSlot.GetValue());
+				SenderState.Mailbox.Remove(SentSlot.GetValue());
+				bAnyACKedSlot = true;
 			}
 		}
 	}
+
+	if (bAnyACKedSlot)
+	{
+		EntityComponentId Pair(SenderId, SpatialConstants::CROSS_SERVER_SENDER_ENDPOINT_COMPONENT_ID);
+		RPCStore.GetOrCreateComponentUpdate(Pair);
+	}
 }
 
-void CrossServerRPCService::CleanupACKsFor(Worker_EntityId EndpointId, const CrossServerEndpoint& Receiver)
+namespace
 {
-	CrossServerEndpoints& Endpoint = CrossServerDataStore.FindChecked(EndpointId);
-	CrossServer::ReaderState& State = Endpoint.ReceiverACKState;
+bool IsRPCInRingBuffer(const RPCRingBuffer& Buffer, const CrossServer::RPCKey& RPCKey, int32 KnownSlot)
+{
+	auto IsRPCInSlot = [&Buffer, &RPCKey](int32 Slot) {
+		const TOptional<CrossServerRPCInfo>& Counterpart = Buffer.Counterpart[Slot];
+		return Buffer.RingBuffer[Slot].IsSet() && Counterpart.IsSet() && Counterpart->Entity == RPCKey.Get<0>()
+			   && Counterpart->RPCId == RPCKey.Get<1>();
+	};
 
-	if (State.RPCSlots.Num() > 0)
+	if (KnownSlot >= 0)
 	{
-		CrossServer::ReadRPCMap ACKSToClear = State.RPCSlots;
-		for (auto Iterator = ACKSToClear.CreateIterator(); Iterator; ++Iterator)
-		{
-			if (Iterator->Value.ACKSlot == -1)
-			{
-				Iterator.RemoveCurrent();
-			}
-		}
+		return IsRPCInSlot(KnownSlot);
+	}
 
-		if (ACKSToClear.Num() == 0)
+	// Slots restored on authority gain don't know where the RPC was received.
+	for (uint32 Slot = 0; Slot < RPCRingBufferUtils::GetRingBufferSize(ERPCType::CrossServer); ++Slot)
+	{
+		if (IsRPCInSlot(Slot))
 		{
-			return;
+			return true;
 		}
+	}
+	return false;
+}
+} // namespace
 
-		const RPCRingBuffer& Buffer = Receiver.ReliableRPCBuffer;
+void CrossServerRPCService::CleanupACKsFor(Worker_EntityId EndpointId, const CrossServerEndpoint& Receiver)
+{
+	CrossServerEndpoints& Endpoint = CrossServerDataStore.FindChecked(EndpointId);
+	CrossServer::ReaderState& State = Endpoint.ReceiverACKState;
 
-		for (uint32 Slot = 0; Slot < RPCRingBufferUtils::GetRingBufferSize(ERPCType::CrossServer); ++Slot)
-		{
-			const TOptional<RPCPayload>& Element = Buffer.RingBuffer[Slot];
-			if (Element.IsSet())
-			{
-				const TOptional<CrossServerRPCInfo>& Counterpart = Buffer.Counterpart[Slot];
-				Worker_EntityId CounterpartId = Counterpart.GetValue().Entity;
-				uint64 RPCId = Counterpart.GetValue().RPCId;
+	if (State.RPCSlots.Num() == 0)
+	{
+		return;
+	}
 
-				CrossServer::RPCKey RPCKey(CounterpartId, RPCId);
-				ACKSToClear.Remove(RPCKey);
-			}
-		}
+	const RPCRingBuffer& Buffer = Receiver.ReliableRPCBuffer;
 
-		EntityComponentId Pair(EndpointId, SpatialConstants::CROSS_SERVER_RECEIVER_ACK_ENDPOINT_COMPONENT_ID);
+	bool bAnyACKToClear = false;
 
-		for (auto const& SlotToClear : ACKSToClear)
+	for (auto Iterator = State.RPCSlots.CreateIterator(); Iterator; ++Iterator)
+	{
+		const CrossServer::RPCSlots& Slots = Iterator->Value;
+
+		// An ACK can be cleared once the sender has removed the RPC from its ring buffer.
+		if (Slots.ACKSlot == -1 || IsRPCInRingBuffer(Buffer, Iterator->Key, Slots.CounterpartSlot))
 		{
-			uint32 SlotIdx = SlotToClear.Value.ACKSlot;
-			State.RPCSlots.Remove(SlotToClear.Key);
+			continue;
+		}
 
-			RPCStore.GetOrCreateComponentUpdate(Pair);
+		State.ACKAlloc.FreeSlot(Slots.ACKSlot);
+		bAnyACKToClear = true;
+		Iterator.RemoveCurrent();
+	}
 
-			State.ACKAlloc.FreeSlot(SlotIdx);
-		}
+	if (bAnyACKToClear)
+	{
+		EntityComponentId Pair(EndpointId, SpatialConstants::CROSS_SERVER_RECEIVER_ACK_ENDPOINT_COMPONENT_ID);
+		RPCStore.GetOrCreateComponentUpdate(Pair);
 	}
 }
 
@@ -463,7 +473,7 @@ void CrossServerRPCService::FlushPendingClearedFields(TPair<EntityComponentId, P
 {
 	if (UpdateToSend.Key.ComponentId == SpatialConstants::CROSS_SERVER_SENDER_ENDPOINT_COMPONENT_ID)
 	{
-		CrossServer::WriterState& SenderState = CrossServerDataStore.FindChecked(UpdateToSend.Key.EntityId).SenderState;
+		CrossServer::SlotWriterState& SenderState = CrossServerDataStore.FindChecked(UpdateToSend.Key.EntityId).SenderState;
 		RPCRingBufferDescriptor Descriptor = RPCRingBufferUtils::GetRingBufferDescriptor(ERPCType::CrossServer);
 
 		SenderState.Alloc.ForeachClearedSlot([&](uint32 ToClear) {
@@ -122,6 +122,16 @@ void MulticastRPCService::ProcessChanges()
 	}
 }
 
+SIZE_T MulticastRPCService::GetAllocatedSize() const
+{
+	SIZE_T Size = MulticastDataStore.GetAllocatedSize() + LastSeenMulticastRPCIds.GetAllocatedSize();
+	for (const auto& Pair : MulticastDataStore)
+	{
+		Size += Pair.Value.MulticastRPCBuffer.GetAllocatedSize();
+	}
+	return Size;
+}
+
 void MulticastRPCService::EntityAdded(const Worker_EntityId EntityId)
 {
 	OnCheckoutMulticastRPCComponentOnEntity(EntityId);
@@ -21,6 +21,20 @@ void RPCService::AddRPCReceiver(FName ReceiverName, RPCReceiverDescription&& Des
 	Receivers.Add(ReceiverName, MoveTemp(Desc));
 }
 
+SIZE_T RPCService::GetAllocatedSize() const
+{
+	SIZE_T Size = Queues.GetAllocatedSize() + Receivers.GetAllocatedSize();
+	for (const auto& Pair : Queues)
+	{
+		Size += Pair.Value.Sender->GetAllocatedSize() + Pair.Value.Queue->GetAllocatedSize();
+	}
+	for (const auto& Pair : Receivers)
+	{
+		Size += Pair.Value.Receiver->GetAllocatedSize();
+	}
+	return Size;
+}
+
 bool RPCService::HasReceiverAuthority(const RPCReceiverDescription& Desc, const EntityViewElement& ViewElement)
 {
 	return Desc.Authority == NoAuthorityNeeded || ViewElement.Authority.Contains(Desc.Authority);
@@ -2,6 +2,8 @@
 
 #include "Interop/RPCs/RPCStore.h"
 
+#include "Utils/SchemaUtils.h"
+
 namespace SpatialGDK
 {
 Schema_ComponentUpdate* FRPCStore::GetOrCreateComponentUpdate(const EntityComponentId EntityComponentIdPair,
@@ -33,4 +35,22 @@ Schema_ComponentData* FRPCStore::GetOrCreateComponentData(const EntityComponentI
 	}
 	return *ComponentDataPtr;
 }
+
+SIZE_T FRPCStore::GetAllocatedSize() const
+{
+	SIZE_T Size = LastSentRPCIds.GetAllocatedSize() + PendingComponentUpdatesToSend.GetAllocatedSize()
+				  + PendingRPCsOnEntityCreation.GetAllocatedSize();
+
+	for (const auto& Pair : PendingComponentUpdatesToSend)
+	{
+		Size += Pair.Value.SpanIds.GetAllocatedSize() + GetSerializedSize(Pair.Value.Update);
+	}
+
+	for (const auto& Pair : PendingRPCsOnEntityCreation)
+	{
+		Size += GetSerializedSize(Pair.Value);
+	}
+
+	return Size;
+}
 } // namespace SpatialGDK
@@ -12,6 +12,7 @@
 #include "Utils/ObjectAllocUtils.h"
 #include "Utils/RepLayoutUtils.h"
 #include "Utils/SpatialLatencyTracer.h"
+#include "Utils/SpatialMetrics.h"
 
 #include "Algo/AnyOf.h"
 #include "Net/NetworkProfiler.h"
@@ -45,6 +46,13 @@ SpatialRPCService::SpatialRPCService(const FSubView& InActorAuthSubView, const F
 													  InActorAuthSubView, InWorkerEntitySubView, RPCStore));
 	}
 	IncomingRPCs.BindProcessingFunction(FProcessRPCDelegate::CreateRaw(this, &SpatialRPCService::ApplyRPC));
+	// Incoming RPCs blocked on unresolved references are retried as those references resolve (see OnObjectRefResolved),
+	// so the periodic retry only needs to look at queues whose head RPC may have expired.
+	for (ERPCType Type : { ERPCType::ClientReliable, ERPCType::ClientUnreliable, ERPCType::ServerReliable, ERPCType::ServerUnreliable,
+						   ERPCType::ServerAlwaysWrite, ERPCType::NetMulticast, ERPCType::CrossServer })
+	{
+		IncomingRPCs.SetRetryDeadline(Type, Settings->QueuedIncomingRPCWaitTime);
+	}
 	OutgoingRPCs.BindProcessingFunction(FProcessRPCDelegate::CreateRaw(this, &SpatialRPCService::SendRPC));
 }
 
@@ -58,6 +66,12 @@ void SpatialRPCService::AdvanceView()
 	}
 }
 
+SIZE_T SpatialRPCService::GetAllocatedSize() const
+{
+	return RPCStore.GetAllocatedSize() + ClientServerRPCs.GetAllocatedSize() + MulticastRPCs.GetAllocatedSize()
+		   + OutgoingRPCs.GetAllocatedSize() + IncomingRPCs.GetAllocatedSize();
+}
+
 void SpatialRPCService::ProcessChanges(const float NetDriverTime)
 {
 	ClientServerRPCs.ProcessChanges();
@@ -106,6 +120,11 @@ void SpatialRPCService::ProcessIncomingRPCs()
 	IncomingRPCs.ProcessRPCs();
 }
 
+void SpatialRPCService::OnObjectRefResolved(const FUnrealObjectRef& ObjectRef)
+{
+	IncomingRPCs.OnObjectRefResolved(ObjectRef);
+}
+
 void SpatialRPCService::ProcessOutgoingRPCs()
 {
 	OutgoingRPCs.ProcessRPCs();
@@ -116,6 +135,18 @@ EPushRPCResult SpatialRPCService::PushRPC(const Worker_EntityId EntityId, const
 {
 	const EntityRPCType EntityType = EntityRPCType(EntityId, Type);
 
+	FNetworkFrameProfiler* FrameProfiler = NetDriver != nullptr ? NetDriver->GetFrameProfiler() : nullptr;
+	if (FrameProfiler != nullptr)
+	{
+		FrameProfiler->AddCounter(ENetworkFrameCounter::RPCPayloadBytesSent, Payload.PayloadData.Num());
+	}
+
+	if (NetDriver != nullptr && NetDriver->SpatialMetrics != nullptr && Target != nullptr)
+	{
+		const UObject* Actor = Target->IsA<AActor>() ? Target : Target->GetTypedOuter<AActor>();
+		NetDriver->SpatialMetrics->TrackRPCBandwidth(EBandwidthDirection::Sent, Function, Actor, Payload.PayloadData.Num());
+	}
+
 	EPushRPCResult Result = EPushRPCResult::Success;
 	PendingRPCPayload PendingPayload = { Payload, SpanId };
 
@@ -356,7 +387,7 @@ RPCPayload SpatialRPCService::CreateRPCPayloadFromParams(UObject* TargetObject,
 {
 	const FRPCInfo& RPCInfo = NetDriver->ClassInfoManager->GetRPCInfo(TargetObject, Function);
 
-	FSpatialNetBitWriter PayloadWriter = PackRPCDataToSpatialNetBitWriter(Function, Params);
+	FSpatialNetBitWriterPool::FScopedWriter PayloadWriter = PackRPCDataToSpatialNetBitWriter(Function, Params);
 
 	TOptional<uint64> Id;
 	if (Type == ERPCType::CrossServer)
@@ -364,7 +395,7 @@ RPCPayload SpatialRPCService::CreateRPCPayloadFromParams(UObject* TargetObject,
 		Id = FMath::RandRange(static_cast<int64>(0), INT64_MAX);
 	}
 
-	return RPCPayload(TargetObjectRef.Offset, RPCInfo.Index, Id, TArray<uint8>(PayloadWriter.GetData(), PayloadWriter.GetNumBytes()));
+	return RPCPayload(TargetObjectRef.Offset, RPCInfo.Index, Id, TArray<uint8>(PayloadWriter->GetData(), PayloadWriter->GetNumBytes()));
 }
 
 EPushRPCResult SpatialRPCService::PushRPCInternal(const Worker_EntityId EntityId, const ERPCType Type, PendingRPCPayload Payload,
@@ -483,7 +514,8 @@ FRPCErrorInfo SpatialRPCService::ApplyRPC(const FPendingRPCParams& Params)
 	TWeakObjectPtr<UObject> TargetObjectWeakPtr = NetDriver->PackageMap->GetObjectFromUnrealObjectRef(Params.ObjectRef);
 	if (!TargetObjectWeakPtr.IsValid())
 	{
-		return FRPCErrorInfo{ nullptr, nullptr, ERPCResult::UnresolvedTargetObject, ERPCQueueProcessResult::StopProcessing };
+		return FRPCErrorInfo{ nullptr, nullptr, ERPCResult::UnresolvedTargetObject, ERPCQueueProcessResult::StopProcessing,
+							  { Params.ObjectRef } };
 	}
 
 	UObject* TargetObject = TargetObjectWeakPtr.Get();
@@ -636,9 +668,23 @@ FRPCErrorInfo SpatialRPCService::ApplyRPCInternal(UObject* TargetObject, UFuncti
 				ClientServerRPCs.IncrementAckedRPCID(PendingRPCParams.ObjectRef.Entity, RPCType);
 			}
 
+			if (NetDriver->SpatialMetrics != nullptr)
+			{
+				NetDriver->SpatialMetrics->TrackRPCBandwidth(EBandwidthDirection::Received, Function, Actor,
+															 PendingRPCParams.Payload.PayloadData.Num());
+
+				const double MicrosecondsSinceReceived = (FDateTime::Now() - PendingRPCParams.Timestamp).GetTotalMicroseconds();
+				NetDriver->SpatialMetrics->RecordLatency(ESpatialLatencyMetric::RPCReceiveToExecute,
+														 static_cast<uint64>(FMath::Max(MicrosecondsSinceReceived, 0.0)));
+			}
+
 			ErrorInfo.ErrorCode = ERPCResult::Success;
 		}
 	}
+	else
+	{
+		ErrorInfo.UnresolvedRefs = UnresolvedRefs.Array();
+	}
 
 	// Destroy the parameters.
 	// warning: highly dependent on UObject::ProcessEvent freeing of parms!
@@ -810,12 +856,12 @@ void SpatialRPCService::ProcessOrQueueOutgoingRPC(const FUnrealObjectRef& InTarg
 	OutgoingRPCs.ProcessRPCs();
 }
 
-FSpatialNetBitWriter SpatialRPCService::PackRPCDataToSpatialNetBitWriter(UFunction* Function, void* Parameters) const
+FSpatialNetBitWriterPool::FScopedWriter SpatialRPCService::PackRPCDataToSpatialNetBitWriter(UFunction* Function, void* Parameters) const
 {
-	FSpatialNetBitWriter PayloadWriter(NetDriver->PackageMap);
+	FSpatialNetBitWriterPool::FScopedWriter PayloadWriter = FSpatialNetBitWriterPool::Acquire(NetDriver->PackageMap, Function->ParmsSize);
 
 	const TSharedPtr<FRepLayout> RepLayout = NetDriver->GetFunctionRepLayout(Function);
-	RepLayout_SendPropertiesForRPC(*RepLayout, PayloadWriter, Parameters);
+	RepLayout_SendPropertiesForRPC(*RepLayout, *PayloadWriter, Parameters);
 
 	return PayloadWriter;
 }
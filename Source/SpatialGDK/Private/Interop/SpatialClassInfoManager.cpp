@@ -22,6 +22,7 @@
 #include "LoadBalancing/AbstractLBStrategy.h"
 #include "LoadBalancing/SpatialMultiWorkerSettings.h"
 #include "Utils/GDKPropertyMacros.h"
+#include "Utils/RepFieldDispatchTable.h"
 #include "Utils/RepLayoutUtils.h"
 
 DEFINE_LOG_CATEGORY(LogSpatialClassInfoManager);
@@ -52,9 +53,28 @@ bool USpatialClassInfoManager::TryInit(USpatialNetDriver* InNetDriver)
 		return false;
 	}
 
+	InternedObjectPaths.Init(SchemaDatabase->InternedObjectPaths);
+
 	return true;
 }
 
+uint32 USpatialClassInfoManager::GetSchemaHash() const
+{
+	return HashCombine(SchemaDatabase->SchemaBundleHash, InternedObjectPaths.GetHash());
+}
+
+void USpatialClassInfoManager::OnDeploymentSchemaHashChanged(uint32 DeploymentSchemaHash)
+{
+	const bool bSendIds = DeploymentSchemaHash == GetSchemaHash();
+	if (bSendIds != InternedObjectPaths.IsSendingIds())
+	{
+		UE_CLOG(!bSendIds, LogSpatialClassInfoManager, Warning,
+				TEXT("Deployment schema hash %u doesn't match this worker's %u, object references will be sent with full paths until it does."),
+				DeploymentSchemaHash, GetSchemaHash());
+		InternedObjectPaths.SetSendIds(bSendIds);
+	}
+}
+
 bool USpatialClassInfoManager::ValidateOrExit_IsSupportedClass(const FString& PathName)
 {
 	if (!IsSupportedClass(PathName))
@@ -227,6 +247,14 @@ void USpatialClassInfoManager::CreateClassInfoForClass(UClass* Class)
 		}
 	}
 
+	// Built here so applying component updates for the class only has to index into it.
+	if (TSharedPtr<FRepLayout> RepLayout = NetDriver->GetObjectClassRepLayout(Class))
+	{
+		Info->FieldDispatchTable = SpatialGDK::FRepFieldDispatchTable::Create(*RepLayout, FindGeneratedCodec(ClassPath),
+																				   GetDeltaArrayHandles(ClassPath),
+																				   GetQuantizedProperties(ClassPath));
+	}
+
 	if (bIsActorClass)
 	{
 		FinishConstructingActorClassInfo(ClassPath, Info);
@@ -317,6 +345,62 @@ void USpatialClassInfoManager::FinishConstructingSubobjectClassInfo(const FStrin
 	}
 }
 
+const SpatialGDK::FGeneratedClassCodec* USpatialClassInfoManager::FindGeneratedCodec(const FString& ClassPath) const
+{
+	const SpatialGDK::FGeneratedClassCodec* Codec = SpatialGDK::FGeneratedCodecRegistry::Get().Find(ClassPath);
+	if (Codec == nullptr)
+	{
+		return nullptr;
+	}
+
+	uint32 RepFieldsHash = 0;
+	if (const FActorSchemaData* ActorSchemaData = SchemaDatabase->ActorClassPathToSchema.Find(ClassPath))
+	{
+		RepFieldsHash = ActorSchemaData->RepFieldsHash;
+	}
+	else if (const FSubobjectSchemaData* SubobjectSchemaData = SchemaDatabase->SubobjectClassPathToSchema.Find(ClassPath))
+	{
+		RepFieldsHash = SubobjectSchemaData->RepFieldsHash;
+	}
+
+	if (RepFieldsHash == 0 || Codec->RepFieldsHash != RepFieldsHash)
+	{
+		UE_LOG(LogSpatialClassInfoManager, Warning,
+			   TEXT("Generated codec for %s was generated from different schema (codec hash: %u, schema hash: %u). Its properties will be "
+					"replicated through reflection until codecs are regenerated with the schema."),
+			   *ClassPath, Codec->RepFieldsHash, RepFieldsHash);
+		return nullptr;
+	}
+
+	return Codec;
+}
+
+TArrayView<const uint32> USpatialClassInfoManager::GetDeltaArrayHandles(const FString& ClassPath) const
+{
+	if (const FActorSchemaData* ActorSchemaData = SchemaDatabase->ActorClassPathToSchema.Find(ClassPath))
+	{
+		return ActorSchemaData->DeltaArrayHandles;
+	}
+	if (const FSubobjectSchemaData* SubobjectSchemaData = SchemaDatabase->SubobjectClassPathToSchema.Find(ClassPath))
+	{
+		return SubobjectSchemaData->DeltaArrayHandles;
+	}
+	return TArrayView<const uint32>();
+}
+
+TArrayView<const FQuantizedPropertySchemaData> USpatialClassInfoManager::GetQuantizedProperties(const FString& ClassPath) const
+{
+	if (const FActorSchemaData* ActorSchemaData = SchemaDatabase->ActorClassPathToSchema.Find(ClassPath))
+	{
+		return ActorSchemaData->QuantizedProperties;
+	}
+	if (const FSubobjectSchemaData* SubobjectSchemaData = SchemaDatabase->SubobjectClassPathToSchema.Find(ClassPath))
+	{
+		return SubobjectSchemaData->QuantizedProperties;
+	}
+	return TArrayView<const FQuantizedPropertySchemaData>();
+}
+
 bool USpatialClassInfoManager::IsComponentIdForTypeValid(const Worker_ComponentId ComponentId, const ESchemaComponentType Type) const
 {
 	// If handover is inactive, mark server only components as invalid.
@@ -349,6 +433,28 @@ const FClassInfo& USpatialClassInfoManager::GetOrCreateClassInfoByClass(UClass*
 	return ClassInfoMap[Class].Get();
 }
 
+const SpatialGDK::FRepFieldDispatchTable& USpatialClassInfoManager::GetFieldDispatchTable(UClass* Class, const FRepLayout& RepLayout)
+{
+	const FClassInfo& Info = GetOrCreateClassInfoByClass(Class);
+	if (LIKELY(Info.FieldDispatchTable.IsValid() && Info.FieldDispatchTable->Num() == RepLayout.BaseHandleToCmdIndex.Num()))
+	{
+		return *Info.FieldDispatchTable;
+	}
+
+	// The replicator's layout should be the one the class info was built from, this only guards against it being rebuilt since.
+	// Replacing the class's table means it is only rebuilt, and warned about, once per layout.
+	UE_LOG(LogSpatialClassInfoManager, Warning, TEXT("Field dispatch table for %s doesn't match its RepLayout, rebuilding it."),
+		   *GetNameSafe(Class));
+
+	FString ClassPath = Class->GetPathName();
+	GEngine->NetworkRemapPath(NetDriver->GetSpatialOSNetConnection(), ClassPath, false /*bIsReading*/);
+
+	TSharedRef<FClassInfo>& MutableInfo = ClassInfoMap[Class];
+	MutableInfo->FieldDispatchTable = SpatialGDK::FRepFieldDispatchTable::Create(
+		RepLayout, FindGeneratedCodec(ClassPath), GetDeltaArrayHandles(ClassPath), GetQuantizedProperties(ClassPath));
+	return *MutableInfo->FieldDispatchTable;
+}
+
 const FClassInfo& USpatialClassInfoManager::GetOrCreateClassInfoByObject(UObject* Object)
 {
 	if (AActor* Actor = Cast<AActor>(Object))
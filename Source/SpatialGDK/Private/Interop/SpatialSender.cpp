@@ -125,6 +125,7 @@ void USpatialSender::SendAuthorityIntentUpdate(const AActor& InActor, VirtualWor
 	}
 
 	AuthorityIntentComponent->VirtualWorkerId = NewAuthoritativeVirtualWorkerId;
+	AuthorityIntentComponent->ChangeTimeTicks = FDateTime::UtcNow().GetTicks();
 	UE_LOG(LogSpatialSender, Log,
 		   TEXT("(%s) Sending AuthorityIntent update for entity id %d. Virtual worker '%d' should become authoritative over %s"),
 		   *NetDriver->Connection->GetWorkerId(), EntityId, NewAuthoritativeVirtualWorkerId, *GetNameSafe(&InActor));
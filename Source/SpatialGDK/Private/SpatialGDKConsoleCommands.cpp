@@ -3,7 +3,11 @@
 #include "SpatialGDKConsoleCommands.h"
 
 #include "Engine/Engine.h"
+#include "EngineClasses/SpatialNetDriver.h"
+#include "Interop/Connection/SpatialEventTracer.h"
+#include "Interop/Connection/SpatialWorkerConnection.h"
 #include "SpatialConstants.h"
+#include "Utils/SpatialMemoryReport.h"
 
 DEFINE_LOG_CATEGORY(LogSpatialGDKConsoleCommands)
 
@@ -30,7 +34,129 @@ void ConsoleCommand_ConnectToLocator(const TArray<FString>& Args, UWorld* World)
 	GEngine->Browse(WorldContext, URL, Error);
 }
 
+namespace
+{
+SpatialGDK::SpatialEventTracer* GetEventTracer(UWorld* World)
+{
+	const USpatialNetDriver* NetDriver = World != nullptr ? Cast<USpatialNetDriver>(World->GetNetDriver()) : nullptr;
+	if (NetDriver == nullptr || NetDriver->Connection == nullptr || NetDriver->Connection->GetEventTracer() == nullptr)
+	{
+		UE_LOG(LogSpatialGDKConsoleCommands, Log, TEXT("Event tracing is not enabled for this world."));
+		return nullptr;
+	}
+	return NetDriver->Connection->GetEventTracer();
+}
+} // anonymous namespace
+
+void ConsoleCommand_SetEventTracingRateLimit(const TArray<FString>& Args, UWorld* World)
+{
+	if (Args.Num() < 2 || Args.Num() > 3)
+	{
+		UE_LOG(LogSpatialGDKConsoleCommands, Log,
+			   TEXT("ConsoleCommand_SetEventTracingRateLimit takes 2 or 3 arguments (eventType|default, eventsPerSecond, [burstSize]). "
+					"%d given."),
+			   Args.Num());
+		return;
+	}
+
+	SpatialGDK::SpatialEventTracer* EventTracer = GetEventTracer(World);
+	if (EventTracer == nullptr)
+	{
+		return;
+	}
+
+	SpatialGDK::FSpatialTraceSampler::FBudget Budget;
+	Budget.TokensPerSecond = FCString::Atod(*Args[1]);
+	Budget.BurstSize = Args.Num() == 3 ? FCString::Atod(*Args[2]) : 0.0;
+
+	if (Args[0].Equals(TEXT("default"), ESearchCase::IgnoreCase))
+	{
+		EventTracer->GetSampler().SetDefaultBudget(Budget);
+	}
+	else
+	{
+		EventTracer->GetSampler().SetCategoryBudget(FName(*Args[0]), Budget);
+	}
+}
+
+void ConsoleCommand_ClearEventTracingRateLimit(const TArray<FString>& Args, UWorld* World)
+{
+	if (Args.Num() != 1)
+	{
+		UE_LOG(LogSpatialGDKConsoleCommands, Log,
+			   TEXT("ConsoleCommand_ClearEventTracingRateLimit takes 1 argument (eventType). %d given."), Args.Num());
+		return;
+	}
+
+	if (SpatialGDK::SpatialEventTracer* EventTracer = GetEventTracer(World))
+	{
+		EventTracer->GetSampler().ClearCategoryBudget(FName(*Args[0]));
+	}
+}
+
+void ConsoleCommand_DumpEventTracingSampling(const TArray<FString>& Args, UWorld* World)
+{
+	SpatialGDK::SpatialEventTracer* EventTracer = GetEventTracer(World);
+	if (EventTracer == nullptr)
+	{
+		return;
+	}
+
+	TArray<SpatialGDK::FSpatialTraceSampler::FCategoryStats> Stats = EventTracer->GetSampler().GetStats();
+	Stats.Sort([](const SpatialGDK::FSpatialTraceSampler::FCategoryStats& A, const SpatialGDK::FSpatialTraceSampler::FCategoryStats& B) {
+		return A.NumSampled + A.NumRateLimited > B.NumSampled + B.NumRateLimited;
+	});
+
+	for (const SpatialGDK::FSpatialTraceSampler::FCategoryStats& CategoryStats : Stats)
+	{
+		UE_LOG(LogSpatialGDKConsoleCommands, Log, TEXT("%s: sampled %llu, rate limited %llu, %.1f events/s, burst %.1f"),
+			   *CategoryStats.Category.ToString(), CategoryStats.NumSampled, CategoryStats.NumRateLimited,
+			   CategoryStats.Budget.TokensPerSecond, CategoryStats.Budget.BurstSize);
+	}
+
+	const SpatialGDK::FSpatialEventTraceWriter::FStats WriterStats = EventTracer->GetWriterStats();
+	UE_LOG(LogSpatialGDKConsoleCommands, Log, TEXT("Trace writer: written %llu (%llu bytes), dropped %llu (%llu bytes)"),
+		   WriterStats.ItemsWritten, WriterStats.BytesWritten, WriterStats.ItemsDropped, WriterStats.BytesDropped);
+
+	if (Args.Num() == 1 && Args[0].Equals(TEXT("reset"), ESearchCase::IgnoreCase))
+	{
+		EventTracer->GetSampler().ResetStats();
+	}
+}
+
+void ConsoleCommand_DumpMemory(const TArray<FString>& Args, UWorld* World)
+{
+	const USpatialNetDriver* NetDriver = World != nullptr ? Cast<USpatialNetDriver>(World->GetNetDriver()) : nullptr;
+	if (NetDriver == nullptr)
+	{
+		UE_LOG(LogSpatialGDKConsoleCommands, Log, TEXT("There is no Spatial net driver for this world."));
+		return;
+	}
+
+	constexpr int32 DefaultMaxComponents = 20;
+	const int32 MaxComponents = Args.Num() == 1 ? FCString::Atoi(*Args[0]) : DefaultMaxComponents;
+
+	SpatialGDK::FSpatialMemoryReport::Gather(*NetDriver).Dump(*GLog, MaxComponents);
+}
+
 FAutoConsoleCommandWithWorldAndArgs ConnectToLocatorCommand =
 	FAutoConsoleCommandWithWorldAndArgs(TEXT("ConnectToLocator"), TEXT("Usage: ConnectToLocator <login> <playerToken>"),
 										FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&ConsoleCommand_ConnectToLocator));
+
+FAutoConsoleCommandWithWorldAndArgs SetEventTracingRateLimitCommand =
+	FAutoConsoleCommandWithWorldAndArgs(TEXT("SpatialEventTracing.SetRateLimit"),
+										TEXT("Usage: SpatialEventTracing.SetRateLimit <eventType|default> <eventsPerSecond> [burstSize]"),
+										FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&ConsoleCommand_SetEventTracingRateLimit));
+
+FAutoConsoleCommandWithWorldAndArgs ClearEventTracingRateLimitCommand = FAutoConsoleCommandWithWorldAndArgs(
+	TEXT("SpatialEventTracing.ClearRateLimit"), TEXT("Usage: SpatialEventTracing.ClearRateLimit <eventType>"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&ConsoleCommand_ClearEventTracingRateLimit));
+
+FAutoConsoleCommandWithWorldAndArgs DumpEventTracingSamplingCommand = FAutoConsoleCommandWithWorldAndArgs(
+	TEXT("SpatialEventTracing.DumpSampling"), TEXT("Usage: SpatialEventTracing.DumpSampling [reset]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&ConsoleCommand_DumpEventTracingSampling));
+
+FAutoConsoleCommandWithWorldAndArgs DumpMemoryCommand =
+	FAutoConsoleCommandWithWorldAndArgs(TEXT("Spatial.DumpMemory"), TEXT("Usage: Spatial.DumpMemory [maxComponents]"),
+										FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&ConsoleCommand_DumpMemory));
 } // namespace SpatialGDKConsoleCommands
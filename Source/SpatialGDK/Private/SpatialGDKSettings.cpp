@@ -27,6 +27,7 @@ DEFINE_LOG_CATEGORY(LogSpatialGDKSettings);
 namespace
 {
 constexpr int32 DefaultEventTracingFileSize = 256 * 1024 * 1024; // 256mb
+constexpr uint32 DefaultEventTracingWriteBufferSize = 4 * 1024 * 1024; // 4mb
 
 void CheckCmdLineOverrideBool(const TCHAR* CommandLine, const TCHAR* Parameter, const TCHAR* PrettyName, bool& bOutValue)
 {
@@ -194,6 +195,7 @@ USpatialGDKSettings::USpatialGDKSettings(const FObjectInitializer& ObjectInitial
 	, bEnableMetricsDisplay(false)
 	, MetricsReportRate(2.0f)
 	, bUseFrameTimeAsLoad(false)
+	, ReplicationLatencySampleRate(0.0f)
 	, bBatchSpatialPositionUpdates(false)
 	, MaxDynamicallyAttachedSubobjectsPerClass(3)
 	, ServicesRegion(EServicesRegion::Default)
@@ -202,6 +204,11 @@ USpatialGDKSettings::USpatialGDKSettings(const FObjectInitializer& ObjectInitial
 	, CloudWorkerLogLevel(WorkerLogLevel)
 	, bEnableMultiWorker(true)
 	, DefaultRPCRingBufferSize(32)
+	, bEnableAdaptiveRPCRingBufferCapacity(false)
+	, MinAdaptiveRPCRingBufferSize(4)
+	, RPCACKBatchSize(1)
+	, RPCACKMaxDelayMs(0)
+	, RPCACKSenderCapacityRatio(0.5f)
 	, CrossServerRPCImplementation(ECrossServerRPCImplementation::SpatialCommand)
 	// TODO - UNR 2514 - These defaults are not necessarily optimal - readdress when we have better data
 	, bTcpNoDelay(false)
@@ -230,6 +237,7 @@ USpatialGDKSettings::USpatialGDKSettings(const FObjectInitializer& ObjectInitial
 	, bEnableEventTracingRotatingLogs(false)
 	, EventTracingRotatingLogsMaxFileSizeBytes(DefaultEventTracingFileSize)
 	, EventTracingRotatingLogsMaxFileCount(256)
+	, EventTracingWriteBufferSizeBytes(DefaultEventTracingWriteBufferSize)
 	, bEnableAlwaysWriteRPCs(false)
 	, bEnableInitialOnlyReplicationCondition(false)
 {
@@ -2,6 +2,7 @@
 
 #include "SpatialView/ComponentData.h"
 #include "SpatialView/ComponentUpdate.h"
+#include "Utils/ReplicationLatencyStamp.h"
 
 namespace SpatialGDK
 {
@@ -19,7 +20,9 @@ ComponentData::ComponentData(OwningComponentDataPtr Data, Worker_ComponentId Id)
 
 ComponentData ComponentData::CreateCopy(const Schema_ComponentData* Data, Worker_ComponentId Id)
 {
-	return ComponentData(OwningComponentDataPtr(Schema_CopyComponentData(Data)), Id);
+	Schema_ComponentData* Copy = Schema_CopyComponentData(Data);
+	FReplicationLatencyStamp::ClearFromData(Copy);
+	return ComponentData(OwningComponentDataPtr(Copy), Id);
 }
 
 ComponentData ComponentData::DeepCopy() const
@@ -40,6 +43,7 @@ bool ComponentData::ApplyUpdate(const ComponentUpdate& Update)
 	check(Update.GetUnderlying() != nullptr);
 	std::string funstr = GWorld->GetWorld()->IsServer()?"Server:ApplyUpdate":"Client:ApplyUpdate";
 	const bool bUpdateResult = Schema_ApplyComponentUpdateToData(Update.GetUnderlying(), Data.Get(),funstr.c_str()) != 0;
+	FReplicationLatencyStamp::ClearFromData(Data.Get());
 	// Copy the component to prevent unbounded memory growth from appending the update to it.
 	Data = OwningComponentDataPtr(Schema_CopyComponentData(Data.Get()));
 	return bUpdateResult;
@@ -62,6 +62,13 @@ const TArray<Worker_EntityId>& FSubView::GetCompleteEntities() const
 	return CompleteEntities;
 }
 
+SIZE_T FSubView::GetAllocatedSize() const
+{
+	return ScopedDispatcherCallbacks.GetAllocatedSize() + SubViewDelta.EntityDeltas.GetAllocatedSize() + TaggedEntities.GetAllocatedSize()
+		   + CompleteEntities.GetAllocatedSize() + NewlyCompleteEntities.GetAllocatedSize() + NewlyIncompleteEntities.GetAllocatedSize()
+		   + TemporarilyIncompleteEntities.GetAllocatedSize();
+}
+
 void FSubView::Refresh()
 {
 	for (const Worker_EntityId_Key TaggedEntityId : TaggedEntities)
@@ -23,6 +23,9 @@ ViewCoordinator::~ViewCoordinator()
 
 void ViewCoordinator::Advance(float DeltaTimeS)
 {
+	LastAdvanceTimings = FViewAdvanceTimings();
+	const uint64 AdvanceStartCycles = FPlatformTime::Cycles64();
+
 	// Get new op lists.
 	ConnectionHandler->Advance();
 	const uint32 OpListCount = ConnectionHandler->GetOpListCount();
@@ -31,6 +34,8 @@ void ViewCoordinator::Advance(float DeltaTimeS)
 	for (uint32 i = 0; i < OpListCount; ++i)
 	{
 		OpList Ops = ConnectionHandler->GetNextOpList();
+		Ops.ReceivedCycles = FPlatformTime::Cycles64();
+		LastAdvanceTimings.NumOps += Ops.Count;
 		ReserveEntityIdRetryHandler.ProcessOps(DeltaTimeS, Ops, View);
 		CreateEntityRetryHandler.ProcessOps(DeltaTimeS, Ops, View);
 		DeleteEntityRetryHandler.ProcessOps(DeltaTimeS, Ops, View);
@@ -39,20 +44,63 @@ void ViewCoordinator::Advance(float DeltaTimeS)
 		CriticalSectionFilter.AddOpList(MoveTemp(Ops));
 	}
 
+	const uint64 OpRetrievalEndCycles = FPlatformTime::Cycles64();
+	LastAdvanceTimings.OpRetrievalCycles = OpRetrievalEndCycles - AdvanceStartCycles;
+
 	// Process ops.
 	TArray<OpList> OpLists = CriticalSectionFilter.GetReadyOpLists();
 	for (const OpList& Ops : OpLists)
 	{
 		ReceivedOpEventHandler.ProcessOpLists(Ops);
+		if (Ops.ReceivedCycles != 0)
+		{
+			UnappliedOpListReceivedCycles.Add(Ops.ReceivedCycles);
+		}
 	}
 	View.AdvanceViewDelta(MoveTemp(OpLists));
 
+	const uint64 ViewDeltaEndCycles = FPlatformTime::Cycles64();
+	LastAdvanceTimings.ViewDeltaCycles = ViewDeltaEndCycles - OpRetrievalEndCycles;
+	LastAdvanceTimings.NumEntityDeltas = View.GetViewDelta().GetEntityDeltas().Num();
+
 	// Process the view delta.
 	Dispatcher.InvokeCallbacks(View.GetViewDelta().GetEntityDeltas());
+
+	const uint64 DispatcherEndCycles = FPlatformTime::Cycles64();
+	LastAdvanceTimings.DispatcherCycles = DispatcherEndCycles - ViewDeltaEndCycles;
+
 	for (const TUniquePtr<FSubView>& SubviewToAdvance : SubViews)
 	{
 		SubviewToAdvance->Advance(View.GetViewDelta());
 	}
+
+	LastAdvanceTimings.SubViewCycles = FPlatformTime::Cycles64() - DispatcherEndCycles;
+}
+
+void ViewCoordinator::RecordOpListsApplied()
+{
+	for (const uint64 ReceivedCycles : UnappliedOpListReceivedCycles)
+	{
+		OpListApplyLatency.RecordMicrosecondsSince(ReceivedCycles);
+	}
+	UnappliedOpListReceivedCycles.Reset();
+}
+
+SIZE_T ViewCoordinator::GetSubViewsAllocatedSize() const
+{
+	SIZE_T Size = SubViews.GetAllocatedSize();
+	for (const TUniquePtr<FSubView>& SubView : SubViews)
+	{
+		Size += sizeof(FSubView) + SubView->GetAllocatedSize();
+	}
+	return Size;
+}
+
+FLatencyHistogram ViewCoordinator::ConsumeOpListApplyLatency()
+{
+	FLatencyHistogram Latency = OpListApplyLatency;
+	OpListApplyLatency.Reset();
+	return Latency;
 }
 
 const ViewDelta& ViewCoordinator::GetViewDelta() const
@@ -118,9 +118,10 @@ struct RPCRingBufferTest_Fixture
 	Receiver ClientWorker;
 	UnboundedQueue ServerQueue;
 
-	RPCRingBufferTest_Fixture(uint32 BufferSize)
-		: ServerWorker(Serializer(Data, Serializer::Writer), BufferSize)
-		, ClientWorker(Serializer(Data, Serializer::Reader), BufferSize, NullReceiveWrapper<Payload>())
+	RPCRingBufferTest_Fixture(uint32 BufferSize, const RPCAdaptiveCapacitySettings& AdaptiveCapacity = RPCAdaptiveCapacitySettings(),
+							  const RPCACKPolicy& ACKPolicy = RPCACKPolicy())
+		: ServerWorker(Serializer(Data, Serializer::Writer), BufferSize, AdaptiveCapacity)
+		, ClientWorker(Serializer(Data, Serializer::Reader), BufferSize, NullReceiveWrapper<Payload>(), ACKPolicy)
 		, ServerQueue(FName(TEXT("DummyQueue")), ServerWorker)
 	{
 	}
@@ -324,4 +325,212 @@ RPCRINGBUFFER_TEST(TestRingBufferPartialExtractionAndOverflow)
 	return true;
 }
 
+RPCRINGBUFFER_TEST(TestRingBufferAdaptiveCapacity)
+{
+	const uint32 BufferSize = 8;
+	RPCAdaptiveCapacitySettings AdaptiveCapacity;
+	AdaptiveCapacity.bEnabled = true;
+	AdaptiveCapacity.MinCapacity = 2;
+	AdaptiveCapacity.ShrinkAfterIdleACKs = 1;
+	RPCRingBufferTest_Fixture Fixture(BufferSize, AdaptiveCapacity);
+
+	const Worker_EntityId Entity = 1;
+	Fixture.AddEntity(Entity);
+
+	int32 RpcId = 1;
+	for (uint32 i = 0; i < 3; ++i)
+	{
+		Fixture.ServerQueue.Push(Entity, Payload(RpcId++));
+	}
+
+	RPCWritingContext WritingCtx(Fixture.ServerQueue.Name, RPCCallbacks::UpdateWritten());
+	Fixture.ServerQueue.FlushAll(WritingCtx);
+
+	TOptional<RPCSenderStats> Stats = Fixture.ServerWorker.GetStats(Entity);
+	TestTrue(TEXT("Stats are tracked for the entity"), Stats.IsSet());
+	TestEqual(TEXT("Writes are held at the capacity"), Stats->InFlight, 2u);
+	TestEqual(TEXT("Overflow was counted"), Stats->OverflowCount, 1ull);
+	TestEqual(TEXT("Capacity grew on overflow"), Stats->Capacity, 4u);
+
+	Fixture.ServerQueue.FlushAll(WritingCtx);
+
+	Stats = Fixture.ServerWorker.GetStats(Entity);
+	TestEqual(TEXT("Held RPC written with the grown capacity"), Stats->InFlight, 3u);
+	TestEqual(TEXT("Flow control is congested"), Fixture.ServerWorker.GetFlowControl(Entity), ERPCFlowControl::Congested);
+
+	for (uint32 i = 0; i < 5; ++i)
+	{
+		Fixture.ServerQueue.Push(Entity, Payload(RpcId++));
+	}
+	Fixture.ServerQueue.FlushAll(WritingCtx);
+
+	Stats = Fixture.ServerWorker.GetStats(Entity);
+	TestEqual(TEXT("Writes are held at the capacity again"), Stats->InFlight, 4u);
+	TestEqual(TEXT("Capacity is bounded by the ring buffer size"), Stats->Capacity, BufferSize);
+
+	Fixture.ServerQueue.FlushAll(WritingCtx);
+	TestEqual(TEXT("Flow control is saturated"), Fixture.ServerWorker.GetFlowControl(Entity), ERPCFlowControl::Saturated);
+
+	auto CanExtractCallback = [](Worker_EntityId) {
+		return true;
+	};
+	auto ExtractCallback = [](Worker_EntityId, const Payload&, const RPCEmptyData&) {
+		return true;
+	};
+
+	RPCReadingContext BufferUpdateReadingCtx;
+	BufferUpdateReadingCtx.EntityId = Entity;
+	BufferUpdateReadingCtx.ComponentId = BufferComponentId;
+
+	RPCReadingContext ACKUpdateReadingCtx;
+	ACKUpdateReadingCtx.EntityId = Entity;
+	ACKUpdateReadingCtx.ComponentId = ACKComponentId;
+
+	Fixture.ClientWorker.OnUpdate(BufferUpdateReadingCtx);
+	Fixture.ClientWorker.ExtractReceivedRPCs(CanExtractCallback, ExtractCallback);
+	Fixture.ClientWorker.FlushUpdates(WritingCtx);
+
+	Fixture.ServerWorker.OnUpdate(ACKUpdateReadingCtx);
+	TestEqual(TEXT("Flow control is open after ACK"), Fixture.ServerWorker.GetFlowControl(Entity), ERPCFlowControl::Open);
+	TestEqual(TEXT("Capacity kept after a busy window"), Fixture.ServerWorker.GetStats(Entity)->Capacity, BufferSize);
+
+	Fixture.ServerWorker.OnUpdate(ACKUpdateReadingCtx);
+	TestEqual(TEXT("Capacity shrinks after an idle window"), Fixture.ServerWorker.GetStats(Entity)->Capacity, BufferSize / 2);
+
+	return true;
+}
+
+RPCRINGBUFFER_TEST(TestRingBufferBatchedACKs)
+{
+	const uint32 BufferSize = 8;
+	RPCACKPolicy ACKPolicy;
+	ACKPolicy.EveryNRPCs = 4;
+	ACKPolicy.SenderCapacityRatio = 1.0f;
+	RPCRingBufferTest_Fixture Fixture(BufferSize, RPCAdaptiveCapacitySettings(), ACKPolicy);
+
+	const Worker_EntityId Entity = 1;
+	Fixture.AddEntity(Entity);
+
+	auto CanExtractCallback = [](Worker_EntityId) {
+		return true;
+	};
+	auto ExtractCallback = [](Worker_EntityId, const Payload&, const RPCEmptyData&) {
+		return true;
+	};
+
+	RPCReadingContext BufferUpdateReadingCtx;
+	BufferUpdateReadingCtx.EntityId = Entity;
+	BufferUpdateReadingCtx.ComponentId = BufferComponentId;
+
+	RPCWritingContext WritingCtx(Fixture.ServerQueue.Name, RPCCallbacks::UpdateWritten());
+	int32 RpcId = 1;
+	auto SendAndConsume = [&](uint32 NumRPCs) {
+		for (uint32 i = 0; i < NumRPCs; ++i)
+		{
+			Fixture.ServerQueue.Push(Entity, Payload(RpcId++));
+		}
+		Fixture.ServerQueue.FlushAll(WritingCtx);
+		Fixture.ClientWorker.OnUpdate(BufferUpdateReadingCtx);
+		Fixture.ClientWorker.ExtractReceivedRPCs(CanExtractCallback, ExtractCallback);
+	};
+
+	SendAndConsume(2);
+	Fixture.ClientWorker.FlushUpdates(WritingCtx);
+	TestEqual(TEXT("ACK held back below the batch size"), Fixture.Data.ACKs[Entity].ACKCount, 0u);
+
+	SendAndConsume(2);
+	Fixture.ClientWorker.FlushUpdates(WritingCtx);
+	TestEqual(TEXT("ACK written once the batch size is reached"), Fixture.Data.ACKs[Entity].ACKCount, 4u);
+
+	SendAndConsume(1);
+	auto HasPendingUpdate = [](Worker_EntityId, Worker_ComponentId ComponentId) {
+		return ComponentId == ACKComponentId;
+	};
+	Fixture.ClientWorker.FlushUpdates(WritingCtx, HasPendingUpdate);
+	TestEqual(TEXT("ACK piggybacked on a pending update"), Fixture.Data.ACKs[Entity].ACKCount, 5u);
+
+	return true;
+}
+
+RPCRINGBUFFER_TEST(TestRingBufferLeftoverRPCsBelowBatchSizeAreACKed)
+{
+	const uint32 BufferSize = 8;
+	RPCAdaptiveCapacitySettings AdaptiveCapacity;
+	AdaptiveCapacity.bEnabled = true;
+	AdaptiveCapacity.MinCapacity = 2;
+	RPCACKPolicy ACKPolicy;
+	ACKPolicy.EveryNRPCs = 8;
+	ACKPolicy.MaxDelayMs = 0;
+	ACKPolicy.bPiggyback = false;
+	RPCRingBufferTest_Fixture Fixture(BufferSize, AdaptiveCapacity, ACKPolicy);
+
+	const Worker_EntityId Entity = 1;
+	Fixture.AddEntity(Entity);
+
+	auto CanExtractCallback = [](Worker_EntityId) {
+		return true;
+	};
+	auto ExtractCallback = [](Worker_EntityId, const Payload&, const RPCEmptyData&) {
+		return true;
+	};
+
+	RPCReadingContext BufferUpdateReadingCtx;
+	BufferUpdateReadingCtx.EntityId = Entity;
+	BufferUpdateReadingCtx.ComponentId = BufferComponentId;
+
+	RPCReadingContext ACKUpdateReadingCtx;
+	ACKUpdateReadingCtx.EntityId = Entity;
+	ACKUpdateReadingCtx.ComponentId = ACKComponentId;
+
+	RPCWritingContext WritingCtx(Fixture.ServerQueue.Name, RPCCallbacks::UpdateWritten());
+	for (uint32 i = 0; i < 3; ++i)
+	{
+		Fixture.ServerQueue.Push(Entity, Payload(i + 1));
+	}
+	Fixture.ServerQueue.FlushAll(WritingCtx);
+	TestEqual(TEXT("Sender is held at its adaptive capacity"), Fixture.ServerWorker.GetStats(Entity)->InFlight, 2u);
+
+	Fixture.ClientWorker.OnUpdate(BufferUpdateReadingCtx);
+	Fixture.ClientWorker.ExtractReceivedRPCs(CanExtractCallback, ExtractCallback);
+	Fixture.ClientWorker.FlushUpdates(WritingCtx);
+	TestEqual(TEXT("ACK held back in the frame RPCs arrived"), Fixture.Data.ACKs[Entity].ACKCount, 0u);
+
+	Fixture.ClientWorker.FlushUpdates(WritingCtx);
+	TestEqual(TEXT("Leftover RPCs below the batch size are ACKed once a frame passes without new ones"),
+			  Fixture.Data.ACKs[Entity].ACKCount, 2u);
+
+	Fixture.ServerWorker.OnUpdate(ACKUpdateReadingCtx);
+	TestEqual(TEXT("Sender sees its in-flight RPCs acknowledged"), Fixture.ServerWorker.GetStats(Entity)->InFlight, 0u);
+
+	return true;
+}
+
+RPCRINGBUFFER_TEST(TestRingBufferAllocatedSizeCountsQueuedAndReceivedRPCs)
+{
+	RPCRingBufferTest_Fixture Fixture(8);
+
+	const Worker_EntityId Entity = 1;
+	Fixture.AddEntity(Entity);
+
+	const SIZE_T EmptyQueueSize = Fixture.ServerQueue.GetAllocatedSize();
+	const SIZE_T EmptyReceiverSize = Fixture.ClientWorker.GetAllocatedSize();
+
+	for (uint32 i = 0; i < 4; ++i)
+	{
+		Fixture.ServerQueue.Push(Entity, Payload(i + 1));
+	}
+	TestTrue(TEXT("Queued RPCs are counted"), Fixture.ServerQueue.GetAllocatedSize() > EmptyQueueSize);
+
+	RPCWritingContext WritingCtx(Fixture.ServerQueue.Name, RPCCallbacks::UpdateWritten());
+	Fixture.ServerQueue.FlushAll(WritingCtx);
+
+	RPCReadingContext BufferUpdateReadingCtx;
+	BufferUpdateReadingCtx.EntityId = Entity;
+	BufferUpdateReadingCtx.ComponentId = BufferComponentId;
+	Fixture.ClientWorker.OnUpdate(BufferUpdateReadingCtx);
+	TestTrue(TEXT("Received RPCs waiting for extraction are counted"), Fixture.ClientWorker.GetAllocatedSize() > EmptyReceiverSize);
+
+	return true;
+}
+
 } // namespace RPCRingBufferTestPrivate
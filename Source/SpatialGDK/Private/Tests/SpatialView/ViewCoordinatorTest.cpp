@@ -227,4 +227,37 @@ VIEWCOORDINATOR_TEST(GIVEN_view_coordinator_with_multiple_tracked_subviews_WHEN_
 
 	return true;
 }
+
+VIEWCOORDINATOR_TEST(GIVEN_op_lists_received_WHEN_applied_THEN_apply_latency_is_recorded_once_per_op_list)
+{
+	const Worker_EntityId EntityId = 1;
+	const Worker_ComponentId ComponentId = 1;
+
+	TArray<TArray<OpList>> ListsOfOpLists;
+	TArray<OpList> OpLists;
+	EntityComponentOpListBuilder FirstBuilder;
+	FirstBuilder.AddEntity(EntityId);
+	OpLists.Add(MoveTemp(FirstBuilder).CreateOpList());
+	EntityComponentOpListBuilder SecondBuilder;
+	SecondBuilder.AddComponent(EntityId, ComponentData(ComponentId));
+	OpLists.Add(MoveTemp(SecondBuilder).CreateOpList());
+	ListsOfOpLists.Add(MoveTemp(OpLists));
+
+	auto Handler = MakeUnique<ConnectionHandlerStub>();
+	Handler->SetListsOfOpLists(MoveTemp(ListsOfOpLists));
+	ViewCoordinator Coordinator(MoveTemp(Handler), nullptr, FComponentSetData());
+
+	Coordinator.Advance(0.0f);
+	TestEqual("Nothing is recorded before the view delta is processed", Coordinator.ConsumeOpListApplyLatency().GetTotalCount(),
+			  static_cast<uint64>(0));
+
+	Coordinator.RecordOpListsApplied();
+	TestEqual("Each op list is recorded", Coordinator.ConsumeOpListApplyLatency().GetTotalCount(), static_cast<uint64>(2));
+
+	Coordinator.RecordOpListsApplied();
+	TestEqual("Op lists are only recorded once", Coordinator.ConsumeOpListApplyLatency().GetTotalCount(),
+			  static_cast<uint64>(0));
+
+	return true;
+}
 } // namespace SpatialGDK
@@ -0,0 +1,92 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/ActorReplicationSchedule.h"
+
+#include "GameFramework/Actor.h"
+
+namespace SpatialGDK
+{
+namespace
+{
+// Stale entries are only dropped when they reach the top of the heap, rebuild it once they outnumber the live ones by this much.
+constexpr int32 MaxStaleEntries = 64;
+} // anonymous namespace
+
+void FActorReplicationSchedule::Schedule(AActor* Actor, float Time)
+{
+	const TWeakObjectPtr<AActor> WeakActor(Actor);
+	if (const float* ScheduledTime = ScheduledTimes.Find(WeakActor))
+	{
+		if (*ScheduledTime == Time)
+		{
+			return;
+		}
+	}
+
+	ScheduledTimes.Add(WeakActor, Time);
+	Push(WeakActor, Time);
+}
+
+void FActorReplicationSchedule::Wake(AActor* Actor)
+{
+	// Nothing is ever scheduled earlier than this, so it is due whatever time the next PopDue is for.
+	const float WakeTime = TNumericLimits<float>::Lowest();
+	Schedule(Actor, WakeTime);
+}
+
+void FActorReplicationSchedule::Remove(AActor* Actor)
+{
+	ScheduledTimes.Remove(Actor);
+	CompactIfNeeded();
+}
+
+void FActorReplicationSchedule::PopDue(float Now, TArray<AActor*>& OutDueActors)
+{
+	while (Heap.Num() > 0 && Heap.HeapTop().Time <= Now)
+	{
+		FEntry Entry;
+		Heap.HeapPop(Entry, FEntryCompare(), /* bAllowShrinking */ false);
+
+		const float* ScheduledTime = ScheduledTimes.Find(Entry.Actor);
+		if (ScheduledTime == nullptr || *ScheduledTime != Entry.Time)
+		{
+			// Removed or rescheduled since this entry was pushed.
+			continue;
+		}
+
+		ScheduledTimes.Remove(Entry.Actor);
+
+		if (AActor* Actor = Entry.Actor.Get())
+		{
+			OutDueActors.Add(Actor);
+		}
+	}
+}
+
+void FActorReplicationSchedule::Empty()
+{
+	Heap.Empty();
+	ScheduledTimes.Empty();
+}
+
+void FActorReplicationSchedule::Push(const TWeakObjectPtr<AActor>& Actor, float Time)
+{
+	Heap.HeapPush(FEntry{ Time, Actor }, FEntryCompare());
+	CompactIfNeeded();
+}
+
+void FActorReplicationSchedule::CompactIfNeeded()
+{
+	if (Heap.Num() <= 2 * ScheduledTimes.Num() + MaxStaleEntries)
+	{
+		return;
+	}
+
+	Heap.Reset();
+	for (const TPair<TWeakObjectPtr<AActor>, float>& ScheduledTime : ScheduledTimes)
+	{
+		Heap.Add(FEntry{ ScheduledTime.Value, ScheduledTime.Key });
+	}
+	Heap.Heapify(FEntryCompare());
+}
+} // namespace SpatialGDK
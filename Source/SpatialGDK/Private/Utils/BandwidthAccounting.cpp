@@ -0,0 +1,191 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/BandwidthAccounting.h"
+
+#include "Misc/OutputDevice.h"
+#include "SpatialConstants.h"
+
+namespace SpatialGDK
+{
+FString FBandwidthAccounting::FEntry::GetDisplayName() const
+{
+	switch (Category)
+	{
+	case EBandwidthCategory::Component:
+		return FString::Printf(TEXT("%u"), ComponentId);
+	case EBandwidthCategory::RPC:
+		return FString::Printf(TEXT("%s::%s"), *OuterName.ToString(), *Name.ToString());
+	default:
+		return Name.ToString();
+	}
+}
+
+FBandwidthAccounting::FBandwidthAccounting(int32 InNumIntervals, double InIntervalSeconds)
+	: IntervalSeconds(FMath::Max(InIntervalSeconds, KINDA_SMALL_NUMBER))
+{
+	Intervals.SetNum(FMath::Max(InNumIntervals, 1));
+}
+
+void FBandwidthAccounting::RecordComponent(EBandwidthDirection Direction, Worker_ComponentId ComponentId, uint32 Bytes, double NowSeconds)
+{
+	Record({ EBandwidthCategory::Component, NAME_None, NAME_None, ComponentId }, Direction, Bytes, NowSeconds);
+}
+
+void FBandwidthAccounting::RecordActorClass(EBandwidthDirection Direction, FName ClassName, uint32 Bytes, double NowSeconds)
+{
+	Record({ EBandwidthCategory::ActorClass, ClassName, NAME_None, SpatialConstants::INVALID_COMPONENT_ID }, Direction, Bytes, NowSeconds);
+}
+
+void FBandwidthAccounting::RecordRPC(EBandwidthDirection Direction, FName ClassName, FName FunctionName, uint32 Bytes, double NowSeconds)
+{
+	Record({ EBandwidthCategory::RPC, FunctionName, ClassName, SpatialConstants::INVALID_COMPONENT_ID }, Direction, Bytes, NowSeconds);
+}
+
+void FBandwidthAccounting::Record(const FKey& Key, EBandwidthDirection Direction, uint32 Bytes, double NowSeconds)
+{
+	if (CurrentInterval == INDEX_NONE || NowSeconds - Intervals[CurrentInterval].StartSeconds >= IntervalSeconds)
+	{
+		// Intervals are aligned to multiples of the interval length, so skipped intervals simply age out of the window.
+		CurrentInterval = (CurrentInterval + 1) % Intervals.Num();
+		FInterval& Interval = Intervals[CurrentInterval];
+		Interval.StartSeconds = FMath::FloorToDouble(NowSeconds / IntervalSeconds) * IntervalSeconds;
+		Interval.Counts.Reset();
+	}
+
+	FCounts& Counts = Intervals[CurrentInterval].Counts.FindOrAdd(Key);
+	Counts.Bytes[static_cast<uint8>(Direction)] += Bytes;
+	Counts.Messages[static_cast<uint8>(Direction)]++;
+}
+
+bool FBandwidthAccounting::IsInWindow(const FInterval& Interval, double NowSeconds) const
+{
+	return Interval.Counts.Num() > 0 && NowSeconds - Interval.StartSeconds < IntervalSeconds * Intervals.Num();
+}
+
+TArray<FBandwidthAccounting::FEntry> FBandwidthAccounting::GetTopEntries(EBandwidthCategory Category, EBandwidthDirection Direction,
+																		  int32 MaxEntries, double NowSeconds) const
+{
+	TMap<FKey, FCounts> Totals;
+	for (const FInterval& Interval : Intervals)
+	{
+		if (!IsInWindow(Interval, NowSeconds))
+		{
+			continue;
+		}
+
+		for (const auto& Pair : Interval.Counts)
+		{
+			if (Pair.Key.Category != Category)
+			{
+				continue;
+			}
+
+			FCounts& Total = Totals.FindOrAdd(Pair.Key);
+			for (uint8 DirectionIndex = 0; DirectionIndex < static_cast<uint8>(EBandwidthDirection::Count); ++DirectionIndex)
+			{
+				Total.Bytes[DirectionIndex] += Pair.Value.Bytes[DirectionIndex];
+				Total.Messages[DirectionIndex] += Pair.Value.Messages[DirectionIndex];
+			}
+		}
+	}
+
+	const uint8 DirectionIndex = static_cast<uint8>(Direction);
+
+	TArray<FEntry> Entries;
+	Entries.Reserve(Totals.Num());
+	for (const auto& Pair : Totals)
+	{
+		if (Pair.Value.Bytes[DirectionIndex] == 0)
+		{
+			continue;
+		}
+
+		FEntry& Entry = Entries.AddDefaulted_GetRef();
+		Entry.Category = Pair.Key.Category;
+		Entry.Name = Pair.Key.Name;
+		Entry.OuterName = Pair.Key.OuterName;
+		Entry.ComponentId = Pair.Key.ComponentId;
+		FMemory::Memcpy(Entry.Bytes, Pair.Value.Bytes, sizeof(Entry.Bytes));
+		FMemory::Memcpy(Entry.Messages, Pair.Value.Messages, sizeof(Entry.Messages));
+	}
+
+	Entries.Sort([DirectionIndex](const FEntry& Lhs, const FEntry& Rhs) {
+		return Lhs.Bytes[DirectionIndex] > Rhs.Bytes[DirectionIndex];
+	});
+
+	if (MaxEntries >= 0 && Entries.Num() > MaxEntries)
+	{
+		Entries.SetNum(MaxEntries);
+	}
+
+	return Entries;
+}
+
+double FBandwidthAccounting::GetWindowSeconds(double NowSeconds) const
+{
+	double OldestStartSeconds = NowSeconds;
+	for (const FInterval& Interval : Intervals)
+	{
+		if (IsInWindow(Interval, NowSeconds))
+		{
+			OldestStartSeconds = FMath::Min(OldestStartSeconds, Interval.StartSeconds);
+		}
+	}
+	return NowSeconds - OldestStartSeconds;
+}
+
+void FBandwidthAccounting::Reset()
+{
+	for (FInterval& Interval : Intervals)
+	{
+		Interval.Counts.Reset();
+	}
+	CurrentInterval = INDEX_NONE;
+}
+
+void FBandwidthAccounting::DumpTopEntries(FOutputDevice& Ar, int32 MaxEntries, double NowSeconds) const
+{
+	const double WindowSeconds = FMath::Max(GetWindowSeconds(NowSeconds), 1.0);
+	Ar.Logf(TEXT("Bandwidth over the last %.1f seconds:"), WindowSeconds);
+
+	static const TCHAR* DirectionNames[] = { TEXT("sent"), TEXT("received") };
+	static_assert(UE_ARRAY_COUNT(DirectionNames) == static_cast<uint8>(EBandwidthDirection::Count), "Every direction needs a name");
+
+	for (uint8 CategoryIndex = 0; CategoryIndex < static_cast<uint8>(EBandwidthCategory::Count); ++CategoryIndex)
+	{
+		const EBandwidthCategory Category = static_cast<EBandwidthCategory>(CategoryIndex);
+		for (uint8 DirectionIndex = 0; DirectionIndex < static_cast<uint8>(EBandwidthDirection::Count); ++DirectionIndex)
+		{
+			const TArray<FEntry> Entries =
+				GetTopEntries(Category, static_cast<EBandwidthDirection>(DirectionIndex), MaxEntries, NowSeconds);
+			if (Entries.Num() == 0)
+			{
+				continue;
+			}
+
+			Ar.Logf(TEXT("  Top %s by bytes %s:"), GetCategoryName(Category), DirectionNames[DirectionIndex]);
+			for (const FEntry& Entry : Entries)
+			{
+				Ar.Logf(TEXT("    %-48s %12llu bytes %10.1f bytes/s %8llu messages"), *Entry.GetDisplayName(), Entry.Bytes[DirectionIndex],
+						Entry.Bytes[DirectionIndex] / WindowSeconds, Entry.Messages[DirectionIndex]);
+			}
+		}
+	}
+}
+
+const TCHAR* FBandwidthAccounting::GetCategoryName(EBandwidthCategory Category)
+{
+	switch (Category)
+	{
+	case EBandwidthCategory::Component:
+		return TEXT("components");
+	case EBandwidthCategory::ActorClass:
+		return TEXT("actor classes");
+	case EBandwidthCategory::RPC:
+		return TEXT("RPCs");
+	default:
+		checkNoEntry();
+		return TEXT("");
+	}
+}
+} // namespace SpatialGDK
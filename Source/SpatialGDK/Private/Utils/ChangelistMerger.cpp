@@ -0,0 +1,85 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/ChangelistMerger.h"
+
+namespace SpatialGDK
+{
+namespace
+{
+constexpr int32 NumBitsPerWord = 32;
+} // anonymous namespace
+
+bool FChangelistMerger::TryMergeFlat(int32 NumHandles, TArrayView<const TArray<uint16>* const> Changelists,
+									 TFunctionRef<bool(uint16 Handle)> IsDynamicArrayHandle, TArray<uint16>& OutMerged)
+{
+	if (!IsFlat(NumHandles, OutMerged, IsDynamicArrayHandle))
+	{
+		return false;
+	}
+	for (const TArray<uint16>* Changelist : Changelists)
+	{
+		if (!IsFlat(NumHandles, *Changelist, IsDynamicArrayHandle))
+		{
+			return false;
+		}
+	}
+
+	// Handles start at 1, bit 0 is never set.
+	ChangedHandles.Reset();
+	ChangedHandles.SetNumZeroed(NumHandles / NumBitsPerWord + 1, /* bAllowShrinking */ false);
+
+	AddToBitset(OutMerged);
+	for (const TArray<uint16>* Changelist : Changelists)
+	{
+		AddToBitset(*Changelist);
+	}
+
+	OutMerged.Reset();
+	for (int32 WordIndex = 0; WordIndex < ChangedHandles.Num(); ++WordIndex)
+	{
+		uint32 Word = ChangedHandles[WordIndex];
+		while (Word != 0)
+		{
+			const uint32 Bit = FMath::CountTrailingZeros(Word);
+			OutMerged.Add(static_cast<uint16>(WordIndex * NumBitsPerWord + Bit));
+			Word &= Word - 1;
+		}
+	}
+
+	if (OutMerged.Num() > 0)
+	{
+		OutMerged.Add(0);
+	}
+
+	return true;
+}
+
+bool FChangelistMerger::IsFlat(int32 NumHandles, const TArray<uint16>& Changelist, TFunctionRef<bool(uint16 Handle)> IsDynamicArrayHandle)
+{
+	// Stops at the terminator, so a list that does hold an array is rejected at the array's handle before its sub-list is reached.
+	for (const uint16 Handle : Changelist)
+	{
+		if (Handle == 0)
+		{
+			break;
+		}
+		if (Handle > NumHandles || IsDynamicArrayHandle(Handle))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void FChangelistMerger::AddToBitset(const TArray<uint16>& Changelist)
+{
+	for (const uint16 Handle : Changelist)
+	{
+		if (Handle == 0)
+		{
+			break;
+		}
+		ChangedHandles[Handle / NumBitsPerWord] |= 1u << (Handle % NumBitsPerWord);
+	}
+}
+} // namespace SpatialGDK
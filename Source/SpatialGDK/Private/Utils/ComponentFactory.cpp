@@ -17,6 +17,7 @@
 #include "SpatialGDKSettings.h"
 #include "Utils/GDKPropertyMacros.h"
 #include "Utils/InterestFactory.h"
+#include "Utils/RepFieldDispatchTable.h"
 #include "Utils/RepLayoutUtils.h"
 
 DEFINE_LOG_CATEGORY(LogComponentFactory);
@@ -56,6 +57,8 @@ uint32 ComponentFactory::FillSchemaObject(Schema_Object* ComponentObject, UObjec
 	// Populate the replicated data component updates from the replicated property changelist.
 	if (Changes.RepChanged.Num() > 0)
 	{
+		const FRepFieldDispatchTable& DispatchTable = GetDispatchTable(Object, Changes.RepLayout);
+
 		FChangelistIterator ChangelistIterator(Changes.RepChanged, 0);
 		FRepHandleIterator HandleIterator(static_cast<UStruct*>(Changes.RepLayout.GetOwner()), ChangelistIterator, Changes.RepLayout.Cmds,
 										  Changes.RepLayout.BaseHandleToCmdIndex, 0, 1, 0, Changes.RepLayout.Cmds.Num() - 1);
@@ -100,8 +103,32 @@ uint32 ComponentFactory::FillSchemaObject(Schema_Object* ComponentObject, UObjec
 
 				if (!bProcessedFastArrayProperty)
 				{
-
-					AddProperty(ComponentObject, bOnlySecondNameData?HandleIterator.Handle:HandleIterator.Handle+1, Cmd.Property, Data, ClearedIds);
+					const Schema_FieldId FieldId = bOnlySecondNameData ? HandleIterator.Handle : HandleIterator.Handle + 1;
+					const FRepFieldDispatchEntry* Entry = DispatchTable.FindByHandle(HandleIterator.Handle);
+					if (Entry != nullptr && Entry->GeneratedEncode != nullptr)
+					{
+						Entry->GeneratedEncode(ComponentObject, FieldId, Data);
+					}
+					else if (Entry != nullptr && Entry->Quantization.Mode != ESpatialQuantization::None)
+					{
+						FBitWriter QuantizedWriter(0, /* AllowResize */ true);
+						PropertyQuantization::Write(QuantizedWriter, GDK_CASTFIELD<GDK_PROPERTY(StructProperty)>(Cmd.Property)->Struct,
+													Entry->Quantization, Data);
+						AddBytesToSchema(ComponentObject, FieldId, QuantizedWriter);
+					}
+					else if (Entry != nullptr && Entry->bSendsArrayDeltas && !bIsInitialData
+							 && CanSendArrayDelta(Object, FieldId, GDK_CASTFIELD<GDK_PROPERTY(ArrayProperty)>(Cmd.Property), Data))
+					{
+						// The iterator is past the array's handle, at the number of entries in the array's own changelist.
+						const int32 ElementChangelistStart = ChangelistIterator.ChangedIndex + 1;
+						const int32 ElementChangelistNum = Changes.RepChanged[ChangelistIterator.ChangedIndex];
+						AddArrayDelta(ComponentObject, FieldId, *Entry, GDK_CASTFIELD<GDK_PROPERTY(ArrayProperty)>(Cmd.Property), Data,
+									  MakeArrayView(Changes.RepChanged.GetData() + ElementChangelistStart, ElementChangelistNum), ClearedIds);
+					}
+					else
+					{
+						AddProperty(ComponentObject, FieldId, Cmd.Property, Data, ClearedIds);
+					}
 				}
 
 #if USE_NETWORK_PROFILER
@@ -141,6 +168,44 @@ uint32 ComponentFactory::FillSchemaObject(Schema_Object* ComponentObject, UObjec
 	return 0;
 }
 
+const FRepFieldDispatchTable& ComponentFactory::GetDispatchTable(UObject* Object, const FRepLayout& RepLayout)
+{
+	return ClassInfoManager->GetFieldDispatchTable(Object->GetClass(), RepLayout);
+}
+
+bool ComponentFactory::CanSendArrayDelta(UObject* Object, Schema_FieldId FieldId, GDK_PROPERTY(ArrayProperty) * Property,
+										  const uint8* Data)
+{
+	// The length is recorded whichever way the array is sent, so the update after a whole one can be a delta again.
+	return UpdateChannel != nullptr && UpdateChannel->RecordSentDeltaArrayLength(Object, FieldId, FScriptArrayHelper(Property, Data).Num());
+}
+
+void ComponentFactory::AddArrayDelta(Schema_Object* Object, Schema_FieldId FieldId, const FRepFieldDispatchEntry& Entry,
+									 GDK_PROPERTY(ArrayProperty) * Property, const uint8* Data, TArrayView<const uint16> ElementChangelist,
+									 TArray<Schema_FieldId>* ClearedIds)
+{
+	FScriptArrayHelper ArrayHelper(Property, Data);
+
+	Schema_Object* DeltaObject = Schema_AddObject(Object, SpatialConstants::ARRAY_DELTA_ID);
+	Schema_AddUint32(DeltaObject, SpatialConstants::ARRAY_DELTA_FIELD_ID, FieldId);
+	Schema_AddUint32(DeltaObject, SpatialConstants::ARRAY_DELTA_LENGTH_ID, ArrayHelper.Num());
+
+	// Element handles are sorted, so all handles of one element are next to each other.
+	int32 PreviousIndex = INDEX_NONE;
+	for (const uint16 ElementHandle : ElementChangelist)
+	{
+		const int32 ElementIndex = (ElementHandle - 1) / Entry.ArrayHandlesPerElement;
+		if (ElementIndex == PreviousIndex || ElementIndex >= ArrayHelper.Num())
+		{
+			continue;
+		}
+		PreviousIndex = ElementIndex;
+
+		Schema_AddUint32(DeltaObject, SpatialConstants::ARRAY_DELTA_INDICES_ID, ElementIndex);
+		AddProperty(Object, FieldId, Property->Inner, ArrayHelper.GetRawPtr(ElementIndex), ClearedIds, true, ElementIndex);
+	}
+}
+
 void ComponentFactory::AddProperty(Schema_Object* Object, Schema_FieldId FieldId, GDK_PROPERTY(Property) * Property, const uint8* Data,
 								   TArray<Schema_FieldId>* ClearedIds,bool is_repeated,int index)
 {
@@ -321,7 +386,8 @@ void ComponentFactory::AddProperty(Schema_Object* Object, Schema_FieldId FieldId
 		{
 			const FSoftObjectPtr* ObjectPtr = reinterpret_cast<const FSoftObjectPtr*>(Data);
 
-			AddObjectRefToSchema(Object, FieldId, FUnrealObjectRef::FromSoftObjectPath(ObjectPtr->ToSoftObjectPath()),is_repeated);
+			AddObjectRefToSchema(Object, FieldId, FUnrealObjectRef::FromSoftObjectPath(ObjectPtr->ToSoftObjectPath()),is_repeated,
+								 &ClassInfoManager->GetInternedObjectPaths());
 		}
 		else
 		{
@@ -331,7 +397,8 @@ void ComponentFactory::AddProperty(Schema_Object* Object, Schema_FieldId FieldId
 			{
 				bInterestHasChanged = true;
 			}
-			AddObjectRefToSchema(Object, FieldId, FUnrealObjectRef::FromObjectPtr(ObjectValue, PackageMap),is_repeated);
+			AddObjectRefToSchema(Object, FieldId, FUnrealObjectRef::FromObjectPtr(ObjectValue, PackageMap),is_repeated,
+								 &ClassInfoManager->GetInternedObjectPaths());
 		}
 	}
 	else if (GDK_PROPERTY(NameProperty)* NameProperty = GDK_CASTFIELD<GDK_PROPERTY(NameProperty)>(Property))
@@ -482,6 +549,8 @@ TArray<FWorkerComponentUpdate> ComponentFactory::CreateComponentUpdates(UObject*
 {
 	TArray<FWorkerComponentUpdate> ComponentUpdates;
 
+	UpdateChannel = NetDriver->GetActorChannelByEntityId(EntityId);
+
 	static_assert(SCHEMA_Count == 4, "Unexpected number of Schema type components, please check the enclosing function is still correct.");
 
 	if (RepChangeState)
@@ -13,6 +13,7 @@
 #include "Interop/SpatialConditionMapFilter.h"
 #include "SpatialConstants.h"
 #include "Utils/GDKPropertyMacros.h"
+#include "Utils/RepFieldDispatchTable.h"
 #include "Utils/RepLayoutUtils.h"
 #include "Utils/SchemaUtils.h"
 
@@ -25,6 +26,9 @@ DECLARE_CYCLE_STAT(TEXT("Reader ApplyArray"), STAT_ReaderApplyArray, STATGROUP_S
 
 namespace
 {
+// Enough for the fields of most updates, so collecting their IDs doesn't allocate.
+constexpr int32 InlineFieldIdCount = 64;
+
 bool FORCEINLINE ObjectRefSetsAreSame(const TSet<FUnrealObjectRef>& A, const TSet<FUnrealObjectRef>& B)
 {
 	if (A.Num() != B.Num())
@@ -131,18 +135,18 @@ void ComponentReader::ApplyComponentUpdate(const Worker_ComponentId ComponentId,
 
 	Schema_Object* ComponentObject = Schema_GetComponentUpdateFields(ComponentUpdate);
 
-	// Retrieve all the fields that have been updated in this component update
-	TArray<uint32> UpdatedIds;
-	UpdatedIds.SetNumUninitialized(Schema_GetUniqueFieldIdCount(ComponentObject));
-	Schema_GetUniqueFieldIds(ComponentObject, UpdatedIds.GetData());
+	// Retrieve all the fields that have been updated in this component update, and the fields that have been cleared
+	// (eg. list with no entries), so they will be processed as well (Schema_FieldId == uint32)
+	const uint32 UpdatedCount = Schema_GetUniqueFieldIdCount(ComponentObject);
+	const uint32 ClearedCount = Schema_GetComponentUpdateClearedFieldCount(ComponentUpdate);
 
-	// Retrieve all the fields that have been cleared (eg. list with no entries)
-	TArray<Schema_FieldId> ClearedIds;
-	ClearedIds.SetNumUninitialized(Schema_GetComponentUpdateClearedFieldCount(ComponentUpdate));
-	Schema_GetComponentUpdateClearedFieldList(ComponentUpdate, ClearedIds.GetData());
+	TArray<Schema_FieldId, TInlineAllocator<InlineFieldIdCount>> UpdatedIds;
+	UpdatedIds.SetNumUninitialized(UpdatedCount + ClearedCount);
+	Schema_GetUniqueFieldIds(ComponentObject, UpdatedIds.GetData());
+	Schema_GetComponentUpdateClearedFieldList(ComponentUpdate, UpdatedIds.GetData() + UpdatedCount);
 
-	// Merge cleared fields into updated fields to ensure they will be processed (Schema_FieldId == uint32)
-	UpdatedIds.Append(ClearedIds);
+	// The latency stamp isn't a property, it's read by the actor system before the update is applied.
+	UpdatedIds.RemoveSingle(SpatialConstants::REPLICATION_LATENCY_STAMP_ID);
 
 	if (UpdatedIds.Num() > 0)
 	{
@@ -151,7 +155,7 @@ void ComponentReader::ApplyComponentUpdate(const Worker_ComponentId ComponentId,
 }
 
 void ComponentReader::ApplySchemaObject(Schema_Object* ComponentObject, UObject& Object, USpatialActorChannel& Channel, bool bIsInitialData,
-										const TArray<Schema_FieldId>& UpdatedIds, Worker_ComponentId ComponentId,
+										TArrayView<const Schema_FieldId> UpdatedIds, Worker_ComponentId ComponentId,
 										bool& bOutReferencesChanged)
 {
 	FObjectReplicator* Replicator = Channel.PreReceiveSpatialUpdate(&Object);
@@ -160,32 +164,50 @@ void ComponentReader::ApplySchemaObject(Schema_Object* ComponentObject, UObject&
 		// Can't apply this schema object. Error printed from PreReceiveSpatialUpdate.
 		return;
 	}
-	bool isData = false;
-	TArray<Schema_FieldId> UpdatedIds2 = UpdatedIds;
-    if(Schema_IsOnlySecondNameData(ComponentObject) )
-    {
-    	ComponentObject = Schema_GetObject(ComponentObject,2);
-    	Schema_Fields* sf =  Schema_FieldIds(ComponentObject);
-    	if(sf)
-    	{
-    		TArray<Schema_FieldId> fileds;
-    		fileds.Reset();
-    		for(uint32_t i=0;i<sf->filed_count;i++)
-    			fileds.Add(*(sf->filed_id+i));
-    		Schema_DestorySchemaFileds(sf);
-    		UpdatedIds2 = fileds;
-    	}
-    	isData = true;
-    }
+
+	// Replicated properties are written with their field ID one past their rep handle, unless the component only holds
+	// a nested data object, whose field IDs are the rep handles.
+	int32 FieldIdToHandleOffset = 1;
+	TArray<Schema_FieldId, TInlineAllocator<InlineFieldIdCount>> NestedIds;
+	if (Schema_IsOnlySecondNameData(ComponentObject))
+	{
+		ComponentObject = Schema_GetObject(ComponentObject, 2);
+		NestedIds.SetNumUninitialized(Schema_GetUniqueFieldIdCount(ComponentObject));
+		Schema_GetUniqueFieldIds(ComponentObject, NestedIds.GetData());
+		UpdatedIds = NestedIds;
+		FieldIdToHandleOffset = 0;
+	}
+
+	// Arrays sent as element deltas may only have changed length, in which case their field isn't in the update.
+	// Component data can still hold the deltas of the last update merged into it. They're stale there, data holds whole arrays.
+	TArray<TPair<Schema_FieldId, Schema_Object*>, TInlineAllocator<4>> ArrayDeltas;
+	TArray<Schema_FieldId, TInlineAllocator<InlineFieldIdCount>> IdsWithArrayDeltas;
+	const uint32 ArrayDeltaCount = Schema_GetObjectCount(ComponentObject, SpatialConstants::ARRAY_DELTA_ID);
+	if (ArrayDeltaCount > 0)
+	{
+		IdsWithArrayDeltas.Append(UpdatedIds.GetData(), UpdatedIds.Num());
+		IdsWithArrayDeltas.RemoveSingle(SpatialConstants::ARRAY_DELTA_ID);
+		for (uint32 DeltaIndex = 0; DeltaIndex < (bIsInitialData ? 0 : ArrayDeltaCount); ++DeltaIndex)
+		{
+			Schema_Object* ArrayDelta = Schema_IndexObject(ComponentObject, SpatialConstants::ARRAY_DELTA_ID, DeltaIndex);
+			const Schema_FieldId ArrayFieldId = Schema_GetUint32(ArrayDelta, SpatialConstants::ARRAY_DELTA_FIELD_ID);
+			ArrayDeltas.Emplace(ArrayFieldId, ArrayDelta);
+			IdsWithArrayDeltas.AddUnique(ArrayFieldId);
+		}
+		IdsWithArrayDeltas.Sort();
+		UpdatedIds = IdsWithArrayDeltas;
+	}
+
+	const FRepLayout& RepLayout = *Replicator->RepLayout;
+	const FRepFieldDispatchTable& DispatchTable = GetDispatchTable(Object, RepLayout);
 	TUniquePtr<FRepState>& RepState = Replicator->RepState;
-	TArray<FRepLayoutCmd>& Cmds = Replicator->RepLayout->Cmds;
-	TArray<FHandleToCmdIndex>& BaseHandleToCmdIndex = Replicator->RepLayout->BaseHandleToCmdIndex;
-	TArray<FRepParentCmd>& Parents = Replicator->RepLayout->Parents;
 
 	bool bIsAuthServer = Channel.IsAuthoritativeServer();
 	bool bAutonomousProxy = Channel.IsClientAutonomousProxy();
 	bool bIsClient = NetDriver->GetNetMode() == NM_Client;
+	bool bIsServer = NetDriver->IsServer();
 	bool bEventTracerEnabled = EventTracer != nullptr;
+	const bool bSkipRoleSwap = Channel.GetSkipRoleSwap();
 
 	FSpatialConditionMapFilter ConditionMap(&Channel, bIsClient);
 
@@ -203,17 +225,16 @@ void ComponentReader::ApplySchemaObject(Schema_Object* ComponentObject, UObject&
 			CauseSpanIds = EventTracer->GetAndConsumeSpansForComponent(EntityComponentId(EntityId, ComponentId));
 		}
 
-		for (uint32 FieldId : UpdatedIds2)
+		for (uint32 FieldId : UpdatedIds)
 		{
-			// FieldId is the same as rep handle
-			int real_index = FieldId - 2 ;
-			if(isData)
+			const int32 Handle = static_cast<int32>(FieldId) - FieldIdToHandleOffset;
+			if (Handle < 1)
 			{
-				real_index = FieldId - 1;
+				continue;
 			}
-            if(real_index<0)
-            	continue;
-			if (FieldId < 1 || real_index >= BaseHandleToCmdIndex.Num())
+
+			const FRepFieldDispatchEntry* Entry = DispatchTable.FindByHandle(Handle);
+			if (Entry == nullptr)
 			{
 				UE_LOG(LogSpatialComponentReader, Error,
 					   TEXT("ApplySchemaObject: Encountered an invalid field Id while applying schema. Object: %s, Field: %d, Entity: "
@@ -222,164 +243,119 @@ void ComponentReader::ApplySchemaObject(Schema_Object* ComponentObject, UObject&
 				continue;
 			}
 
-			int32 CmdIndex = BaseHandleToCmdIndex[real_index].CmdIndex;
-			const FRepLayoutCmd& Cmd = Cmds[CmdIndex];
-			const FRepParentCmd& Parent = Parents[Cmd.ParentIndex];
-			int32 ShadowOffset = Cmd.ShadowOffset;
-
-			if (NetDriver->IsServer() || ConditionMap.IsRelevant(Parent.Condition))
+			if (!bIsServer && !ConditionMap.IsRelevant(Entry->Condition))
 			{
-				// This is mostly copied from ReceivePropertyHelper in RepLayout.cpp
-				auto GetSwappedCmd = [&Cmd, &Cmds, &Parents, bIsAuthServer, &Replicator, &Channel, &Parent]() -> const FRepLayoutCmd& {
-
-					// Only swap Role/RemoteRole for actors
-					if (EnumHasAnyFlags(Replicator->RepLayout->GetFlags(), ERepLayoutFlags::IsActor) && !Channel.GetSkipRoleSwap())
-					{
-						// Swap Role to RemoteRole, and vice-versa. Leave everything else the same.
-						if (UNLIKELY((int32)AActor::ENetFields_Private::RemoteRole == Cmd.ParentIndex))
-						{
-							return Cmds[Parents[(int32)AActor::ENetFields_Private::Role].CmdStart];
-						}
-						else if (UNLIKELY((int32)AActor::ENetFields_Private::Role == Cmd.ParentIndex))
-						{
-							return Cmds[Parents[(int32)AActor::ENetFields_Private::RemoteRole].CmdStart];
-						}
-					}
-
-					return Cmd;
-
-				};
-				// This swaps Role/RemoteRole as we write it
-				const FRepLayoutCmd& SwappedCmd = GetSwappedCmd();
+				continue;
+			}
 
-				uint8* Data = (uint8*)&Object + SwappedCmd.Offset;
+			// This swaps Role/RemoteRole as we write it
+			const int32 SwappedOffset = Entry->GetOffset(bSkipRoleSwap);
+			const int32 SwappedShadowOffset = Entry->GetShadowOffset(bSkipRoleSwap);
+			uint8* Data = (uint8*)&Object + SwappedOffset;
 
-				// If the property has RepNotifies, update with local data and possibly initialize the shadow data
-				if (Parent.Property->HasAnyPropertyFlags(CPF_RepNotify))
+			// If the property has RepNotifies, update with local data and possibly initialize the shadow data
+			if (Entry->bHasRepNotify)
+			{
+				FRepStateStaticBuffer& ShadowData = RepState->GetReceivingRepState()->StaticBuffer;
+				if (ShadowData.Num() == 0)
 				{
-					FRepStateStaticBuffer& ShadowData = RepState->GetReceivingRepState()->StaticBuffer;
-					if (ShadowData.Num() == 0)
-					{
-						Channel.ResetShadowData(*Replicator->RepLayout.Get(), ShadowData, &Object);
-					}
-					else
-					{
-						Cmd.Property->CopySingleValue(ShadowData.GetData() + SwappedCmd.ShadowOffset, Data);
-					}
+					Channel.ResetShadowData(*Replicator->RepLayout.Get(), ShadowData, &Object);
 				}
-
-				if (Cmd.Type == ERepLayoutCmdType::DynamicArray)
+				else
 				{
-					GDK_PROPERTY(ArrayProperty)* ArrayProperty = GDK_CASTFIELD<GDK_PROPERTY(ArrayProperty)>(Cmd.Property);
-					if (ArrayProperty == nullptr)
-					{
-						UE_LOG(LogSpatialComponentReader, Error, TEXT("Failed to apply Schema Object %s. One of it's properties is null"),
-							   *Object.GetName());
-						continue;
-					}
+					Entry->Property->CopySingleValue(ShadowData.GetData() + SwappedShadowOffset, Data);
+				}
+			}
 
-					// Check if this is a FastArraySerializer array and if so, call our custom delta serialization
-					if (UScriptStruct* NetDeltaStruct = GetFastArraySerializerProperty(ArrayProperty))
-					{
-						SCOPE_CYCLE_COUNTER(STAT_ReaderApplyFastArrayUpdate);
-
-						// TArray<uint8> ValueData = GetBytesFromSchema(ComponentObject, FieldId); 
-						TArray<uint8> ValueData = IndexBytesFromSchema(ComponentObject, FieldId, Parent.ArrayIndex); // SKY-CELL
-						int64 CountBits = ValueData.Num() * 8;
-						TSet<FUnrealObjectRef> NewMappedRefs;
-						TSet<FUnrealObjectRef> NewUnresolvedRefs;
-						FSpatialNetBitReader ValueDataReader(PackageMap, ValueData.GetData(), CountBits, NewMappedRefs, NewUnresolvedRefs);
-
-						if (ValueData.Num() > 0)
-						{
-							FSpatialNetDeltaSerializeInfo::DeltaSerializeRead(NetDriver, ValueDataReader, &Object, Parent.ArrayIndex,
-																			  Parent.Property, NetDeltaStruct);
-						}
-
-						FObjectReferences* CurEntry = RootObjectReferencesMap.Find(SwappedCmd.Offset);
-						const bool bHasReferences = NewUnresolvedRefs.Num() > 0 || NewMappedRefs.Num() > 0;
-
-						if (ReferencesChanged(RootObjectReferencesMap, SwappedCmd.Offset, bHasReferences, NewMappedRefs, NewUnresolvedRefs))
-						{
-							if (bHasReferences)
-							{
-								RootObjectReferencesMap.Add(
-									SwappedCmd.Offset,
-									FObjectReferences(ValueData, CountBits, MoveTemp(NewMappedRefs), MoveTemp(NewUnresolvedRefs),
-													  ShadowOffset, Cmd.ParentIndex, ArrayProperty, /* bFastArrayProp */ true));
-							}
-							else
-							{
-								RootObjectReferencesMap.Remove(SwappedCmd.Offset);
-							}
-							bOutReferencesChanged = true;
-						}
-					}
-					else
-					{
-						ApplyArray(ComponentObject, isData?FieldId:FieldId, RootObjectReferencesMap, ArrayProperty, Data, SwappedCmd.Offset, ShadowOffset,
-								   Cmd.ParentIndex, bOutReferencesChanged);
-					}
+			switch (Entry->Decoder)
+			{
+			case ERepFieldDecoder::Property:
+				if (Entry->GeneratedDecode != nullptr)
+				{
+					Entry->GeneratedDecode(ComponentObject, FieldId, Data);
+				}
+				else if (Entry->Quantization.Mode != ESpatialQuantization::None)
+				{
+					TArray<uint8> ValueData = IndexBytesFromSchema(ComponentObject, FieldId, 0);
+					FBitReader QuantizedReader(ValueData.GetData(), ValueData.Num() * CHAR_BIT);
+					PropertyQuantization::Read(QuantizedReader, GDK_CASTFIELD<GDK_PROPERTY(StructProperty)>(Entry->Property)->Struct,
+											   Entry->Quantization, Data);
 				}
 				else
 				{
-
-					ApplyProperty(ComponentObject,isData?FieldId:FieldId, RootObjectReferencesMap, 0, Cmd.Property, Data, SwappedCmd.Offset, ShadowOffset,
-								  Cmd.ParentIndex, bOutReferencesChanged);
-
+					ApplyProperty(ComponentObject, FieldId, RootObjectReferencesMap, 0, Entry->Property, Data, SwappedOffset,
+								  Entry->ShadowOffset, Entry->ParentIndex, bOutReferencesChanged);
 				}
+				break;
+			case ERepFieldDecoder::DynamicArray:
+			{
+				const TPair<Schema_FieldId, Schema_Object*>* ArrayDelta = ArrayDeltas.FindByPredicate([FieldId](const auto& Delta) {
+					return Delta.Key == FieldId;
+				});
+				ApplyArray(ComponentObject, FieldId, RootObjectReferencesMap, GDK_CASTFIELD<GDK_PROPERTY(ArrayProperty)>(Entry->Property),
+						   Data, SwappedOffset, Entry->ShadowOffset, Entry->ParentIndex, bOutReferencesChanged,
+						   ArrayDelta != nullptr ? ArrayDelta->Value : nullptr);
+				break;
+			}
+			case ERepFieldDecoder::FastArray:
+				ApplyFastArray(ComponentObject, FieldId, Object, *Entry, SwappedOffset, bOutReferencesChanged);
+				break;
+			default:
+				UE_LOG(LogSpatialComponentReader, Error, TEXT("Failed to apply Schema Object %s. One of it's properties is null"),
+					   *Object.GetName());
+				continue;
+			}
 
-				if (Cmd.Property->GetFName() == NAME_RemoteRole)
+			if (Entry->bIsRemoteRole)
+			{
+				// Downgrade role from AutonomousProxy to SimulatedProxy if we aren't authoritative over
+				// the client RPCs component.
+				GDK_PROPERTY(ByteProperty)* ByteProperty = GDK_CASTFIELD<GDK_PROPERTY(ByteProperty)>(Entry->Property);
+				if (!bIsAuthServer && !bAutonomousProxy && ByteProperty->GetPropertyValue(Data) == ROLE_AutonomousProxy)
 				{
-					// Downgrade role from AutonomousProxy to SimulatedProxy if we aren't authoritative over
-					// the client RPCs component.
-					GDK_PROPERTY(ByteProperty)* ByteProperty = GDK_CASTFIELD<GDK_PROPERTY(ByteProperty)>(Cmd.Property);
-					if (!bIsAuthServer && !bAutonomousProxy && ByteProperty->GetPropertyValue(Data) == ROLE_AutonomousProxy)
-					{
-						ByteProperty->SetPropertyValue(Data, ROLE_SimulatedProxy);
-					}
+					ByteProperty->SetPropertyValue(Data, ROLE_SimulatedProxy);
 				}
+			}
+
+			FSpatialGDKSpanId SpanId;
+			if (bEventTracerEnabled)
+			{
+				const Trace_SpanIdType* Causes = reinterpret_cast<const Trace_SpanIdType*>(CauseSpanIds.GetData());
+				GDK_PROPERTY(Property)* Property = Entry->Property;
+				SpanId = EventTracer->TraceEvent(RECEIVE_PROPERTY_UPDATE_EVENT_NAME, "", Causes, CauseSpanIds.Num(),
+												 [&Object, EntityId, ComponentId, Property](FSpatialTraceEventDataBuilder& EventBuilder) {
+													 EventBuilder.AddObject(&Object);
+													 EventBuilder.AddEntityId(EntityId);
+													 EventBuilder.AddComponentId(ComponentId);
+													 EventBuilder.AddKeyValue("property_name", Property->GetName());
+													 EventBuilder.AddLinearTraceId(EventTraceUniqueId::GenerateForProperty(EntityId, Property));
+												 });
+			}
+
+			// ParentProperty is the "root" replicated property, e.g. if a struct property was flattened
+			if (Entry->bHasRepNotify)
+			{
+				bool bIsIdentical =
+					Entry->Property->Identical(RepState->GetReceivingRepState()->StaticBuffer.GetData() + SwappedShadowOffset, Data);
 
-				FSpatialGDKSpanId SpanId;
 				if (bEventTracerEnabled)
 				{
-					const Trace_SpanIdType* Causes = reinterpret_cast<const Trace_SpanIdType*>(CauseSpanIds.GetData());
-					SpanId = EventTracer->TraceEvent(
-						RECEIVE_PROPERTY_UPDATE_EVENT_NAME, "", Causes, CauseSpanIds.Num(),
-						[&Object, EntityId, ComponentId, Cmd](FSpatialTraceEventDataBuilder& EventBuilder) {
-							EventBuilder.AddObject(&Object);
-							EventBuilder.AddEntityId(EntityId);
-							EventBuilder.AddComponentId(ComponentId);
-							EventBuilder.AddKeyValue("property_name", Cmd.Property->GetName());
-							EventBuilder.AddLinearTraceId(EventTraceUniqueId::GenerateForProperty(EntityId, Cmd.Property));
-						});
+					PropertySpanIds.Add(Entry->ParentProperty, SpanId);
 				}
 
-				// Parent.Property is the "root" replicated property, e.g. if a struct property was flattened
-				if (Parent.Property->HasAnyPropertyFlags(CPF_RepNotify))
+				// Only call RepNotify for REPNOTIFY_Always if we are not applying initial data.
+				if (bIsInitialData)
 				{
-					bool bIsIdentical =
-						Cmd.Property->Identical(RepState->GetReceivingRepState()->StaticBuffer.GetData() + SwappedCmd.ShadowOffset, Data);
-
-					if (bEventTracerEnabled)
+					if (!bIsIdentical)
 					{
-						PropertySpanIds.Add(Parent.Property, SpanId);
+						RepNotifies.AddUnique(Entry->ParentProperty);
 					}
-
-					// Only call RepNotify for REPNOTIFY_Always if we are not applying initial data.
-					if (bIsInitialData)
-					{
-						if (!bIsIdentical)
-						{
-							RepNotifies.AddUnique(Parent.Property);
-						}
-					}
-					else
+				}
+				else
+				{
+					if (Entry->RepNotifyCondition == REPNOTIFY_Always || !bIsIdentical)
 					{
-						if (Parent.RepNotifyCondition == REPNOTIFY_Always || !bIsIdentical)
-						{
-							RepNotifies.AddUnique(Parent.Property);
-						}
+						RepNotifies.AddUnique(Entry->ParentProperty);
 					}
 				}
 			}
@@ -391,6 +367,47 @@ void ComponentReader::ApplySchemaObject(Schema_Object* ComponentObject, UObject&
 	Channel.PostReceiveSpatialUpdate(&Object, RepNotifies, PropertySpanIds);
 }
 
+const FRepFieldDispatchTable& ComponentReader::GetDispatchTable(UObject& Object, const FRepLayout& RepLayout)
+{
+	return ClassInfoManager->GetFieldDispatchTable(Object.GetClass(), RepLayout);
+}
+
+void ComponentReader::ApplyFastArray(Schema_Object* ComponentObject, Schema_FieldId FieldId, UObject& Object,
+									 const FRepFieldDispatchEntry& Entry, int32 Offset, bool& bOutReferencesChanged)
+{
+	SCOPE_CYCLE_COUNTER(STAT_ReaderApplyFastArrayUpdate);
+
+	TArray<uint8> ValueData = IndexBytesFromSchema(ComponentObject, FieldId, Entry.ParentArrayIndex); // SKY-CELL
+	int64 CountBits = ValueData.Num() * 8;
+	TSet<FUnrealObjectRef> NewMappedRefs;
+	TSet<FUnrealObjectRef> NewUnresolvedRefs;
+	FSpatialNetBitReader ValueDataReader(PackageMap, ValueData.GetData(), CountBits, NewMappedRefs, NewUnresolvedRefs);
+
+	if (ValueData.Num() > 0)
+	{
+		FSpatialNetDeltaSerializeInfo::DeltaSerializeRead(NetDriver, ValueDataReader, &Object, Entry.ParentArrayIndex, Entry.ParentProperty,
+														  Entry.FastArrayStruct);
+	}
+
+	const bool bHasReferences = NewUnresolvedRefs.Num() > 0 || NewMappedRefs.Num() > 0;
+
+	if (ReferencesChanged(RootObjectReferencesMap, Offset, bHasReferences, NewMappedRefs, NewUnresolvedRefs))
+	{
+		if (bHasReferences)
+		{
+			RootObjectReferencesMap.Add(Offset, FObjectReferences(ValueData, CountBits, MoveTemp(NewMappedRefs), MoveTemp(NewUnresolvedRefs),
+																  Entry.ShadowOffset, Entry.ParentIndex,
+																  GDK_CASTFIELD<GDK_PROPERTY(ArrayProperty)>(Entry.Property),
+																  /* bFastArrayProp */ true));
+		}
+		else
+		{
+			RootObjectReferencesMap.Remove(Offset);
+		}
+		bOutReferencesChanged = true;
+	}
+}
+
 void ComponentReader::ApplyProperty(Schema_Object* Object, Schema_FieldId FieldId, FObjectReferencesMap& InObjectReferencesMap,
 									uint32 Index, GDK_PROPERTY(Property) * Property, uint8* Data, int32 Offset, int32 ShadowOffset,
 									int32 ParentIndex, bool& bOutReferencesChanged)
@@ -471,7 +488,7 @@ void ComponentReader::ApplyProperty(Schema_Object* Object, Schema_FieldId FieldI
 	}
 	else if (GDK_PROPERTY(ObjectPropertyBase)* ObjectProperty = GDK_CASTFIELD<GDK_PROPERTY(ObjectPropertyBase)>(Property))
 	{
-		FUnrealObjectRef ObjectRef = IndexObjectRefFromSchema(Object, FieldId,Index);
+		FUnrealObjectRef ObjectRef = IndexObjectRefFromSchema(Object, FieldId,Index, &ClassInfoManager->GetInternedObjectPaths());
 		check(ObjectRef != FUnrealObjectRef::UNRESOLVED_OBJECT_REF);
 
 		if (GDK_CASTFIELD<GDK_PROPERTY(SoftObjectProperty)>(Property))
@@ -544,7 +561,7 @@ void ComponentReader::ApplyProperty(Schema_Object* Object, Schema_FieldId FieldI
 
 void ComponentReader::ApplyArray(Schema_Object* Object, Schema_FieldId FieldId, FObjectReferencesMap& InObjectReferencesMap,
 								 GDK_PROPERTY(ArrayProperty) * Property, uint8* Data, int32 Offset, int32 ShadowOffset, int32 ParentIndex,
-								 bool& bOutReferencesChanged)
+								 bool& bOutReferencesChanged, Schema_Object* ArrayDelta /*= nullptr*/)
 {
 	SCOPE_CYCLE_COUNTER(STAT_ReaderApplyArray);
 
@@ -564,16 +581,48 @@ void ComponentReader::ApplyArray(Schema_Object* Object, Schema_FieldId FieldId,
 
 	FScriptArrayHelper ArrayHelper(Property, Data);
 
-	int Count = GetPropertyCount(Object, FieldId, Property->Inner);
-	ArrayHelper.Resize(Count);
+	if (ArrayDelta == nullptr)
+	{
+		int Count = GetPropertyCount(Object, FieldId, Property->Inner);
+		ArrayHelper.Resize(Count);
 
-	ArrayObjectReferences->Empty(Count);
+		ArrayObjectReferences->Empty(Count);
 
-	for (int i = 0; i < Count; i++)
+		for (int i = 0; i < Count; i++)
+		{
+			int32 ElementOffset = i * Property->Inner->ElementSize;
+			ApplyProperty(Object, FieldId, *ArrayObjectReferences, i, Property->Inner, ArrayHelper.GetRawPtr(i), ElementOffset,
+						  ElementOffset, ParentIndex, bOutReferencesChanged);
+		}
+	}
+	else
 	{
-		int32 ElementOffset = i * Property->Inner->ElementSize;
-		ApplyProperty(Object, FieldId, *ArrayObjectReferences, i, Property->Inner, ArrayHelper.GetRawPtr(i), ElementOffset, ElementOffset,
-					  ParentIndex, bOutReferencesChanged);
+		// Elements that aren't in the delta keep their values and references, only the ones past the new length are dropped.
+		const int32 Count = Schema_GetUint32(ArrayDelta, SpatialConstants::ARRAY_DELTA_LENGTH_ID);
+		ArrayHelper.Resize(Count);
+
+		const int32 EndOffset = Count * Property->Inner->ElementSize;
+		for (auto It = ArrayObjectReferences->CreateIterator(); It; ++It)
+		{
+			if (It.Key() >= EndOffset)
+			{
+				It.RemoveCurrent();
+				bOutReferencesChanged = true;
+			}
+		}
+
+		const uint32 ChangedCount = Schema_GetUint32Count(ArrayDelta, SpatialConstants::ARRAY_DELTA_INDICES_ID);
+		for (uint32 ChangedIndex = 0; ChangedIndex < ChangedCount; ++ChangedIndex)
+		{
+			const int32 ElementIndex = Schema_IndexUint32(ArrayDelta, SpatialConstants::ARRAY_DELTA_INDICES_ID, ChangedIndex);
+			if (ElementIndex >= Count)
+			{
+				continue;
+			}
+			const int32 ElementOffset = ElementIndex * Property->Inner->ElementSize;
+			ApplyProperty(Object, FieldId, *ArrayObjectReferences, ElementIndex, Property->Inner, ArrayHelper.GetRawPtr(ElementIndex),
+						  ElementOffset, ElementOffset, ParentIndex, bOutReferencesChanged);
+		}
 	}
 
 	if (ArrayObjectReferences->Num() > 0)
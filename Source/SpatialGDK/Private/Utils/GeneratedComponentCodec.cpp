@@ -0,0 +1,23 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/GeneratedComponentCodec.h"
+
+namespace SpatialGDK
+{
+FGeneratedCodecRegistry& FGeneratedCodecRegistry::Get()
+{
+	static FGeneratedCodecRegistry Registry;
+	return Registry;
+}
+
+void FGeneratedCodecRegistry::Register(const FGeneratedClassCodec& Codec)
+{
+	Codecs.Add(Codec.ClassPath, &Codec);
+}
+
+const FGeneratedClassCodec* FGeneratedCodecRegistry::Find(const FString& ClassPath) const
+{
+	const FGeneratedClassCodec* const* Codec = Codecs.Find(ClassPath);
+	return Codec != nullptr ? *Codec : nullptr;
+}
+} // namespace SpatialGDK
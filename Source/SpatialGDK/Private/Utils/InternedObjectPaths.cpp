@@ -0,0 +1,51 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/InternedObjectPaths.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogInternedObjectPaths, Log, All);
+
+namespace SpatialGDK
+{
+void FInternedObjectPaths::Init(TArrayView<const FString> InPaths)
+{
+	Paths = TArray<FString>(InPaths.GetData(), InPaths.Num());
+
+	PathToId.Reset();
+	PathToId.Reserve(Paths.Num());
+	Hash = 0;
+	for (int32 Index = 0; Index < Paths.Num(); ++Index)
+	{
+		PathToId.Add(Paths[Index], Index + 1);
+		Hash = FCrc::StrCrc32(*Paths[Index], Hash);
+	}
+}
+
+uint32 FInternedObjectPaths::FindId(const FString& Path) const
+{
+	if (!bSendIds)
+	{
+		return 0;
+	}
+
+	const uint32* Id = PathToId.Find(Path);
+
+	// Map keys ignore case, but the receiver has to get back the exact path.
+	if (Id == nullptr || !Paths[*Id - 1].Equals(Path, ESearchCase::CaseSensitive))
+	{
+		return 0;
+	}
+	return *Id;
+}
+
+const FString* FInternedObjectPaths::FindPath(uint32 Id) const
+{
+	if (!Paths.IsValidIndex((int32)Id - 1))
+	{
+		UE_LOG(LogInternedObjectPaths, Error,
+			   TEXT("Received unknown interned object path %u, the sending worker was likely built with a different schema database."),
+			   Id);
+		return nullptr;
+	}
+	return &Paths[Id - 1];
+}
+} // namespace SpatialGDK
@@ -0,0 +1,102 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/LatencyHistogram.h"
+
+namespace SpatialGDK
+{
+FLatencyHistogram::FLatencyHistogram()
+{
+	Reset();
+}
+
+void FLatencyHistogram::RecordValue(uint64 Value)
+{
+	Counts[GetBucketIndex(Value)]++;
+	TotalCount++;
+	Sum += Value;
+	MinValue = FMath::Min(MinValue, Value);
+	MaxValue = FMath::Max(MaxValue, Value);
+}
+
+void FLatencyHistogram::RecordMicrosecondsSince(uint64 StartCycles)
+{
+	const uint64 NowCycles = FPlatformTime::Cycles64();
+	RecordValue(NowCycles > StartCycles ? CyclesToMicroseconds(NowCycles - StartCycles) : 0);
+}
+
+void FLatencyHistogram::Merge(const FLatencyHistogram& Other)
+{
+	for (int32 BucketIndex = 0; BucketIndex < NumBuckets; ++BucketIndex)
+	{
+		Counts[BucketIndex] += Other.Counts[BucketIndex];
+	}
+	TotalCount += Other.TotalCount;
+	Sum += Other.Sum;
+	MinValue = FMath::Min(MinValue, Other.MinValue);
+	MaxValue = FMath::Max(MaxValue, Other.MaxValue);
+}
+
+void FLatencyHistogram::Reset()
+{
+	FMemory::Memzero(Counts, sizeof(Counts));
+	TotalCount = 0;
+	Sum = 0;
+	MinValue = TNumericLimits<uint64>::Max();
+	MaxValue = 0;
+}
+
+uint64 FLatencyHistogram::GetValueAtPercentile(double Percentile) const
+{
+	if (TotalCount == 0)
+	{
+		return 0;
+	}
+
+	const double ClampedPercentile = FMath::Clamp(Percentile, 0.0, 100.0);
+	const uint64 TargetCount = FMath::Max<uint64>(1, static_cast<uint64>(FMath::CeilToDouble(ClampedPercentile / 100.0 * TotalCount)));
+
+	uint64 CumulativeCount = 0;
+	for (int32 BucketIndex = 0; BucketIndex < NumBuckets; ++BucketIndex)
+	{
+		CumulativeCount += Counts[BucketIndex];
+		if (CumulativeCount >= TargetCount)
+		{
+			return FMath::Clamp(GetBucketHighestValue(BucketIndex), GetMin(), MaxValue);
+		}
+	}
+
+	return MaxValue;
+}
+
+uint64 FLatencyHistogram::CyclesToMicroseconds(uint64 Cycles)
+{
+	return static_cast<uint64>(FPlatformTime::ToMilliseconds64(Cycles) * 1000.0);
+}
+
+int32 FLatencyHistogram::GetBucketIndex(uint64 Value)
+{
+	if (Value < SubBucketCount)
+	{
+		return static_cast<int32>(Value);
+	}
+
+	const int32 ValueLog2 = FMath::Min(static_cast<int32>(FMath::FloorLog2_64(Value)), MaxValueLog2);
+	const int32 Shift = ValueLog2 - SubBucketBits;
+	const uint64 ClampedValue = FMath::Min(Value, (uint64(1) << (MaxValueLog2 + 1)) - 1);
+	const int32 SubBucket = static_cast<int32>((ClampedValue >> Shift) - SubBucketCount);
+	return SubBucketCount + Shift * SubBucketCount + SubBucket;
+}
+
+uint64 FLatencyHistogram::GetBucketHighestValue(int32 BucketIndex)
+{
+	if (BucketIndex < SubBucketCount)
+	{
+		return BucketIndex;
+	}
+
+	const int32 Shift = (BucketIndex - SubBucketCount) / SubBucketCount;
+	const uint64 SubBucket = (BucketIndex - SubBucketCount) % SubBucketCount;
+	const uint64 LowestValue = (SubBucketCount + SubBucket) << Shift;
+	return LowestValue + (uint64(1) << Shift) - 1;
+}
+} // namespace SpatialGDK
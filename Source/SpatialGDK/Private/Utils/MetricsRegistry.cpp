@@ -0,0 +1,159 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/MetricsRegistry.h"
+
+#include "HAL/PlatformTLS.h"
+
+#include "Utils/SpatialMetrics.h"
+
+namespace SpatialGDK
+{
+namespace
+{
+std::atomic<uint32> NextRegistryId{ 0 };
+
+struct FThreadCountersCacheEntry
+{
+	uint32 RegistryId;
+	void* Counters;
+};
+
+// Threads such as the game thread outlive many registries, so only the most recently used ones are cached, most recent first.
+// Registry IDs are never reused, so entries of destroyed registries are never matched again and sink to the back, where they are evicted.
+constexpr int32 MaxCachedRegistries = 4;
+thread_local TArray<FThreadCountersCacheEntry, TInlineAllocator<MaxCachedRegistries>> ThreadCountersCache;
+} // namespace
+
+FMetricsRegistry::FThreadCounters::FThreadCounters(uint32 InThreadId)
+	: ThreadId(InThreadId)
+{
+	for (std::atomic<int64>& Value : Values)
+	{
+		Value.store(0, std::memory_order_relaxed);
+	}
+}
+
+FMetricsRegistry::FMetricsRegistry()
+	: RegistryId(NextRegistryId.fetch_add(1))
+{
+}
+
+FMetricsRegistry::~FMetricsRegistry() = default;
+
+FMetricHandle FMetricsRegistry::RegisterCounter(FName Name)
+{
+	FScopeLock Lock(&Mutex);
+
+	const int32 ExistingIndex = Names.IndexOfByKey(Name);
+	if (ExistingIndex != INDEX_NONE)
+	{
+		FMetricHandle Handle;
+		Handle.Index = ExistingIndex;
+		return Handle;
+	}
+
+	if (Names.Num() >= MaxCounters)
+	{
+		UE_LOG(LogSpatialMetrics, Warning, TEXT("Could not register metric %s, the registry is full (%d counters)."), *Name.ToString(),
+			   MaxCounters);
+		return FMetricHandle();
+	}
+
+	FMetricHandle Handle;
+	Handle.Index = Names.Add(Name);
+	Baselines.Add(GetMergedValue(Handle.Index));
+	return Handle;
+}
+
+int64 FMetricsRegistry::GetValue(FMetricHandle Handle) const
+{
+	if (!Handle.IsValid())
+	{
+		return 0;
+	}
+
+	FScopeLock Lock(&Mutex);
+	return GetMergedValue(Handle.Index) - Baselines[Handle.Index];
+}
+
+FName FMetricsRegistry::GetName(FMetricHandle Handle) const
+{
+	FScopeLock Lock(&Mutex);
+	return Handle.IsValid() ? Names[Handle.Index] : NAME_None;
+}
+
+int32 FMetricsRegistry::GetNumCounters() const
+{
+	FScopeLock Lock(&Mutex);
+	return Names.Num();
+}
+
+void FMetricsRegistry::Reset()
+{
+	FScopeLock Lock(&Mutex);
+	for (int32 Index = 0; Index < Names.Num(); ++Index)
+	{
+		Baselines[Index] = GetMergedValue(Index);
+	}
+}
+
+FMetricsRegistry::FThreadCounters& FMetricsRegistry::GetThreadCounters()
+{
+	for (int32 Index = 0; Index < ThreadCountersCache.Num(); ++Index)
+	{
+		const FThreadCountersCacheEntry Entry = ThreadCountersCache[Index];
+		if (Entry.RegistryId == RegistryId)
+		{
+			for (; Index > 0; --Index)
+			{
+				ThreadCountersCache[Index] = ThreadCountersCache[Index - 1];
+			}
+			ThreadCountersCache[0] = Entry;
+			return *static_cast<FThreadCounters*>(Entry.Counters);
+		}
+	}
+
+	return FindOrAddThreadCounters();
+}
+
+FMetricsRegistry::FThreadCounters& FMetricsRegistry::FindOrAddThreadCounters()
+{
+	const uint32 ThreadId = FPlatformTLS::GetCurrentThreadId();
+	FThreadCounters* Counters = nullptr;
+	{
+		FScopeLock Lock(&Mutex);
+
+		// The thread may have used this registry before its cache entry was evicted.
+		for (const TUniquePtr<FThreadCounters>& ExistingCounters : ThreadCounters)
+		{
+			if (ExistingCounters->ThreadId == ThreadId)
+			{
+				Counters = ExistingCounters.Get();
+				break;
+			}
+		}
+
+		if (Counters == nullptr)
+		{
+			Counters = ThreadCounters.Add_GetRef(MakeUnique<FThreadCounters>(ThreadId)).Get();
+		}
+	}
+
+	if (ThreadCountersCache.Num() >= MaxCachedRegistries)
+	{
+		ThreadCountersCache.Pop(/* bAllowShrinking */ false);
+	}
+	ThreadCountersCache.Insert(FThreadCountersCacheEntry{ RegistryId, Counters }, 0);
+	return *Counters;
+}
+
+int64 FMetricsRegistry::GetMergedValue(int32 Index) const
+{
+	int64 Value = 0;
+	for (const TUniquePtr<FThreadCounters>& Counters : ThreadCounters)
+	{
+		Value += Counters->Values[Index].load(std::memory_order_relaxed);
+	}
+	return Value;
+}
+} // namespace SpatialGDK
@@ -0,0 +1,135 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/NetworkFrameProfiler.h"
+
+#include "Misc/OutputDevice.h"
+
+namespace SpatialGDK
+{
+FNetworkFrameProfiler::FNetworkFrameProfiler(int32 InWindowSize)
+{
+	Window.SetNum(FMath::Max(InWindowSize, 1));
+}
+
+void FNetworkFrameProfiler::EndFrame()
+{
+	Window[NextFrameIndex] = CurrentFrame;
+	NextFrameIndex = (NextFrameIndex + 1) % Window.Num();
+	NumFrames = FMath::Min(NumFrames + 1, Window.Num());
+	CurrentFrame = FFrame();
+}
+
+template <typename GetValueFunc>
+TArray<uint64> FNetworkFrameProfiler::GetSortedValues(GetValueFunc&& GetValue) const
+{
+	TArray<uint64> Values;
+	Values.Reserve(NumFrames);
+	for (int32 FrameIndex = 0; FrameIndex < NumFrames; ++FrameIndex)
+	{
+		Values.Add(GetValue(Window[FrameIndex]));
+	}
+	Values.Sort();
+	return Values;
+}
+
+uint64 FNetworkFrameProfiler::GetPercentile(const TArray<uint64>& SortedValues, double Percentile)
+{
+	if (SortedValues.Num() == 0)
+	{
+		return 0;
+	}
+
+	const double Rank = FMath::Clamp(Percentile, 0.0, 100.0) / 100.0 * (SortedValues.Num() - 1);
+	return SortedValues[FMath::RoundToInt(Rank)];
+}
+
+double FNetworkFrameProfiler::GetStagePercentileMicroseconds(ENetworkFrameStage Stage, double Percentile) const
+{
+	const uint8 StageIndex = static_cast<uint8>(Stage);
+	const TArray<uint64> Values = GetSortedValues([StageIndex](const FFrame& Frame) {
+		return Frame.StageCycles[StageIndex];
+	});
+	return FPlatformTime::ToMilliseconds64(GetPercentile(Values, Percentile)) * 1000.0;
+}
+
+uint64 FNetworkFrameProfiler::GetCounterPercentile(ENetworkFrameCounter Counter, double Percentile) const
+{
+	const uint8 CounterIndex = static_cast<uint8>(Counter);
+	const TArray<uint64> Values = GetSortedValues([CounterIndex](const FFrame& Frame) {
+		return Frame.Counters[CounterIndex];
+	});
+	return GetPercentile(Values, Percentile);
+}
+
+void FNetworkFrameProfiler::DumpSummary(FOutputDevice& Ar) const
+{
+	Ar.Logf(TEXT("Network frame profile over the last %d frames (p50 / p90 / p99 / max):"), NumFrames);
+
+	for (uint8 StageIndex = 0; StageIndex < static_cast<uint8>(ENetworkFrameStage::Count); ++StageIndex)
+	{
+		const ENetworkFrameStage Stage = static_cast<ENetworkFrameStage>(StageIndex);
+		Ar.Logf(TEXT("  %-24s %9.1fus %9.1fus %9.1fus %9.1fus"), GetStageName(Stage), GetStagePercentileMicroseconds(Stage, 50.0),
+				GetStagePercentileMicroseconds(Stage, 90.0), GetStagePercentileMicroseconds(Stage, 99.0),
+				GetStagePercentileMicroseconds(Stage, 100.0));
+	}
+
+	for (uint8 CounterIndex = 0; CounterIndex < static_cast<uint8>(ENetworkFrameCounter::Count); ++CounterIndex)
+	{
+		const ENetworkFrameCounter Counter = static_cast<ENetworkFrameCounter>(CounterIndex);
+		Ar.Logf(TEXT("  %-24s %11llu %11llu %11llu %11llu"), GetCounterName(Counter), GetCounterPercentile(Counter, 50.0),
+				GetCounterPercentile(Counter, 90.0), GetCounterPercentile(Counter, 99.0), GetCounterPercentile(Counter, 100.0));
+	}
+}
+
+const TCHAR* FNetworkFrameProfiler::GetStageName(ENetworkFrameStage Stage)
+{
+	switch (Stage)
+	{
+	case ENetworkFrameStage::ConnectionAdvance:
+		return TEXT("ConnectionAdvance");
+	case ENetworkFrameStage::OpRetrieval:
+		return TEXT("OpRetrieval");
+	case ENetworkFrameStage::ViewDelta:
+		return TEXT("ViewDelta");
+	case ENetworkFrameStage::DispatcherCallbacks:
+		return TEXT("DispatcherCallbacks");
+	case ENetworkFrameStage::SubViewAdvance:
+		return TEXT("SubViewAdvance");
+	case ENetworkFrameStage::ActorSystemRemoves:
+		return TEXT("ActorSystemRemoves");
+	case ENetworkFrameStage::ActorSystemUpdates:
+		return TEXT("ActorSystemUpdates");
+	case ENetworkFrameStage::ActorSystemAdds:
+		return TEXT("ActorSystemAdds");
+	case ENetworkFrameStage::ProcessOps:
+		return TEXT("ProcessOps");
+	case ENetworkFrameStage::RPCServices:
+		return TEXT("RPCServices");
+	case ENetworkFrameStage::ServerReplicateActors:
+		return TEXT("ServerReplicateActors");
+	case ENetworkFrameStage::Flush:
+		return TEXT("Flush");
+	default:
+		checkNoEntry();
+		return TEXT("");
+	}
+}
+
+const TCHAR* FNetworkFrameProfiler::GetCounterName(ENetworkFrameCounter Counter)
+{
+	switch (Counter)
+	{
+	case ENetworkFrameCounter::OpsReceived:
+		return TEXT("OpsReceived");
+	case ENetworkFrameCounter::EntityDeltas:
+		return TEXT("EntityDeltas");
+	case ENetworkFrameCounter::RPCPayloadBytesSent:
+		return TEXT("RPCPayloadBytesSent");
+	case ENetworkFrameCounter::ActorsReplicated:
+		return TEXT("ActorsReplicated");
+	default:
+		checkNoEntry();
+		return TEXT("");
+	}
+}
+} // namespace SpatialGDK
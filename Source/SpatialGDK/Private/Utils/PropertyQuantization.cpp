@@ -0,0 +1,254 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/PropertyQuantization.h"
+
+#include "Engine/EngineTypes.h"
+
+namespace SpatialGDK
+{
+namespace PropertyQuantization
+{
+namespace
+{
+constexpr uint8 MovementRotationBits = 16;
+// No component but the largest of a unit quaternion can be above 1/sqrt(2).
+constexpr double SmallestThreeBounds = 0.70710678118654752;
+
+// Values are written as a signed multiple of the step, so 0 and both bounds are represented exactly.
+// One of the 2^Bits codes is left unused to keep the range symmetric.
+uint32 GetMaxMagnitude(uint8 Bits)
+{
+	return (1u << (Bits - 1)) - 1;
+}
+
+void WriteFixedPoint(FBitWriter& Writer, double Value, double Bounds, uint8 Bits)
+{
+	const uint32 MaxMagnitude = GetMaxMagnitude(Bits);
+	const double Step = Bounds / MaxMagnitude;
+	const int64 Quantized = static_cast<int64>(FMath::RoundToDouble(FMath::Clamp(Value, -Bounds, Bounds) / Step));
+	Writer.WriteInt(static_cast<uint32>(Quantized + MaxMagnitude), 1u << Bits);
+}
+
+double ReadFixedPoint(FBitReader& Reader, double Bounds, uint8 Bits)
+{
+	const uint32 MaxMagnitude = GetMaxMagnitude(Bits);
+	const int64 Quantized = static_cast<int64>(Reader.ReadInt(1u << Bits)) - MaxMagnitude;
+	// Multiplying first keeps the bounds exact.
+	return Quantized * Bounds / MaxMagnitude;
+}
+
+void WriteVector(FBitWriter& Writer, const FVector& Value, double Bounds, uint8 Bits)
+{
+	WriteFixedPoint(Writer, Value.X, Bounds, Bits);
+	WriteFixedPoint(Writer, Value.Y, Bounds, Bits);
+	WriteFixedPoint(Writer, Value.Z, Bounds, Bits);
+}
+
+FVector ReadVector(FBitReader& Reader, double Bounds, uint8 Bits)
+{
+	FVector Value;
+	Value.X = static_cast<float>(ReadFixedPoint(Reader, Bounds, Bits));
+	Value.Y = static_cast<float>(ReadFixedPoint(Reader, Bounds, Bits));
+	Value.Z = static_cast<float>(ReadFixedPoint(Reader, Bounds, Bits));
+	return Value;
+}
+
+void WriteAngle(FBitWriter& Writer, float Angle, uint8 Bits)
+{
+	// Wraps, so 360 degrees is written as 0.
+	const uint32 NumSteps = 1u << Bits;
+	const double Turns = FRotator::ClampAxis(Angle) / 360.0;
+	Writer.WriteInt(static_cast<uint32>(FMath::RoundToDouble(Turns * NumSteps)) & (NumSteps - 1), NumSteps);
+}
+
+float ReadAngle(FBitReader& Reader, uint8 Bits)
+{
+	const uint32 NumSteps = 1u << Bits;
+	return static_cast<float>(static_cast<double>(Reader.ReadInt(NumSteps)) * 360.0 / NumSteps);
+}
+
+void WriteRotator(FBitWriter& Writer, const FRotator& Value, uint8 Bits)
+{
+	WriteAngle(Writer, Value.Pitch, Bits);
+	WriteAngle(Writer, Value.Yaw, Bits);
+	WriteAngle(Writer, Value.Roll, Bits);
+}
+
+FRotator ReadRotator(FBitReader& Reader, uint8 Bits)
+{
+	FRotator Value;
+	Value.Pitch = ReadAngle(Reader, Bits);
+	Value.Yaw = ReadAngle(Reader, Bits);
+	Value.Roll = ReadAngle(Reader, Bits);
+	return Value;
+}
+
+void WriteQuat(FBitWriter& Writer, const FQuat& Value, uint8 Bits)
+{
+	const FQuat Normalized = Value.GetNormalized();
+	const float Components[4] = { Normalized.X, Normalized.Y, Normalized.Z, Normalized.W };
+
+	uint32 LargestIndex = 0;
+	for (uint32 Index = 1; Index < 4; ++Index)
+	{
+		if (FMath::Abs(Components[Index]) > FMath::Abs(Components[LargestIndex]))
+		{
+			LargestIndex = Index;
+		}
+	}
+
+	// Q and -Q are the same rotation, flipping the sign keeps the rebuilt largest component positive.
+	const float Sign = Components[LargestIndex] < 0.f ? -1.f : 1.f;
+
+	Writer.WriteInt(LargestIndex, 4);
+	for (uint32 Index = 0; Index < 4; ++Index)
+	{
+		if (Index != LargestIndex)
+		{
+			WriteFixedPoint(Writer, Sign * Components[Index], SmallestThreeBounds, Bits);
+		}
+	}
+}
+
+FQuat ReadQuat(FBitReader& Reader, uint8 Bits)
+{
+	const uint32 LargestIndex = Reader.ReadInt(4);
+
+	float Components[4];
+	double SumOfSquares = 0.0;
+	for (uint32 Index = 0; Index < 4; ++Index)
+	{
+		if (Index != LargestIndex)
+		{
+			Components[Index] = static_cast<float>(ReadFixedPoint(Reader, SmallestThreeBounds, Bits));
+			SumOfSquares += FMath::Square(Components[Index]);
+		}
+	}
+	Components[LargestIndex] = static_cast<float>(FMath::Sqrt(FMath::Max(0.0, 1.0 - SumOfSquares)));
+
+	return FQuat(Components[0], Components[1], Components[2], Components[3]);
+}
+
+double GetVelocityBounds(const FPropertyQuantization& Quantization)
+{
+	return Quantization.VelocityBounds > 0.f ? Quantization.VelocityBounds : DefaultVelocityBounds;
+}
+
+void WriteMovement(FBitWriter& Writer, const FRepMovement& Value, const FPropertyQuantization& Quantization)
+{
+	const double VelocityBounds = GetVelocityBounds(Quantization);
+
+	Writer.WriteBit(Value.bSimulatedPhysicSleep);
+	Writer.WriteBit(Value.bRepPhysics);
+
+	WriteVector(Writer, Value.Location, Quantization.Bounds, Quantization.Bits);
+	WriteRotator(Writer, Value.Rotation, MovementRotationBits);
+	WriteVector(Writer, Value.LinearVelocity, VelocityBounds, Quantization.Bits);
+
+	// Like FRepMovement::NetSerialize, the angular velocity is only used by physics replication.
+	if (Value.bRepPhysics)
+	{
+		WriteVector(Writer, Value.AngularVelocity, VelocityBounds, Quantization.Bits);
+	}
+}
+
+void ReadMovement(FBitReader& Reader, FRepMovement& Value, const FPropertyQuantization& Quantization)
+{
+	const double VelocityBounds = GetVelocityBounds(Quantization);
+
+	Value.bSimulatedPhysicSleep = Reader.ReadBit();
+	Value.bRepPhysics = Reader.ReadBit();
+
+	Value.Location = ReadVector(Reader, Quantization.Bounds, Quantization.Bits);
+	Value.Rotation = ReadRotator(Reader, MovementRotationBits);
+	Value.LinearVelocity = ReadVector(Reader, VelocityBounds, Quantization.Bits);
+
+	if (Value.bRepPhysics)
+	{
+		Value.AngularVelocity = ReadVector(Reader, VelocityBounds, Quantization.Bits);
+	}
+	else
+	{
+		Value.AngularVelocity = FVector::ZeroVector;
+	}
+}
+} // anonymous namespace
+
+bool IsSupported(const UScriptStruct* Struct, const FPropertyQuantization& Quantization)
+{
+	if (Quantization.Bits == 0 || Quantization.Bits > MaxBits)
+	{
+		return false;
+	}
+
+	switch (Quantization.Mode)
+	{
+	case ESpatialQuantization::FixedPoint:
+		// The sign takes one bit, so at least one more is needed for the magnitude.
+		return Quantization.Bits >= 2 && Quantization.Bounds > 0.f && Quantization.VelocityBounds >= 0.f
+			   && (Struct == TBaseStructure<FVector>::Get() || Struct == FRepMovement::StaticStruct());
+	case ESpatialQuantization::Angle:
+		return Struct == TBaseStructure<FRotator>::Get();
+	case ESpatialQuantization::SmallestThree:
+		// The three smallest components are written as fixed point too.
+		return Quantization.Bits >= 2 && Struct == TBaseStructure<FQuat>::Get();
+	default:
+		return false;
+	}
+}
+
+void Write(FBitWriter& Writer, const UScriptStruct* Struct, const FPropertyQuantization& Quantization, const uint8* Data)
+{
+	checkSlow(IsSupported(Struct, Quantization));
+
+	switch (Quantization.Mode)
+	{
+	case ESpatialQuantization::FixedPoint:
+		if (Struct == FRepMovement::StaticStruct())
+		{
+			WriteMovement(Writer, *reinterpret_cast<const FRepMovement*>(Data), Quantization);
+		}
+		else
+		{
+			WriteVector(Writer, *reinterpret_cast<const FVector*>(Data), Quantization.Bounds, Quantization.Bits);
+		}
+		break;
+	case ESpatialQuantization::Angle:
+		WriteRotator(Writer, *reinterpret_cast<const FRotator*>(Data), Quantization.Bits);
+		break;
+	case ESpatialQuantization::SmallestThree:
+		WriteQuat(Writer, *reinterpret_cast<const FQuat*>(Data), Quantization.Bits);
+		break;
+	default:
+		checkNoEntry();
+	}
+}
+
+void Read(FBitReader& Reader, const UScriptStruct* Struct, const FPropertyQuantization& Quantization, uint8* Data)
+{
+	checkSlow(IsSupported(Struct, Quantization));
+
+	switch (Quantization.Mode)
+	{
+	case ESpatialQuantization::FixedPoint:
+		if (Struct == FRepMovement::StaticStruct())
+		{
+			ReadMovement(Reader, *reinterpret_cast<FRepMovement*>(Data), Quantization);
+		}
+		else
+		{
+			*reinterpret_cast<FVector*>(Data) = ReadVector(Reader, Quantization.Bounds, Quantization.Bits);
+		}
+		break;
+	case ESpatialQuantization::Angle:
+		*reinterpret_cast<FRotator*>(Data) = ReadRotator(Reader, Quantization.Bits);
+		break;
+	case ESpatialQuantization::SmallestThree:
+		*reinterpret_cast<FQuat*>(Data) = ReadQuat(Reader, Quantization.Bits);
+		break;
+	default:
+		checkNoEntry();
+	}
+}
+} // namespace PropertyQuantization
+} // namespace SpatialGDK
@@ -122,25 +122,31 @@ void FRPCContainer::ProcessOrQueueRPC(const FUnrealObjectRef& TargetObjectRef, c
 
 	if (!ObjectHasRPCsQueuedOfType(Params.ObjectRef.Entity, Params.Type))
 	{
-		const ERPCQueueProcessResult QueueProcessResult = ApplyFunction(Params);
+		TArray<FUnrealObjectRef> UnresolvedRefs;
+		const ERPCQueueProcessResult QueueProcessResult = ApplyFunction(Params, UnresolvedRefs);
 		switch (QueueProcessResult)
 		{
 		case ERPCQueueProcessResult::ContinueProcessing:
 		case ERPCQueueProcessResult::DropEntireQueue:
 			return;
 		}
+
+		BlockQueue(FQueueKey(Type, TargetObjectRef.Entity), Params.Timestamp, MoveTemp(UnresolvedRefs));
 	}
 
 	ArrayOfParams.Push(MoveTemp(Params));
 }
 
-void FRPCContainer::ProcessRPCs(FArrayOfParams& RPCList)
+void FRPCContainer::ProcessQueue(const FQueueKey& Key, FArrayOfParams& RPCList)
 {
+	UnblockQueue(Key);
+
 	// TODO: UNR-1651 Find a way to drop queued RPCs
+	TArray<FUnrealObjectRef> UnresolvedRefs;
 	int NumProcessedParams = 0;
 	for (auto& Params : RPCList)
 	{
-		const ERPCQueueProcessResult QueueProcessResult = ApplyFunction(Params);
+		const ERPCQueueProcessResult QueueProcessResult = ApplyFunction(Params, UnresolvedRefs);
 		switch (QueueProcessResult)
 		{
 		case ERPCQueueProcessResult::ContinueProcessing:
@@ -161,6 +167,11 @@ void FRPCContainer::ProcessRPCs(FArrayOfParams& RPCList)
 	}
 
 	RPCList.RemoveAt(0, NumProcessedParams);
+
+	if (RPCList.Num() > 0)
+	{
+		BlockQueue(Key, RPCList[0].Timestamp, MoveTemp(UnresolvedRefs));
+	}
 }
 
 void FRPCContainer::ProcessRPCs()
@@ -173,13 +184,20 @@ void FRPCContainer::ProcessRPCs()
 
 	bAlreadyProcessingRPCs = true;
 
+	const FDateTime Now = FDateTime::Now();
 	for (auto& RPCs : QueuedRPCs)
 	{
 		FRPCMap& MapOfQueues = RPCs.Value;
 		for (auto It = MapOfQueues.CreateIterator(); It; ++It)
 		{
+			const FQueueKey Key(RPCs.Key, It.Key());
+			if (IsWaitingForRetry(Key, Now))
+			{
+				continue;
+			}
+
 			FArrayOfParams& RPCList = It.Value();
-			ProcessRPCs(RPCList);
+			ProcessQueue(Key, RPCList);
 			if (RPCList.Num() == 0)
 			{
 				It.RemoveCurrent();
@@ -188,16 +206,139 @@ void FRPCContainer::ProcessRPCs()
 	}
 
 	bAlreadyProcessingRPCs = false;
+
+	ProcessDeferredResolvedRefs();
+}
+
+void FRPCContainer::OnObjectRefResolved(const FUnrealObjectRef& ObjectRef)
+{
+	if (!QueuesWaitingOnRef.Contains(ObjectRef))
+	{
+		return;
+	}
+
+	if (bAlreadyProcessingRPCs)
+	{
+		DeferredResolvedRefs.AddUnique(ObjectRef);
+		return;
+	}
+
+	bAlreadyProcessingRPCs = true;
+	ProcessQueuesWaitingOn(ObjectRef);
+	bAlreadyProcessingRPCs = false;
+
+	ProcessDeferredResolvedRefs();
+}
+
+void FRPCContainer::ProcessQueuesWaitingOn(const FUnrealObjectRef& ObjectRef)
+{
+	TArray<FQueueKey> WaitingQueues;
+	if (!QueuesWaitingOnRef.RemoveAndCopyValue(ObjectRef, WaitingQueues))
+	{
+		return;
+	}
+
+	for (const FQueueKey& Key : WaitingQueues)
+	{
+		FRPCMap* MapOfQueues = QueuedRPCs.Find(Key.Key);
+		FArrayOfParams* RPCList = MapOfQueues != nullptr ? MapOfQueues->Find(Key.Value) : nullptr;
+		if (RPCList == nullptr)
+		{
+			UnblockQueue(Key);
+			continue;
+		}
+
+		ProcessQueue(Key, *RPCList);
+		if (RPCList->Num() == 0)
+		{
+			MapOfQueues->Remove(Key.Value);
+		}
+	}
+}
+
+void FRPCContainer::ProcessDeferredResolvedRefs()
+{
+	while (DeferredResolvedRefs.Num() > 0)
+	{
+		TArray<FUnrealObjectRef> ResolvedRefs = MoveTemp(DeferredResolvedRefs);
+		DeferredResolvedRefs.Reset();
+
+		bAlreadyProcessingRPCs = true;
+		for (const FUnrealObjectRef& ObjectRef : ResolvedRefs)
+		{
+			ProcessQueuesWaitingOn(ObjectRef);
+		}
+		bAlreadyProcessingRPCs = false;
+	}
 }
 
 void FRPCContainer::DropForEntity(const Worker_EntityId& EntityId)
 {
 	for (auto& RpcMap : QueuedRPCs)
 	{
+		UnblockQueue(FQueueKey(RpcMap.Key, EntityId));
 		RpcMap.Value.Remove(EntityId);
 	}
 }
 
+void FRPCContainer::SetRetryDeadline(ERPCType Type, float Seconds)
+{
+	RetryDeadlines.Add(Type, FTimespan::FromSeconds(Seconds));
+}
+
+void FRPCContainer::BlockQueue(const FQueueKey& Key, const FDateTime& HeadTimestamp, TArray<FUnrealObjectRef>&& UnresolvedRefs)
+{
+	const FTimespan* RetryDeadline = RetryDeadlines.Find(Key.Key);
+	if (RetryDeadline == nullptr)
+	{
+		// Queues without a deadline are retried on every ProcessRPCs call.
+		return;
+	}
+
+	// The first retry happens when the head RPC would expire. If it was kept queued past that point,
+	// keep retrying at the same interval in case it is blocked on something that isn't reported as a reference.
+	const FDateTime Now = FDateTime::Now();
+	FDateTime Deadline = HeadTimestamp + *RetryDeadline;
+	if (Deadline <= Now)
+	{
+		Deadline = Now + *RetryDeadline;
+	}
+
+	for (const FUnrealObjectRef& ObjectRef : UnresolvedRefs)
+	{
+		QueuesWaitingOnRef.FindOrAdd(ObjectRef).AddUnique(Key);
+	}
+
+	BlockedQueues.Add(Key, FBlockedQueue{ MoveTemp(UnresolvedRefs), Deadline });
+}
+
+void FRPCContainer::UnblockQueue(const FQueueKey& Key)
+{
+	FBlockedQueue BlockedQueue;
+	if (!BlockedQueues.RemoveAndCopyValue(Key, BlockedQueue))
+	{
+		return;
+	}
+
+	for (const FUnrealObjectRef& ObjectRef : BlockedQueue.WaitingOnRefs)
+	{
+		if (TArray<FQueueKey>* WaitingQueues = QueuesWaitingOnRef.Find(ObjectRef))
+		{
+			WaitingQueues->RemoveSingleSwap(Key);
+			if (WaitingQueues->Num() == 0)
+			{
+				QueuesWaitingOnRef.Remove(ObjectRef);
+			}
+		}
+	}
+}
+
+bool FRPCContainer::IsWaitingForRetry(const FQueueKey& Key, const FDateTime& Now) const
+{
+	const FBlockedQueue* BlockedQueue = BlockedQueues.Find(Key);
+	return BlockedQueue != nullptr && BlockedQueue->RetryDeadline > Now;
+}
+
 bool FRPCContainer::ObjectHasRPCsQueuedOfType(const Worker_EntityId& EntityId, ERPCType Type) const
 {
 	if (const FRPCMap* MapOfQueues = QueuedRPCs.Find(Type))
@@ -211,6 +352,37 @@ bool FRPCContainer::ObjectHasRPCsQueuedOfType(const Worker_EntityId& EntityId, E
 	return false;
 }
 
+SIZE_T FRPCContainer::GetAllocatedSize() const
+{
+	SIZE_T Size = QueuedRPCs.GetAllocatedSize() + RetryDeadlines.GetAllocatedSize() + BlockedQueues.GetAllocatedSize()
+				  + QueuesWaitingOnRef.GetAllocatedSize() + DeferredResolvedRefs.GetAllocatedSize();
+
+	for (const auto& TypeAndQueues : QueuedRPCs)
+	{
+		Size += TypeAndQueues.Value.GetAllocatedSize();
+		for (const auto& EntityAndQueue : TypeAndQueues.Value)
+		{
+			Size += EntityAndQueue.Value.GetAllocatedSize();
+			for (const FPendingRPCParams& Params : EntityAndQueue.Value)
+			{
+				Size += Params.Payload.PayloadData.GetAllocatedSize();
+			}
+		}
+	}
+
+	for (const auto& Pair : BlockedQueues)
+	{
+		Size += Pair.Value.WaitingOnRefs.GetAllocatedSize();
+	}
+
+	for (const auto& Pair : QueuesWaitingOnRef)
+	{
+		Size += Pair.Value.GetAllocatedSize();
+	}
+
+	return Size;
+}
+
 FRPCContainer::FRPCContainer(ERPCQueueType InQueueType)
 	: QueueType(InQueueType)
 {
@@ -221,7 +393,7 @@ void FRPCContainer::BindProcessingFunction(const FProcessRPCDelegate& Function)
 	ProcessingFunction = Function;
 }
 
-ERPCQueueProcessResult FRPCContainer::ApplyFunction(FPendingRPCParams& Params)
+ERPCQueueProcessResult FRPCContainer::ApplyFunction(FPendingRPCParams& Params, TArray<FUnrealObjectRef>& OutUnresolvedRefs)
 {
 	ensure(ProcessingFunction.IsBound());
 	FRPCErrorInfo ErrorInfo = ProcessingFunction.Execute(Params);
@@ -235,5 +407,6 @@ ERPCQueueProcessResult FRPCContainer::ApplyFunction(FPendingRPCParams& Params)
 	LogRPCError(ErrorInfo, QueueType, Params);
 #endif
 
+	OutUnresolvedRefs = MoveTemp(ErrorInfo.UnresolvedRefs);
 	return ErrorInfo.QueueProcessResult;
 }
@@ -16,6 +16,19 @@ RPCRingBuffer::RPCRingBuffer(ERPCType InType)
 	}
 }
 
+SIZE_T RPCRingBuffer::GetAllocatedSize() const
+{
+	SIZE_T Size = RingBuffer.GetAllocatedSize() + Counterpart.GetAllocatedSize();
+	for (const TOptional<RPCPayload>& Element : RingBuffer)
+	{
+		if (Element.IsSet())
+		{
+			Size += Element->PayloadData.GetAllocatedSize();
+		}
+	}
+	return Size;
+}
+
 namespace RPCRingBufferUtils
 {
 Worker_ComponentId GetRingBufferComponentId(ERPCType Type)
@@ -0,0 +1,177 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/RepFieldDispatchTable.h"
+
+#include "Algo/AllOf.h"
+#include "GameFramework/Actor.h"
+
+#include "Utils/RepLayoutUtils.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogRepFieldDispatchTable, Log, All);
+
+namespace SpatialGDK
+{
+namespace
+{
+// Element deltas are written with the indexed schema functions, which ComponentFactory::AddProperty only has for these types.
+bool SupportsIndexedWrites(GDK_PROPERTY(Property) * Property)
+{
+	return Property->IsA<GDK_PROPERTY(StructProperty)>() || Property->IsA<GDK_PROPERTY(BoolProperty)>()
+		   || Property->IsA<GDK_PROPERTY(NumericProperty)>();
+}
+
+bool HasNestedDynamicArray(const TArray<FRepLayoutCmd>& Cmds, int32 ArrayCmdIndex)
+{
+	for (int32 CmdIndex = ArrayCmdIndex + 1; CmdIndex < Cmds[ArrayCmdIndex].EndCmd - 1; ++CmdIndex)
+	{
+		if (Cmds[CmdIndex].Type == ERepLayoutCmdType::DynamicArray)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+} // anonymous namespace
+
+TSharedRef<const FRepFieldDispatchTable> FRepFieldDispatchTable::Create(const FRepLayout& RepLayout, const FGeneratedClassCodec* Codec,
+																		 TArrayView<const uint32> DeltaArrayHandles,
+																		 TArrayView<const FQuantizedPropertySchemaData> QuantizedProperties)
+{
+	TSharedRef<FRepFieldDispatchTable> Table = MakeShared<FRepFieldDispatchTable>();
+
+	const TArray<FRepLayoutCmd>& Cmds = RepLayout.Cmds;
+	const TArray<FRepParentCmd>& Parents = RepLayout.Parents;
+	const bool bIsActor = EnumHasAnyFlags(RepLayout.GetFlags(), ERepLayoutFlags::IsActor);
+
+	Table->bAllPropertiesPushBased = Algo::AllOf(Parents, [](const FRepParentCmd& Parent) {
+		return EnumHasAnyFlags(Parent.Flags, ERepParentFlags::IsPushBased);
+	});
+
+	Table->Entries.SetNum(RepLayout.BaseHandleToCmdIndex.Num());
+	for (int32 HandleIndex = 0; HandleIndex < RepLayout.BaseHandleToCmdIndex.Num(); ++HandleIndex)
+	{
+		const int32 CmdIndex = RepLayout.BaseHandleToCmdIndex[HandleIndex].CmdIndex;
+		const FRepLayoutCmd& Cmd = Cmds[CmdIndex];
+		const FRepParentCmd& Parent = Parents[Cmd.ParentIndex];
+
+		FRepFieldDispatchEntry& Entry = Table->Entries[HandleIndex];
+		Entry.Property = Cmd.Property;
+		Entry.ParentProperty = Parent.Property;
+		Entry.CmdIndex = CmdIndex;
+		Entry.ParentIndex = Cmd.ParentIndex;
+		Entry.ParentArrayIndex = Parent.ArrayIndex;
+		Entry.Offset = Cmd.Offset;
+		Entry.ShadowOffset = Cmd.ShadowOffset;
+		Entry.SwappedOffset = Cmd.Offset;
+		Entry.SwappedShadowOffset = Cmd.ShadowOffset;
+		Entry.Condition = Parent.Condition;
+		Entry.RepNotifyCondition = Parent.RepNotifyCondition;
+		Entry.bHasRepNotify = Parent.Property->HasAnyPropertyFlags(CPF_RepNotify);
+		Entry.bIsRemoteRole = Cmd.Property->GetFName() == NAME_RemoteRole;
+
+		// This mirrors the swap in ReceivePropertyHelper in RepLayout.cpp
+		if (bIsActor)
+		{
+			int32 SwappedParentIndex = INDEX_NONE;
+			if ((int32)AActor::ENetFields_Private::RemoteRole == Cmd.ParentIndex)
+			{
+				SwappedParentIndex = (int32)AActor::ENetFields_Private::Role;
+			}
+			else if ((int32)AActor::ENetFields_Private::Role == Cmd.ParentIndex)
+			{
+				SwappedParentIndex = (int32)AActor::ENetFields_Private::RemoteRole;
+			}
+
+			if (SwappedParentIndex != INDEX_NONE)
+			{
+				const FRepLayoutCmd& SwappedCmd = Cmds[Parents[SwappedParentIndex].CmdStart];
+				Entry.SwappedOffset = SwappedCmd.Offset;
+				Entry.SwappedShadowOffset = SwappedCmd.ShadowOffset;
+				Entry.bSwapsRole = true;
+			}
+		}
+
+		if (Cmd.Type == ERepLayoutCmdType::DynamicArray)
+		{
+			GDK_PROPERTY(ArrayProperty)* ArrayProperty = GDK_CASTFIELD<GDK_PROPERTY(ArrayProperty)>(Cmd.Property);
+			if (ArrayProperty == nullptr)
+			{
+				Entry.Decoder = ERepFieldDecoder::Invalid;
+			}
+			else if (UScriptStruct* NetDeltaStruct = GetFastArraySerializerProperty(ArrayProperty))
+			{
+				Entry.Decoder = ERepFieldDecoder::FastArray;
+				Entry.FastArrayStruct = NetDeltaStruct;
+			}
+			else
+			{
+				Entry.Decoder = ERepFieldDecoder::DynamicArray;
+				Entry.ArrayHandlesPerElement = RepLayout.BaseHandleToCmdIndex[HandleIndex].HandleToCmdIndex->Num();
+			}
+		}
+	}
+
+	if (Codec != nullptr)
+	{
+		for (const FGeneratedFieldCodec& Field : Codec->Fields)
+		{
+			FRepFieldDispatchEntry* Entry = Table->Entries.IsValidIndex(Field.Handle - 1) ? &Table->Entries[Field.Handle - 1] : nullptr;
+			if (Entry == nullptr || Entry->Decoder != ERepFieldDecoder::Property || Entry->Property->ElementSize != Field.ValueSize
+				|| Entry->Property->GetName() != Field.PropertyName)
+			{
+				UE_LOG(LogRepFieldDispatchTable, Warning,
+					   TEXT("Generated codec for %s doesn't match property %s at handle %d, it will be replicated through reflection."),
+					   Codec->ClassPath, Field.PropertyName, Field.Handle);
+				continue;
+			}
+
+			Entry->GeneratedEncode = Field.Encode;
+			Entry->GeneratedDecode = Field.Decode;
+		}
+	}
+
+	for (const uint32 Handle : DeltaArrayHandles)
+	{
+		FRepFieldDispatchEntry* Entry = Table->Entries.IsValidIndex(Handle - 1) ? &Table->Entries[Handle - 1] : nullptr;
+		GDK_PROPERTY(ArrayProperty)* ArrayProperty =
+			Entry != nullptr ? GDK_CASTFIELD<GDK_PROPERTY(ArrayProperty)>(Entry->Property) : nullptr;
+		if (ArrayProperty == nullptr || Entry->Decoder != ERepFieldDecoder::DynamicArray || !SupportsIndexedWrites(ArrayProperty->Inner)
+			|| HasNestedDynamicArray(Cmds, Entry->CmdIndex))
+		{
+			UE_LOG(LogRepFieldDispatchTable, Warning,
+				   TEXT("Property at handle %u of %s can't be replicated as element deltas, the whole array will be sent on change."),
+				   Handle, *GetNameSafe(RepLayout.GetOwner()));
+			continue;
+		}
+
+		Entry->bSendsArrayDeltas = true;
+	}
+
+	for (const FQuantizedPropertySchemaData& QuantizedProperty : QuantizedProperties)
+	{
+		FRepFieldDispatchEntry* Entry =
+			Table->Entries.IsValidIndex(QuantizedProperty.Handle - 1) ? &Table->Entries[QuantizedProperty.Handle - 1] : nullptr;
+		GDK_PROPERTY(StructProperty)* StructProperty =
+			Entry != nullptr ? GDK_CASTFIELD<GDK_PROPERTY(StructProperty)>(Entry->Property) : nullptr;
+
+		FPropertyQuantization Quantization;
+		Quantization.Mode = QuantizedProperty.Mode;
+		Quantization.Bits = QuantizedProperty.Bits;
+		Quantization.Bounds = QuantizedProperty.Bounds;
+		Quantization.VelocityBounds = QuantizedProperty.VelocityBounds;
+
+		if (StructProperty == nullptr || Entry->Decoder != ERepFieldDecoder::Property
+			|| !PropertyQuantization::IsSupported(StructProperty->Struct, Quantization))
+		{
+			UE_LOG(LogRepFieldDispatchTable, Warning,
+				   TEXT("Property at handle %u of %s doesn't support its quantization, it will be replicated at full precision."),
+				   QuantizedProperty.Handle, *GetNameSafe(RepLayout.GetOwner()));
+			continue;
+		}
+
+		Entry->Quantization = Quantization;
+	}
+
+	return Table;
+}
+} // namespace SpatialGDK
@@ -0,0 +1,71 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/ReplicationLatencyStamp.h"
+
+#include "SpatialConstants.h"
+
+namespace SpatialGDK
+{
+FReplicationLatencyStamp FReplicationLatencyStamp::Now()
+{
+	FReplicationLatencyStamp Stamp;
+	Stamp.SendTimeTicks = FDateTime::UtcNow().GetTicks();
+	Stamp.FrameNumber = GFrameCounter;
+	return Stamp;
+}
+
+void FReplicationLatencyStamp::WriteToUpdate(Schema_ComponentUpdate* Update) const
+{
+	Schema_Object* StampObject = Schema_AddObject(Schema_GetComponentUpdateFields(Update), SpatialConstants::REPLICATION_LATENCY_STAMP_ID);
+	Schema_AddInt64(StampObject, SpatialConstants::REPLICATION_LATENCY_STAMP_SEND_TIME_ID, SendTimeTicks);
+	Schema_AddUint64(StampObject, SpatialConstants::REPLICATION_LATENCY_STAMP_FRAME_NUMBER_ID, FrameNumber);
+}
+
+TOptional<FReplicationLatencyStamp> FReplicationLatencyStamp::ReadFromUpdate(Schema_ComponentUpdate* Update)
+{
+	Schema_Object* Fields = Schema_GetComponentUpdateFields(Update);
+	if (Schema_GetObjectCount(Fields, SpatialConstants::REPLICATION_LATENCY_STAMP_ID) == 0)
+	{
+		return {};
+	}
+
+	Schema_Object* StampObject = Schema_GetObject(Fields, SpatialConstants::REPLICATION_LATENCY_STAMP_ID);
+
+	FReplicationLatencyStamp Stamp;
+	Stamp.SendTimeTicks = Schema_GetInt64(StampObject, SpatialConstants::REPLICATION_LATENCY_STAMP_SEND_TIME_ID);
+	Stamp.FrameNumber = Schema_GetUint64(StampObject, SpatialConstants::REPLICATION_LATENCY_STAMP_FRAME_NUMBER_ID);
+	return Stamp;
+}
+
+void FReplicationLatencyStamp::ClearFromData(Schema_ComponentData* Data)
+{
+	Schema_ClearField(Schema_GetComponentDataFields(Data), SpatialConstants::REPLICATION_LATENCY_STAMP_ID);
+}
+
+uint64 FReplicationLatencyStamp::GetMicrosecondsSinceSent(int64 NowTicks) const
+{
+	return NowTicks > SendTimeTicks ? static_cast<uint64>((NowTicks - SendTimeTicks) / ETimespan::TicksPerMicrosecond) : 0;
+}
+
+FReplicationLatencySampler::FReplicationLatencySampler(float InSampleRate)
+	: SampleRate(FMath::Clamp(InSampleRate, 0.0f, 1.0f))
+{
+}
+
+bool FReplicationLatencySampler::ShouldStamp()
+{
+	if (!IsEnabled())
+	{
+		return false;
+	}
+
+	Accumulator += SampleRate;
+	if (Accumulator < 1.0f)
+	{
+		return false;
+	}
+
+	Accumulator -= 1.0f;
+	return true;
+}
+} // namespace SpatialGDK
@@ -3,6 +3,7 @@
 #include "Utils/SpatialDebugger.h"
 
 #include "EngineClasses/SpatialNetDriver.h"
+#include "EngineClasses/SpatialPackageMapClient.h"
 #include "EngineClasses/SpatialVirtualWorkerTranslator.h"
 #include "EngineClasses/SpatialWorldSettings.h"
 #include "Interop/Connection/SpatialWorkerConnection.h"
@@ -17,6 +18,8 @@
 #include "Utils/InspectionColors.h"
 #include "Utils/SpatialDebuggerSystem.h"
 
+#include "Components/PrimitiveComponent.h"
+#include "ConvexVolume.h"
 #include "Debug/DebugDrawService.h"
 #include "Engine/Engine.h"
 #include "Framework/Application/SlateApplication.h"
@@ -28,6 +31,7 @@
 #include "Kismet/GameplayStatics.h"
 #include "Modules/ModuleManager.h"
 #include "Net/UnrealNetwork.h"
+#include "SceneView.h"
 
 #if UE_EDITOR
 #include "Editor.h"
@@ -90,6 +94,7 @@ void ASpatialDebugger::BeginPlay()
 	if (!NetDriver->IsServer())
 	{
 		GetDebuggerSystem()->OnEntityActorAddedDelegate.AddUObject(this, &ASpatialDebugger::OnEntityAdded);
+		GetDebuggerSystem()->OnEntityActorRemovedDelegate.AddUObject(this, &ASpatialDebugger::OnEntityRemoved);
 
 		for (const TPair<Worker_EntityId_Key, TWeakObjectPtr<AActor>>& PresentActorPair : GetDebuggerSystem()->GetActors())
 		{
@@ -150,6 +155,19 @@ void ASpatialDebugger::Tick(float DeltaSeconds)
 
 void ASpatialDebugger::OnEntityAdded(AActor* Actor)
 {
+	const Worker_EntityId EntityId = NetDriver->PackageMap->GetEntityIdFromObject(Actor);
+	if (EntityId != SpatialConstants::INVALID_ENTITY_ID)
+	{
+		UpdateActorGrid(EntityId, *Actor);
+
+		if (USceneComponent* RootComponent = Actor->GetRootComponent())
+		{
+			const FDelegateHandle Handle =
+				RootComponent->TransformUpdated.AddUObject(this, &ASpatialDebugger::OnActorTransformUpdated, EntityId);
+			ActorGridTransformBindings.Add(EntityId, { RootComponent, Handle });
+		}
+	}
+
 	// Each client will only receive a PlayerController once.
 	if (Actor->IsA<APlayerController>())
 	{
@@ -167,6 +185,27 @@ void ASpatialDebugger::OnEntityAdded(AActor* Actor)
 	}
 }
 
+void ASpatialDebugger::OnEntityRemoved(const Worker_EntityId EntityId)
+{
+	TPair<TWeakObjectPtr<USceneComponent>, FDelegateHandle> Binding;
+	if (ActorGridTransformBindings.RemoveAndCopyValue(EntityId, Binding) && Binding.Key.IsValid())
+	{
+		Binding.Key->TransformUpdated.Remove(Binding.Value);
+	}
+
+	ActorGrid.Remove(EntityId);
+	TagLayoutCache.Remove(EntityId);
+}
+
+void ASpatialDebugger::OnActorTransformUpdated(USceneComponent* Component, EUpdateTransformFlags /* UpdateTransformFlags */,
+											   ETeleportType /* Teleport */, const Worker_EntityId EntityId)
+{
+	if (const AActor* Actor = Component->GetOwner())
+	{
+		UpdateActorGrid(EntityId, *Actor);
+	}
+}
+
 void ASpatialDebugger::OnAuthorityGained()
 {
 	if (UAbstractLBStrategy* LoadBalanceStrategy = Cast<UAbstractLBStrategy>(NetDriver->LoadBalanceStrategy))
@@ -273,6 +312,7 @@ void ASpatialDebugger::Destroyed()
 	}
 
 	DestroyWorkerRegions();
+	ResetActorGrid();
 
 	Super::Destroyed();
 }
@@ -445,7 +485,7 @@ bool ASpatialDebugger::IsSelectActorEnabled() const
 	return bSelectActor;
 }
 
-void ASpatialDebugger::DrawTag(UCanvas* Canvas, const FVector2D& ScreenLocation, const Worker_EntityId EntityId, const FString& ActorName,
+void ASpatialDebugger::DrawTag(UCanvas* Canvas, const FVector2D& ScreenLocation, const Worker_EntityId EntityId, const FName ActorName,
 							   const bool bCentre)
 {
 	SCOPE_CYCLE_COUNTER(STAT_DrawTag);
@@ -477,14 +517,39 @@ void ASpatialDebugger::DrawTag(UCanvas* Canvas, const FVector2D& ScreenLocation,
 	static const float BaseHorizontalOffset = 16.0f;
 	static const float NumberScale = 0.75f;
 	static const float TextScale = 0.5f;
-	const float AuthIdWidth = NumberScale * GetNumberOfDigitsIn(DebuggingInfo->AuthoritativeVirtualWorkerId);
-	const float AuthIntentIdWidth = NumberScale * GetNumberOfDigitsIn(DebuggingInfo->IntentVirtualWorkerId);
-	const float EntityIdWidth = NumberScale * GetNumberOfDigitsIn(EntityId);
 
-	int32 HorizontalOffset = 0;
-	if (bCentre)
+	const uint8 ShowFlags = (bShowLock ? 1 : 0) | (bShowAuth ? 2 : 0) | (bShowAuthIntent ? 4 : 0) | (bShowEntityId ? 8 : 0)
+							| (bShowActorName ? 16 : 0);
+
+	FTagLayout& Layout = TagLayoutCache.FindOrAdd(EntityId);
+	if (!Layout.bIsBuilt || Layout.ActorName != ActorName || Layout.ShowFlags != ShowFlags
+		|| Layout.AuthoritativeVirtualWorkerId != DebuggingInfo->AuthoritativeVirtualWorkerId
+		|| Layout.IntentVirtualWorkerId != DebuggingInfo->IntentVirtualWorkerId)
 	{
-		// If tag should be centered, calculate the total width of the icons and text to be rendered
+		SCOPE_CYCLE_COUNTER(STAT_BuildText);
+
+		Layout.bIsBuilt = true;
+		Layout.ActorName = ActorName;
+		Layout.ShowFlags = ShowFlags;
+		Layout.AuthoritativeVirtualWorkerId = DebuggingInfo->AuthoritativeVirtualWorkerId;
+		Layout.IntentVirtualWorkerId = DebuggingInfo->IntentVirtualWorkerId;
+		Layout.AuthIdText = FString::FromInt(DebuggingInfo->AuthoritativeVirtualWorkerId);
+		Layout.IntentIdText = FString::FromInt(DebuggingInfo->IntentVirtualWorkerId);
+		Layout.AuthIdWidth = NumberScale * GetNumberOfDigitsIn(DebuggingInfo->AuthoritativeVirtualWorkerId);
+		Layout.AuthIntentIdWidth = NumberScale * GetNumberOfDigitsIn(DebuggingInfo->IntentVirtualWorkerId);
+
+		const FString ActorNameString = ActorName.ToString();
+		Layout.Label.Reset();
+		if (bShowEntityId)
+		{
+			Layout.Label += FString::Printf(TEXT("%lld "), EntityId);
+		}
+		if (bShowActorName)
+		{
+			Layout.Label += FString::Printf(TEXT("(%s)"), *ActorNameString);
+		}
+
+		// Calculate the total width of the icons and text to be rendered, for centred tags
 		float TagWidth = 0;
 		if (bShowLock)
 		{
@@ -495,31 +560,33 @@ void ASpatialDebugger::DrawTag(UCanvas* Canvas, const FVector2D& ScreenLocation,
 		{
 			// If showing the authority, add the authority icon width and the width of the authoritative virtual worker ID
 			TagWidth += BaseHorizontalOffset;
-			TagWidth += (BaseHorizontalOffset * AuthIdWidth);
+			TagWidth += (BaseHorizontalOffset * Layout.AuthIdWidth);
 		}
 		if (bShowAuthIntent)
 		{
 			// If showing the authority intent, add the authority intent icon width and the width of the authoritative intent virtual worker
 			// ID
 			TagWidth += BaseHorizontalOffset;
-			TagWidth += (BaseHorizontalOffset * AuthIntentIdWidth);
+			TagWidth += (BaseHorizontalOffset * Layout.AuthIntentIdWidth);
 		}
 		if (bShowEntityId)
 		{
 			// If showing the entity ID, add the width of the entity ID
-			TagWidth += (BaseHorizontalOffset * EntityIdWidth);
+			TagWidth += (BaseHorizontalOffset * NumberScale * GetNumberOfDigitsIn(EntityId));
 		}
 		if (bShowActorName)
 		{
 			// If showing the actor name, add the width of the actor name
-			const float ActorNameWidth = TextScale * ActorName.Len();
+			const float ActorNameWidth = TextScale * ActorNameString.Len();
 			TagWidth += (BaseHorizontalOffset * ActorNameWidth);
 		}
 
 		// Calculate the offset based on the total width of the tag
-		HorizontalOffset = TagWidth / -2;
+		Layout.CentredOffset = static_cast<int32>(TagWidth / -2);
 	}
 
+	int32 HorizontalOffset = bCentre ? Layout.CentredOffset : 0;
+
 	// Draw icons and text based on the offset
 	if (bShowLock)
 	{
@@ -540,11 +607,11 @@ void ASpatialDebugger::DrawTag(UCanvas* Canvas, const FVector2D& ScreenLocation,
 		Canvas->DrawIcon(Icons[ICON_AUTH], ScreenLocation.X + HorizontalOffset, ScreenLocation.Y, 1.0f);
 		HorizontalOffset += BaseHorizontalOffset;
 		Canvas->SetDrawColor(ServerWorkerColor);
-		Canvas->DrawScaledIcon(Icons[ICON_BOX], ScreenLocation.X + HorizontalOffset, ScreenLocation.Y, FVector(AuthIdWidth, 1.f, 1.f));
+		Canvas->DrawScaledIcon(Icons[ICON_BOX], ScreenLocation.X + HorizontalOffset, ScreenLocation.Y, FVector(Layout.AuthIdWidth, 1.f, 1.f));
 		Canvas->SetDrawColor(GetTextColorForBackgroundColor(ServerWorkerColor));
-		Canvas->DrawText(RenderFont, FString::FromInt(DebuggingInfo->AuthoritativeVirtualWorkerId), ScreenLocation.X + HorizontalOffset + 1,
-						 ScreenLocation.Y, 1.1f, 1.1f, FontRenderInfo);
-		HorizontalOffset += (BaseHorizontalOffset * AuthIdWidth);
+		Canvas->DrawText(RenderFont, Layout.AuthIdText, ScreenLocation.X + HorizontalOffset + 1, ScreenLocation.Y, 1.1f, 1.1f,
+						 FontRenderInfo);
+		HorizontalOffset += (BaseHorizontalOffset * Layout.AuthIdWidth);
 	}
 
 	if (bShowAuthIntent)
@@ -556,31 +623,18 @@ void ASpatialDebugger::DrawTag(UCanvas* Canvas, const FVector2D& ScreenLocation,
 		HorizontalOffset += BaseHorizontalOffset;
 		Canvas->SetDrawColor(VirtualWorkerColor);
 		Canvas->DrawScaledIcon(Icons[ICON_BOX], ScreenLocation.X + HorizontalOffset, ScreenLocation.Y,
-							   FVector(AuthIntentIdWidth, 1.f, 1.f));
+							   FVector(Layout.AuthIntentIdWidth, 1.f, 1.f));
 		Canvas->SetDrawColor(GetTextColorForBackgroundColor(VirtualWorkerColor));
-		Canvas->DrawText(RenderFont, FString::FromInt(DebuggingInfo->IntentVirtualWorkerId), ScreenLocation.X + HorizontalOffset + 1,
-						 ScreenLocation.Y, 1.1f, 1.1f, FontRenderInfo);
-		HorizontalOffset += (BaseHorizontalOffset * AuthIntentIdWidth);
-	}
-
-	FString Label;
-	if (bShowEntityId)
-	{
-		SCOPE_CYCLE_COUNTER(STAT_BuildText);
-		Label += FString::Printf(TEXT("%lld "), EntityId);
-	}
-
-	if (bShowActorName)
-	{
-		SCOPE_CYCLE_COUNTER(STAT_BuildText);
-		Label += FString::Printf(TEXT("(%s)"), *ActorName);
+		Canvas->DrawText(RenderFont, Layout.IntentIdText, ScreenLocation.X + HorizontalOffset + 1, ScreenLocation.Y, 1.1f, 1.1f,
+						 FontRenderInfo);
+		HorizontalOffset += (BaseHorizontalOffset * Layout.AuthIntentIdWidth);
 	}
 
 	if (bShowEntityId || bShowActorName)
 	{
 		SCOPE_CYCLE_COUNTER(STAT_DrawText);
 		Canvas->SetDrawColor(FColor::Green);
-		Canvas->DrawText(RenderFont, Label, ScreenLocation.X + HorizontalOffset, ScreenLocation.Y, 1.0f, 1.0f, FontRenderInfo);
+		Canvas->DrawText(RenderFont, Layout.Label, ScreenLocation.X + HorizontalOffset, ScreenLocation.Y, 1.0f, 1.0f, FontRenderInfo);
 	}
 }
 
@@ -628,19 +682,86 @@ void ASpatialDebugger::DrawDebug(UCanvas* Canvas, APlayerController* /* Controll
 
 	if (ActorTagDrawMode == EActorTagDrawMode::All)
 	{
-		const FVector PlayerLocation = GetLocalPawnLocation();
+		UpdateViewVersion(Canvas);
+
+		// Tags are drawn above the actor, so that is the point that has to be on screen
+		const FConvexVolume* Frustum = Canvas->SceneView != nullptr ? &Canvas->SceneView->ViewFrustum : nullptr;
+		const SpatialDebuggerSystem::FEntityToActorMap& Actors = GetDebuggerSystem()->GetActors();
+
+		ActorGrid.ForEachInRange(
+			GetLocalPawnLocation(), MaxRange, Frustum, WorldSpaceActorTagOffset,
+			[this, Canvas, &Actors](const Worker_EntityId EntityId, const FVector& ActorLocation) {
+				const TWeakObjectPtr<AActor>* Actor = Actors.Find(EntityId);
+				if (Actor == nullptr || !Actor->IsValid() || ActorLocation.IsZero())
+				{
+					return;
+				}
+
+				DrawTag(Canvas, GetCachedScreenLocation(EntityId, ActorLocation, Canvas), EntityId, (*Actor)->GetFName(), true /*bCentre*/);
+			});
+	}
+}
+
+void ASpatialDebugger::UpdateActorGrid(const Worker_EntityId EntityId, const AActor& Actor)
+{
+	SCOPE_CYCLE_COUNTER(STAT_UpdateActorGrid);
 
-		for (const TPair<Worker_EntityId_Key, TWeakObjectPtr<AActor>>& EntityActorPair : GetDebuggerSystem()->GetActors())
+	// The root component's bounds are cached by the engine, unlike the bounds of the whole actor. The minimum radius keeps
+	// actors whose visible parts are children of a small root pickable.
+	static const float MinPickingRadius = 100.0f;
+	const FVector ActorLocation = Actor.GetActorLocation();
+	float BoundsRadius = MinPickingRadius;
+	if (const USceneComponent* RootComponent = Actor.GetRootComponent())
+	{
+		BoundsRadius =
+			FMath::Max(BoundsRadius, RootComponent->Bounds.SphereRadius + FVector::Dist(RootComponent->Bounds.Origin, ActorLocation));
+	}
+
+	ActorGrid.AddOrUpdate(EntityId, ActorLocation, BoundsRadius);
+}
+
+void ASpatialDebugger::ResetActorGrid()
+{
+	for (const auto& Pair : ActorGridTransformBindings)
+	{
+		if (USceneComponent* RootComponent = Pair.Value.Key.Get())
 		{
-			const TWeakObjectPtr<AActor> Actor = EntityActorPair.Value;
-			const Worker_EntityId EntityId = EntityActorPair.Key;
-			FVector2D ScreenLocation;
-			if (Actor != nullptr && ProjectActorToScreen(Actor->GetActorLocation(), PlayerLocation, ScreenLocation, Canvas))
-			{
-				DrawTag(Canvas, ScreenLocation, EntityId, Actor->GetName(), true /*bCentre*/);
-			}
+			RootComponent->TransformUpdated.Remove(Pair.Value.Value);
 		}
 	}
+	ActorGridTransformBindings.Empty();
+	ActorGrid.Reset();
+}
+
+void ASpatialDebugger::UpdateViewVersion(const UCanvas* Canvas)
+{
+	if (Canvas->SceneView == nullptr)
+	{
+		ViewVersion++;
+		return;
+	}
+
+	const FMatrix& ViewProjectionMatrix = Canvas->SceneView->ViewMatrices.GetViewProjectionMatrix();
+	if (!ViewProjectionMatrix.Equals(LastViewProjectionMatrix, 0.0f))
+	{
+		LastViewProjectionMatrix = ViewProjectionMatrix;
+		ViewVersion++;
+	}
+}
+
+FVector2D ASpatialDebugger::GetCachedScreenLocation(const Worker_EntityId EntityId, const FVector& ActorLocation, const UCanvas* Canvas)
+{
+	const FVector TagLocation = ActorLocation + WorldSpaceActorTagOffset;
+
+	FTagLayout& Layout = TagLayoutCache.FindOrAdd(EntityId);
+	if (Layout.ProjectedViewVersion != ViewVersion || !Layout.ProjectedTagLocation.Equals(TagLocation, 0.0f))
+	{
+		SCOPE_CYCLE_COUNTER(STAT_Projection);
+		Layout.ScreenLocation = FVector2D(Canvas->Project(TagLocation));
+		Layout.ProjectedTagLocation = TagLocation;
+		Layout.ProjectedViewVersion = ViewVersion;
+	}
+	return Layout.ScreenLocation;
 }
 
 void ASpatialDebugger::SelectActorsToTag(UCanvas* Canvas)
@@ -680,7 +801,7 @@ void ASpatialDebugger::SelectActorsToTag(UCanvas* Canvas)
 					FVector2D ScreenLocation;
 					if (ProjectActorToScreen(SelectedActor->GetActorLocation(), PlayerLocation, ScreenLocation, Canvas))
 					{
-						DrawTag(Canvas, ScreenLocation, *HitEntityId, SelectedActor->GetName(), true /*bCentre*/);
+						DrawTag(Canvas, ScreenLocation, *HitEntityId, SelectedActor->GetFName(), true /*bCentre*/);
 					}
 				}
 			}
@@ -777,34 +898,30 @@ TWeakObjectPtr<AActor> ASpatialDebugger::GetActorAtPosition(const FVector2D& New
 
 		HitActors.Empty();
 
-		TArray<FHitResult> HitResults;
-		bool bHit = GetWorld()->LineTraceMultiByObjectType(HitResults, StartTrace, EndTrace, CollisionObjectParams);
-		if (bHit)
-		{
-			// When the raycast hits an actor then it is highlighted, whilst the actor remains under the crosshair. If there are multiple
-			// hit results, the user can select the next by using the mouse scroll wheel
-			for (const FHitResult& HitResult : HitResults)
-			{
-				const TWeakObjectPtr<AActor> HitActor = HitResult.GetActor();
+		// Picking is hierarchical: the grid finds the tracked actors whose cell and then bounding sphere the ray crosses, nearest first,
+		// and only those are tested against their colliding components' bounds. Tracked actors are the only ones we can show a tag for,
+		// so nothing else needs to be considered.
+		SCOPE_CYCLE_COUNTER(STAT_Picking);
 
-				if (!HitActor.IsValid() || HitActors.Contains(HitActor))
-				{
-					// The hit results may include the same actor multiple times so just ignore duplicates
-					continue;
-				}
+		TArray<Worker_EntityId> HitEntityIds;
+		ActorGrid.Raycast(StartTrace, EndTrace, HitEntityIds);
 
-				// Only add actors to the list of hit actors if they have a valid entity id and screen position. As later when we scroll
-				// through the actors, we only want to highlight ones that we can show a tag for.
-				if (const Worker_EntityId_Key* HitEntityId = GetDebuggerSystem()->GetActorEntityId(HitResult.GetActor()))
-				{
-					FVector PlayerLocation = GetLocalPawnLocation();
+		// When the raycast hits an actor then it is highlighted, whilst the actor remains under the crosshair. If there are multiple
+		// hit results, the user can select the next by using the mouse scroll wheel
+		const FVector PlayerLocation = GetLocalPawnLocation();
+		for (const Worker_EntityId HitEntityId : HitEntityIds)
+		{
+			AActor* HitActor = GetDebuggerSystem()->GetActor(HitEntityId);
+			if (HitActor == nullptr || !IsPickable(*HitActor, StartTrace, EndTrace))
+			{
+				continue;
+			}
 
-					FVector2D ScreenLocation;
-					if (CanProjectActorLocationToScreen(HitActor->GetActorLocation(), PlayerLocation, Canvas))
-					{
-						HitActors.Add(HitActor);
-					}
-				}
+			// Only add actors to the list of hit actors if they have a screen position. As later when we scroll
+			// through the actors, we only want to highlight ones that we can show a tag for.
+			if (CanProjectActorLocationToScreen(HitActor->GetActorLocation(), PlayerLocation, Canvas))
+			{
+				HitActors.Add(HitActor);
 			}
 		}
 	}
@@ -812,6 +929,21 @@ TWeakObjectPtr<AActor> ASpatialDebugger::GetActorAtPosition(const FVector2D& New
 	return GetHitActor();
 }
 
+bool ASpatialDebugger::IsPickable(const AActor& Actor, const FVector& RayStart, const FVector& RayEnd) const
+{
+	// Only actors with a root of one of the SelectCollisionTypesToQuery object types can be selected, as with a collision query
+	if (const UPrimitiveComponent* RootPrimitive = Cast<UPrimitiveComponent>(Actor.GetRootComponent()))
+	{
+		if ((CollisionObjectParams.GetQueryBitfield() & ECC_TO_BITFIELD(RootPrimitive->GetCollisionObjectType())) == 0)
+		{
+			return false;
+		}
+	}
+
+	const FBox CollidingBounds = Actor.GetComponentsBoundingBox();
+	return CollidingBounds.IsValid && FMath::LineBoxIntersection(CollidingBounds, RayStart, RayEnd, RayEnd - RayStart);
+}
+
 // Return actor selected from list dependent on the hover index, which is selected independently with the mouse wheel (by default)
 TWeakObjectPtr<AActor> ASpatialDebugger::GetHitActor()
 {
@@ -887,7 +1019,7 @@ void ASpatialDebugger::DrawDebugLocalPlayer(UCanvas* Canvas)
 	for (int32 i = 0; i < ActorsToDisplay.Num(); ++i)
 	{
 		const Worker_EntityId EntityId = NetDriver->PackageMap->GetEntityIdFromObject(ActorsToDisplay[i]);
-		DrawTag(Canvas, ScreenLocation, EntityId, ActorsToDisplay[i]->GetName(), false /*bCentre*/);
+		DrawTag(Canvas, ScreenLocation, EntityId, ActorsToDisplay[i]->GetFName(), false /*bCentre*/);
 		ScreenLocation.Y += PLAYER_TAG_VERTICAL_OFFSET;
 	}
 }
@@ -0,0 +1,185 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/SpatialDebuggerActorGrid.h"
+
+#include "ConvexVolume.h"
+
+namespace SpatialGDK
+{
+FSpatialDebuggerActorGrid::FSpatialDebuggerActorGrid(float InCellSize)
+	: CellSize(FMath::Max(InCellSize, 1.0f))
+{
+}
+
+void FSpatialDebuggerActorGrid::AddOrUpdate(Worker_EntityId EntityId, const FVector& Location, float BoundsRadius)
+{
+	const FIntVector Coordinates = GetCellCoordinates(Location);
+
+	FEntityState& State = EntityCells.FindOrAdd(EntityId);
+	const bool bIsNew = State.EntryIndex == INDEX_NONE;
+
+	if (!bIsNew && State.Cell == Coordinates)
+	{
+		FCell& Cell = Cells.FindChecked(Coordinates);
+		FEntry& Entry = Cell.Entries[State.EntryIndex];
+		Entry.Location = Location;
+		Entry.BoundsRadius = BoundsRadius;
+		Cell.MaxBoundsRadius = FMath::Max(Cell.MaxBoundsRadius, BoundsRadius);
+		return;
+	}
+
+	if (!bIsNew)
+	{
+		RemoveFromCell(State);
+	}
+
+	FCell& Cell = Cells.FindOrAdd(Coordinates);
+	State.Cell = Coordinates;
+	State.EntryIndex = Cell.Entries.Add({ EntityId, Location, BoundsRadius });
+	Cell.MaxBoundsRadius = FMath::Max(Cell.MaxBoundsRadius, BoundsRadius);
+}
+
+void FSpatialDebuggerActorGrid::Remove(Worker_EntityId EntityId)
+{
+	FEntityState State;
+	if (EntityCells.RemoveAndCopyValue(EntityId, State))
+	{
+		RemoveFromCell(State);
+	}
+}
+
+void FSpatialDebuggerActorGrid::Reset()
+{
+	Cells.Reset();
+	EntityCells.Reset();
+}
+
+void FSpatialDebuggerActorGrid::ForEachInRange(const FVector& Origin, float Range, const FConvexVolume* Frustum,
+											   const FVector& FrustumOffset, TFunctionRef<void(Worker_EntityId EntityId, const FVector& Location)> Visitor) const
+{
+	const float RangeSquared = Range * Range;
+
+	auto VisitCell = [&](const FIntVector& Coordinates, const FCell& Cell) {
+		const FBox CellBox = GetCellBox(Coordinates, 0.0f);
+		if (CellBox.ComputeSquaredDistanceToPoint(Origin) > RangeSquared)
+		{
+			return;
+		}
+
+		bool bFullyInsideFrustum = Frustum == nullptr;
+		if (Frustum != nullptr && !Frustum->IntersectBox(CellBox.GetCenter() + FrustumOffset, CellBox.GetExtent(), bFullyInsideFrustum))
+		{
+			return;
+		}
+
+		for (const FEntry& Entry : Cell.Entries)
+		{
+			if (FVector::DistSquared(Origin, Entry.Location) > RangeSquared)
+			{
+				continue;
+			}
+			if (!bFullyInsideFrustum && !Frustum->IntersectPoint(Entry.Location + FrustumOffset))
+			{
+				continue;
+			}
+			Visitor(Entry.EntityId, Entry.Location);
+		}
+	};
+
+	const FIntVector Min = GetCellCoordinates(Origin - FVector(Range));
+	const FIntVector Max = GetCellCoordinates(Origin + FVector(Range));
+	const int64 NumCellsInRange = static_cast<int64>(Max.X - Min.X + 1) * (Max.Y - Min.Y + 1) * (Max.Z - Min.Z + 1);
+
+	// Sparse worlds have fewer occupied cells than cells in range, so look at whichever is smaller.
+	if (NumCellsInRange > Cells.Num())
+	{
+		for (const auto& Pair : Cells)
+		{
+			VisitCell(Pair.Key, Pair.Value);
+		}
+		return;
+	}
+
+	for (int32 X = Min.X; X <= Max.X; ++X)
+	{
+		for (int32 Y = Min.Y; Y <= Max.Y; ++Y)
+		{
+			for (int32 Z = Min.Z; Z <= Max.Z; ++Z)
+			{
+				const FIntVector Coordinates(X, Y, Z);
+				if (const FCell* Cell = Cells.Find(Coordinates))
+				{
+					VisitCell(Coordinates, *Cell);
+				}
+			}
+		}
+	}
+}
+
+void FSpatialDebuggerActorGrid::Raycast(const FVector& Start, const FVector& End, TArray<Worker_EntityId>& OutEntityIds) const
+{
+	const FVector Segment = End - Start;
+	const float SegmentLengthSquared = Segment.SizeSquared();
+
+	TArray<TPair<float, Worker_EntityId>, TInlineAllocator<16>> Hits;
+
+	for (const auto& Pair : Cells)
+	{
+		const FCell& Cell = Pair.Value;
+		if (!FMath::LineBoxIntersection(GetCellBox(Pair.Key, Cell.MaxBoundsRadius), Start, End, Segment))
+		{
+			continue;
+		}
+
+		for (const FEntry& Entry : Cell.Entries)
+		{
+			const FVector ClosestPoint = FMath::ClosestPointOnSegment(Entry.Location, Start, End);
+			if (FVector::DistSquared(ClosestPoint, Entry.Location) > FMath::Square(Entry.BoundsRadius))
+			{
+				continue;
+			}
+
+			const float DistanceAlongRay = SegmentLengthSquared > 0.0f ? FVector::DotProduct(ClosestPoint - Start, Segment) : 0.0f;
+			Hits.Emplace(DistanceAlongRay, Entry.EntityId);
+		}
+	}
+
+	Hits.Sort([](const TPair<float, Worker_EntityId>& A, const TPair<float, Worker_EntityId>& B) {
+		return A.Key < B.Key;
+	});
+
+	OutEntityIds.Reserve(OutEntityIds.Num() + Hits.Num());
+	for (const TPair<float, Worker_EntityId>& Hit : Hits)
+	{
+		OutEntityIds.Add(Hit.Value);
+	}
+}
+
+FIntVector FSpatialDebuggerActorGrid::GetCellCoordinates(const FVector& Location) const
+{
+	return FIntVector(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize),
+					  FMath::FloorToInt(Location.Z / CellSize));
+}
+
+FBox FSpatialDebuggerActorGrid::GetCellBox(const FIntVector& Coordinates, float Padding) const
+{
+	const FVector Min = FVector(Coordinates) * CellSize;
+	return FBox(Min - FVector(Padding), Min + FVector(CellSize + Padding));
+}
+
+void FSpatialDebuggerActorGrid::RemoveFromCell(const FEntityState& State)
+{
+	FCell& Cell = Cells.FindChecked(State.Cell);
+	Cell.Entries.RemoveAtSwap(State.EntryIndex, 1, /* bAllowShrinking */ false);
+
+	if (Cell.Entries.Num() == 0)
+	{
+		Cells.Remove(State.Cell);
+	}
+	else if (Cell.Entries.IsValidIndex(State.EntryIndex))
+	{
+		// The last entry was moved into the freed slot.
+		EntityCells.FindChecked(Cell.Entries[State.EntryIndex].EntityId).EntryIndex = State.EntryIndex;
+	}
+}
+} // namespace SpatialGDK
@@ -34,7 +34,9 @@ void SpatialDebuggerSystem::Advance()
 	{
 		if (!It->Value.IsValid())
 		{
+			const Worker_EntityId EntityId = It->Key;
 			It.RemoveCurrent();
+			OnEntityActorRemovedDelegate.Broadcast(EntityId);
 		}
 	}
 
@@ -121,9 +123,9 @@ void SpatialDebuggerSystem::OnEntityAdded(const Worker_EntityId EntityId)
 
 void SpatialDebuggerSystem::OnEntityRemoved(const Worker_EntityId EntityId)
 {
-	if (!NetDriver->IsServer())
+	if (!NetDriver->IsServer() && EntityActorMapping.Remove(EntityId) > 0)
 	{
-		EntityActorMapping.Remove(EntityId);
+		OnEntityActorRemovedDelegate.Broadcast(EntityId);
 	}
 }
 
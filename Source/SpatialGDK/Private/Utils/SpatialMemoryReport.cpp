@@ -0,0 +1,121 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Utils/SpatialMemoryReport.h"
+
+#include "EngineClasses/SpatialNetDriver.h"
+#include "EngineClasses/SpatialNetDriverRPC.h"
+#include "EngineClasses/SpatialPackageMapClient.h"
+#include "Interop/Connection/SpatialWorkerConnection.h"
+#include "Interop/RPCs/SpatialRPCService.h"
+#include "Misc/OutputDevice.h"
+#include "Utils/SchemaUtils.h"
+
+namespace SpatialGDK
+{
+FSpatialMemoryReport FSpatialMemoryReport::Gather(const USpatialNetDriver& NetDriver)
+{
+	FSpatialMemoryReport Report;
+
+	if (NetDriver.Connection != nullptr && NetDriver.Connection->HasValidCoordinator())
+	{
+		const ViewCoordinator& Coordinator = NetDriver.Connection->GetCoordinator();
+		Report.AddEntityView(Coordinator.GetView());
+		Report.AddSubsystem(TEXT("SubViews"), Coordinator.GetSubViewsAllocatedSize());
+	}
+
+	if (NetDriver.RPCService.IsValid())
+	{
+		Report.AddSubsystem(TEXT("RPCService"), NetDriver.RPCService->GetAllocatedSize());
+	}
+
+	if (NetDriver.RPCs.IsValid())
+	{
+		Report.AddSubsystem(TEXT("RPCs"), NetDriver.RPCs->GetAllocatedSize());
+	}
+
+	if (NetDriver.GuidCache.IsValid())
+	{
+		const FSpatialNetGUIDCache* SpatialGuidCache = static_cast<const FSpatialNetGUIDCache*>(NetDriver.GuidCache.Get());
+		Report.AddSubsystem(TEXT("NetGUIDCache"), SpatialGuidCache->GetAllocatedSize());
+	}
+
+	return Report;
+}
+
+void FSpatialMemoryReport::AddEntityView(const EntityView& View)
+{
+	uint64 ContainerBytes = View.GetAllocatedSize();
+	uint64 SchemaBytes = 0;
+
+	TMap<Worker_ComponentId, FComponentMemory> ComponentsById;
+	for (const auto& Pair : View)
+	{
+		const EntityViewElement& Element = Pair.Value;
+		ContainerBytes += Element.Components.GetAllocatedSize() + Element.Authority.GetAllocatedSize();
+
+		for (const ComponentData& Component : Element.Components)
+		{
+			const uint32 Bytes = GetSerializedSize(Component.GetUnderlying());
+			SchemaBytes += Bytes;
+
+			FComponentMemory& Memory = ComponentsById.FindOrAdd(Component.GetComponentId());
+			Memory.ComponentId = Component.GetComponentId();
+			Memory.Count++;
+			Memory.SchemaBytes += Bytes;
+		}
+	}
+
+	NumEntities += View.Num();
+	AddSubsystem(TEXT("EntityView"), ContainerBytes);
+	AddSubsystem(TEXT("ComponentData"), SchemaBytes);
+
+	for (const auto& Pair : ComponentsById)
+	{
+		Components.Add(Pair.Value);
+	}
+	Components.Sort([](const FComponentMemory& Lhs, const FComponentMemory& Rhs) {
+		return Lhs.SchemaBytes > Rhs.SchemaBytes;
+	});
+}
+
+void FSpatialMemoryReport::AddSubsystem(const TCHAR* Name, uint64 Bytes)
+{
+	Subsystems.Add({ Name, Bytes });
+}
+
+uint64 FSpatialMemoryReport::GetTotalBytes() const
+{
+	uint64 Total = 0;
+	for (const FSubsystemMemory& Subsystem : Subsystems)
+	{
+		Total += Subsystem.Bytes;
+	}
+	return Total;
+}
+
+void FSpatialMemoryReport::Dump(FOutputDevice& Ar, int32 MaxComponents) const
+{
+	Ar.Logf(TEXT("Spatial networking memory: %.1f KB across %d entities"), GetTotalBytes() / 1024.0, NumEntities);
+
+	TArray<FSubsystemMemory> SortedSubsystems = Subsystems;
+	SortedSubsystems.Sort([](const FSubsystemMemory& Lhs, const FSubsystemMemory& Rhs) {
+		return Lhs.Bytes > Rhs.Bytes;
+	});
+	for (const FSubsystemMemory& Subsystem : SortedSubsystems)
+	{
+		Ar.Logf(TEXT("  %-16s %12.1f KB"), *Subsystem.Name, Subsystem.Bytes / 1024.0);
+	}
+
+	const int32 NumComponents = FMath::Min(Components.Num(), MaxComponents);
+	if (NumComponents > 0)
+	{
+		Ar.Logf(TEXT("  Top %d components by stored schema data:"), NumComponents);
+		for (int32 ComponentIndex = 0; ComponentIndex < NumComponents; ++ComponentIndex)
+		{
+			const FComponentMemory& Memory = Components[ComponentIndex];
+			Ar.Logf(TEXT("    %-10u %12.1f KB %8u instances %10.1f bytes each"), Memory.ComponentId, Memory.SchemaBytes / 1024.0, Memory.Count,
+					static_cast<double>(Memory.SchemaBytes) / Memory.Count);
+		}
+	}
+}
+} // namespace SpatialGDK
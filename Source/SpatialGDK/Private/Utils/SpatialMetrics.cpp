@@ -32,6 +32,8 @@ void USpatialMetrics::Init(USpatialWorkerConnection* InConnection, float InNetSe
 
 	bRPCTrackingEnabled = false;
 	RPCTrackingStartTime = 0.0f;
+	UntrackedRPCCalls = RPCMetrics.RegisterCounter(TEXT("UntrackedRPCs.Calls"));
+	UntrackedRPCTotalPayload = RPCMetrics.RegisterCounter(TEXT("UntrackedRPCs.TotalPayload"));
 
 	UserSuppliedMetric Delegate;
 	Delegate.BindUObject(this, &USpatialMetrics::GetAverageFPS);
@@ -85,6 +87,9 @@ void USpatialMetrics::TickMetrics(float NetDriverTime)
 		UserSuppliedMetrics.Remove(KeyToRemove);
 	}
 
+	AddLatencyMetrics(Metrics);
+	AddFrameProfileMetrics(Metrics);
+
 	TimeOfLastReport = NetDriverTime;
 	FramesSinceLastReport = 0;
 
@@ -118,6 +123,196 @@ void USpatialMetrics::TickMetrics(float NetDriverTime)
 	Connection->SendMetrics(Metrics);
 }
 
+void USpatialMetrics::AddLatencyMetrics(SpatialGDK::SpatialMetrics& Metrics)
+{
+	if (Connection != nullptr && Connection->HasValidCoordinator())
+	{
+		LatencyHistograms[static_cast<uint8>(ESpatialLatencyMetric::OpListApply)].Merge(
+			Connection->GetCoordinator().ConsumeOpListApplyLatency());
+	}
+
+	static const TCHAR* LatencyMetricNames[] = { TEXT("op_list_apply"), TEXT("rpc_receive_to_execute"),
+												 TEXT("entity_creation_round_trip"), TEXT("authority_handover") };
+	static_assert(UE_ARRAY_COUNT(LatencyMetricNames) == static_cast<uint8>(ESpatialLatencyMetric::Count),
+				  "Every latency metric needs a name");
+
+	static const TPair<const TCHAR*, double> Percentiles[] = { { TEXT("p50"), 50.0 },
+															   { TEXT("p90"), 90.0 },
+															   { TEXT("p99"), 99.0 },
+															   { TEXT("p999"), 99.9 } };
+
+	for (int32 MetricIndex = 0; MetricIndex < static_cast<uint8>(ESpatialLatencyMetric::Count); ++MetricIndex)
+	{
+		SpatialGDK::FLatencyHistogram& Histogram = LatencyHistograms[MetricIndex];
+		if (Histogram.GetTotalCount() == 0)
+		{
+			continue;
+		}
+
+		for (const TPair<const TCHAR*, double>& Percentile : Percentiles)
+		{
+			SpatialGDK::GaugeMetric Metric;
+			Metric.Key = TCHAR_TO_UTF8(*FString::Printf(TEXT("unreal_gdk_%s_%s_us"), LatencyMetricNames[MetricIndex], Percentile.Key));
+			Metric.Value = Histogram.GetValueAtPercentile(Percentile.Value);
+			Metrics.GaugeMetrics.Add(Metric);
+		}
+
+		Histogram.Reset();
+	}
+
+	for (auto& Pair : ReplicationLatencyByClass)
+	{
+		SpatialGDK::FLatencyHistogram& Histogram = Pair.Value.SinceLastReport;
+		if (Histogram.GetTotalCount() == 0)
+		{
+			continue;
+		}
+
+		for (const TPair<const TCHAR*, double>& Percentile : Percentiles)
+		{
+			SpatialGDK::GaugeMetric Metric;
+			Metric.Key = TCHAR_TO_UTF8(
+				*FString::Printf(TEXT("unreal_gdk_replication_latency_%s_%s_us"), *Pair.Key.ToString(), Percentile.Key));
+			Metric.Value = Histogram.GetValueAtPercentile(Percentile.Value);
+			Metrics.GaugeMetrics.Add(Metric);
+		}
+
+		Histogram.Reset();
+	}
+}
+
+void USpatialMetrics::AddFrameProfileMetrics(SpatialGDK::SpatialMetrics& Metrics) const
+{
+	if (FrameProfiler.GetNumFrames() == 0)
+	{
+		return;
+	}
+
+	for (uint8 StageIndex = 0; StageIndex < static_cast<uint8>(SpatialGDK::ENetworkFrameStage::Count); ++StageIndex)
+	{
+		const SpatialGDK::ENetworkFrameStage Stage = static_cast<SpatialGDK::ENetworkFrameStage>(StageIndex);
+
+		SpatialGDK::GaugeMetric Metric;
+		Metric.Key = TCHAR_TO_UTF8(*FString::Printf(TEXT("unreal_gdk_frame_%s_p99_us"), SpatialGDK::FNetworkFrameProfiler::GetStageName(Stage)));
+		Metric.Value = FrameProfiler.GetStagePercentileMicroseconds(Stage, 99.0);
+		Metrics.GaugeMetrics.Add(Metric);
+	}
+}
+
+void USpatialMetrics::SpatialDumpNetFrameProfile()
+{
+	FrameProfiler.DumpSummary(*GLog);
+}
+
+void USpatialMetrics::SpatialStartBandwidthAccounting()
+{
+	if (bBandwidthAccountingEnabled)
+	{
+		UE_LOG(LogSpatialMetrics, Log, TEXT("Already recording bandwidth"));
+		return;
+	}
+
+	UE_LOG(LogSpatialMetrics, Log, TEXT("Recording bandwidth"));
+	BandwidthAccounting.Reset();
+	bBandwidthAccountingEnabled = true;
+}
+
+void USpatialMetrics::SpatialStopBandwidthAccounting()
+{
+	if (!bBandwidthAccountingEnabled)
+	{
+		UE_LOG(LogSpatialMetrics, Log, TEXT("Could not stop recording bandwidth. Bandwidth accounting not yet started."));
+		return;
+	}
+
+	SpatialDumpBandwidth(0);
+	bBandwidthAccountingEnabled = false;
+}
+
+void USpatialMetrics::SpatialDumpBandwidth(int32 MaxEntries)
+{
+	constexpr int32 DefaultMaxEntries = 10;
+	BandwidthAccounting.DumpTopEntries(*GLog, MaxEntries > 0 ? MaxEntries : DefaultMaxEntries, FPlatformTime::Seconds());
+}
+
+void USpatialMetrics::TrackComponentBandwidth(SpatialGDK::EBandwidthDirection Direction, Worker_ComponentId ComponentId,
+											  const UObject* Actor, uint32 Bytes)
+{
+	if (!bBandwidthAccountingEnabled)
+	{
+		return;
+	}
+
+	const double NowSeconds = FPlatformTime::Seconds();
+	BandwidthAccounting.RecordComponent(Direction, ComponentId, Bytes, NowSeconds);
+	if (Actor != nullptr)
+	{
+		BandwidthAccounting.RecordActorClass(Direction, Actor->GetClass()->GetFName(), Bytes, NowSeconds);
+	}
+}
+
+void USpatialMetrics::TrackRPCBandwidth(SpatialGDK::EBandwidthDirection Direction, const UFunction* Function, const UObject* Actor,
+										uint32 Bytes)
+{
+	if (!bBandwidthAccountingEnabled || Function == nullptr)
+	{
+		return;
+	}
+
+	const double NowSeconds = FPlatformTime::Seconds();
+	BandwidthAccounting.RecordRPC(Direction, Function->GetOuter()->GetFName(), Function->GetFName(), Bytes, NowSeconds);
+	if (Actor != nullptr)
+	{
+		BandwidthAccounting.RecordActorClass(Direction, Actor->GetClass()->GetFName(), Bytes, NowSeconds);
+	}
+}
+
+void USpatialMetrics::RecordLatency(ESpatialLatencyMetric Metric, uint64 Microseconds)
+{
+	LatencyHistograms[static_cast<uint8>(Metric)].RecordValue(Microseconds);
+}
+
+void USpatialMetrics::RecordLatencySince(ESpatialLatencyMetric Metric, uint64 StartCycles)
+{
+	LatencyHistograms[static_cast<uint8>(Metric)].RecordMicrosecondsSince(StartCycles);
+}
+
+const SpatialGDK::FLatencyHistogram& USpatialMetrics::GetLatencyHistogram(ESpatialLatencyMetric Metric) const
+{
+	return LatencyHistograms[static_cast<uint8>(Metric)];
+}
+
+void USpatialMetrics::RecordReplicationLatency(const UClass* Class, uint64 Microseconds)
+{
+	FReplicationLatencyHistograms& Histograms = ReplicationLatencyByClass.FindOrAdd(Class != nullptr ? Class->GetFName() : NAME_None);
+	Histograms.SinceLastReport.RecordValue(Microseconds);
+	Histograms.Total.RecordValue(Microseconds);
+}
+
+const SpatialGDK::FLatencyHistogram* USpatialMetrics::GetReplicationLatencyHistogram(const UClass* Class) const
+{
+	const FReplicationLatencyHistograms* Histograms = ReplicationLatencyByClass.Find(Class != nullptr ? Class->GetFName() : NAME_None);
+	return Histograms != nullptr ? &Histograms->Total : nullptr;
+}
+
+void USpatialMetrics::SpatialDumpReplicationLatency()
+{
+	if (ReplicationLatencyByClass.Num() == 0)
+	{
+		UE_LOG(LogSpatialMetrics, Log, TEXT("No sampled component updates have been received. Sampling is enabled on the sending worker by "
+											"setting ReplicationLatencySampleRate."));
+		return;
+	}
+
+	UE_LOG(LogSpatialMetrics, Log, TEXT("Replication latency by class (samples / p50 / p99 / max):"));
+	for (const auto& Pair : ReplicationLatencyByClass)
+	{
+		const SpatialGDK::FLatencyHistogram& Histogram = Pair.Value.Total;
+		UE_LOG(LogSpatialMetrics, Log, TEXT("  %-40s %8llu %9lluus %9lluus %9lluus"), *Pair.Key.ToString(), Histogram.GetTotalCount(),
+			   Histogram.GetValueAtPercentile(50.0), Histogram.GetValueAtPercentile(99.0), Histogram.GetMax());
+	}
+}
+
 // Load defined as performance relative to target frame time or just frame time based on config value.
 double USpatialMetrics::CalculateLoad() const
 {
@@ -182,15 +377,32 @@ void USpatialMetrics::SpatialStopRPCMetrics()
 		return;
 	}
 
+	// Gather recorded sent RPCs.
+	TArray<RPCStat> RecentRPCArray;
+	for (const TPair<TWeakObjectPtr<const UFunction>, RPCMetricHandles>& Entry : RPCMetricHandlesByFunction)
+	{
+		const RPCMetricHandles& Handles = Entry.Value;
+		const int64 Calls = RPCMetrics.GetValue(Handles.Calls);
+		if (Calls == 0 || Handles.bUntracked || !Handles.Function.IsValid())
+		{
+			continue;
+		}
+
+		RPCStat Stat;
+		Stat.Type = Handles.Type;
+		Stat.Name = FString::Printf(TEXT("%s::%s"), *Handles.Function->GetOuter()->GetName(), *Handles.Function->GetName());
+		Stat.Calls = static_cast<int>(Calls);
+		Stat.TotalPayload = static_cast<int>(RPCMetrics.GetValue(Handles.TotalPayload));
+		RecentRPCArray.Add(MoveTemp(Stat));
+	}
+
 	// Display recorded sent RPCs.
 	const double TrackRPCInterval = FPlatformTime::Seconds() - RPCTrackingStartTime;
-	UE_LOG(LogSpatialMetrics, Log, TEXT("Recorded %d unique RPCs over the last %.3f seconds:"), RecentRPCs.Num(), TrackRPCInterval);
+	UE_LOG(LogSpatialMetrics, Log, TEXT("Recorded %d unique RPCs over the last %.3f seconds:"), RecentRPCArray.Num(), TrackRPCInterval);
 
-	if (RecentRPCs.Num() > 0)
+	if (RecentRPCArray.Num() > 0)
 	{
 		// NICELY log sent RPCs.
-		TArray<RPCStat> RecentRPCArray;
-		RecentRPCs.GenerateValueArray(RecentRPCArray);
 
 		// Show the most frequently called RPCs at the top.
 		RecentRPCArray.Sort([](const RPCStat& A, const RPCStat& B) {
@@ -240,10 +452,20 @@ void USpatialMetrics::SpatialStopRPCMetrics()
 		UE_LOG(LogSpatialMetrics, Log, TEXT("Total              | %s | %10d | %10.4f | %13d | %12.4f | %11.4f"),
 			   *FString::ChrN(MaxRPCNameLen, ' '), TotalCalls, TotalCalls / TrackRPCInterval, TotalPayload,
 			   (float)TotalPayload / TotalCalls, TotalPayload / TrackRPCInterval);
+	}
 
-		RecentRPCs.Empty();
+	const int64 UntrackedCalls = RPCMetrics.GetValue(UntrackedRPCCalls);
+	if (UntrackedCalls > 0)
+	{
+		UE_LOG(LogSpatialMetrics, Warning,
+			   TEXT("%d RPC functions have no counters, the registry is full (%d counters). Their %lld calls and %lld bytes of payload "
+					"are missing from the table above."),
+			   NumUntrackedRPCFunctions, SpatialGDK::FMetricsRegistry::MaxCounters, UntrackedCalls,
+			   RPCMetrics.GetValue(UntrackedRPCTotalPayload));
 	}
 
+	RPCMetrics.Reset();
+
 	bRPCTrackingEnabled = false;
 
 	// If RPC tracking is stopped on a client, send a command to the server to stop tracking.
@@ -388,22 +610,38 @@ void USpatialMetrics::TrackSentRPC(UFunction* Function, ERPCType RPCType, int Pa
 		return;
 	}
 
-	FString FunctionName = FString::Printf(TEXT("%s::%s"), *Function->GetOuter()->GetName(), *Function->GetName());
+	const RPCMetricHandles& Handles = GetOrRegisterRPCMetric(Function, RPCType);
+	RPCMetrics.Increment(Handles.Calls);
+	RPCMetrics.Increment(Handles.TotalPayload, PayloadSize);
+}
 
-	if (RecentRPCs.Find(FunctionName) == nullptr)
+const USpatialMetrics::RPCMetricHandles& USpatialMetrics::GetOrRegisterRPCMetric(UFunction* Function, ERPCType RPCType)
+{
+	const TWeakObjectPtr<const UFunction> Key(Function);
+	if (const RPCMetricHandles* Handles = RPCMetricHandlesByFunction.Find(Key))
 	{
-		RPCStat Stat;
-		Stat.Name = FunctionName;
-		Stat.Type = RPCType;
-		Stat.Calls = 0;
-		Stat.TotalPayload = 0;
+		return *Handles;
+	}
 
-		RecentRPCs.Add(FunctionName, Stat);
+	RPCMetricHandles Handles;
+	Handles.Function = Function;
+	Handles.Type = RPCType;
+	Handles.Calls = RegisterRPCCounter(*Function, TEXT("Calls"));
+	Handles.TotalPayload = RegisterRPCCounter(*Function, TEXT("TotalPayload"));
+	if (!Handles.Calls.IsValid() || !Handles.TotalPayload.IsValid())
+	{
+		Handles.Calls = UntrackedRPCCalls;
+		Handles.TotalPayload = UntrackedRPCTotalPayload;
+		Handles.bUntracked = true;
+		++NumUntrackedRPCFunctions;
 	}
+	return RPCMetricHandlesByFunction.Add(Key, Handles);
+}
 
-	RPCStat& Stat = RecentRPCs[FunctionName];
-	Stat.Calls++;
-	Stat.TotalPayload += PayloadSize;
+SpatialGDK::FMetricHandle USpatialMetrics::RegisterRPCCounter(const UFunction& Function, const TCHAR* CounterName)
+{
+	// Functions of different classes can share a name, so counters are named after the function's path.
+	return RPCMetrics.RegisterCounter(FName(*FString::Printf(TEXT("%s.%s"), *Function.GetPathName(), CounterName)));
 }
 
 void USpatialMetrics::HandleWorkerMetrics(const Worker_Op& Op)
@@ -5,6 +5,7 @@
 #include "Engine/World.h"
 #include "EngineClasses/SpatialGameInstance.h"
 #include "EngineClasses/SpatialNetDriver.h"
+#include "EngineClasses/SpatialNetDriverRPC.h"
 #include "EngineClasses/SpatialPackageMapClient.h"
 #include "EngineClasses/SpatialWorldSettings.h"
 #include "GeneralProjectSettings.h"
@@ -373,6 +374,33 @@ int64 USpatialStatics::GetMaxDynamicallyAttachedSubobjectsPerClass()
 	return GetDefault<USpatialGDKSettings>()->MaxDynamicallyAttachedSubobjectsPerClass;
 }
 
+ERPCFlowControl USpatialStatics::GetRPCFlowControl(const AActor* Actor, bool bReliable)
+{
+	if (Actor == nullptr)
+	{
+		return ERPCFlowControl::Open;
+	}
+
+	const USpatialNetDriver* SpatialNetDriver = Cast<USpatialNetDriver>(Actor->GetNetDriver());
+	if (SpatialNetDriver == nullptr || !SpatialNetDriver->RPCs.IsValid())
+	{
+		return ERPCFlowControl::Open;
+	}
+
+	ERPCType RPCType;
+	if (SpatialNetDriver->IsServer())
+	{
+		RPCType = bReliable ? ERPCType::ClientReliable : ERPCType::ClientUnreliable;
+	}
+	else
+	{
+		RPCType = bReliable ? ERPCType::ServerReliable : ERPCType::ServerUnreliable;
+	}
+
+	const Worker_EntityId EntityId = SpatialNetDriver->PackageMap->GetEntityIdFromObject(Actor);
+	return SpatialNetDriver->RPCs->GetFlowControl(EntityId, RPCType);
+}
+
 void USpatialStatics::SpatialDebuggerSetOnConfigUIClosedCallback(const UObject* WorldContextObject, FOnConfigUIClosedDelegate Delegate)
 {
 	const UWorld* World = WorldContextObject->GetWorld();
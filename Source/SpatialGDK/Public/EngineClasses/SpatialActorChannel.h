@@ -13,6 +13,7 @@
 #include "Schema/StandardLibrary.h"
 #include "SpatialCommonTypes.h"
 #include "SpatialGDKSettings.h"
+#include "Utils/ChangelistMerger.h"
 #include "Utils/GDKPropertyMacros.h"
 #include "Utils/RepDataUtils.h"
 #include "Utils/SpatialStatics.h"
@@ -207,6 +208,8 @@ public:
 		if (IsAuth && !bIsAuthServer)
 		{
 			AuthorityReceivedTimestamp = FPlatformTime::Cycles64();
+			// Other workers may have changed the arrays while this one wasn't authoritative.
+			SentDeltaArrayLengths.Empty();
 		}
 		bIsAuthServer = IsAuth;
 	}
@@ -271,6 +274,14 @@ public:
 
 	bool NeedOwnerInterestUpdate() const { return bNeedOwnerInterestUpdate; }
 
+	// Records the length an array sent as element deltas is being sent with. Returns false if it has to be sent whole instead, because
+	// it got shorter or this channel hasn't sent it yet: element deltas can't remove elements from the runtime's stored component data.
+	bool RecordSentDeltaArrayLength(UObject* Object, Schema_FieldId FieldId, int32 Length);
+
+	// True if comparing the properties of an object of this class can't find a change: every replicated property of the class
+	// is push based, and none of the object's are dirty.
+	static bool CanSkipPropertyComparison(const SpatialGDK::FRepFieldDispatchTable* FieldDispatchTable, bool bHasDirtyProperties);
+
 protected:
 	// Begin UChannel interface
 	virtual bool CleanUp(const bool bForDestroy, EChannelCloseReason CloseReason) override;
@@ -289,6 +300,12 @@ private:
 
 	void ValidateChannelNotBroken();
 
+	// Merges the changelists made since this replicator last sent into OutRepChanged.
+	void MergeChangelistHistory(FObjectReplicator& Replicator, UObject* Object, TArray<uint16>& OutRepChanged);
+
+	// True if push model shows none of the object's properties changed since they were last compared.
+	bool CanSkipPropertyComparison(const FObjectReplicator& Replicator, UObject* Object) const;
+
 public:
 	// If this actor channel is responsible for creating a new entity, this will be set to true once the entity creation request is issued.
 	bool bCreatedEntity;
@@ -333,6 +350,12 @@ private:
 	// ReplicationBytesWritten is reset back to 0 at the start of ReplicateActor.
 	uint32 ReplicationBytesWritten = 0;
 
+	// Reused by the actor and its subobjects so merging changelists doesn't allocate on every replication.
+	SpatialGDK::FChangelistMerger ChangelistMerger;
+
+	// Length of each array sent as element deltas when this channel last sent it, by object and field.
+	TMap<TWeakObjectPtr<UObject>, TMap<Schema_FieldId, int32>> SentDeltaArrayLengths;
+
 	// Band-aid until we get Actor Sets.
 	// Used on server-side workers only.
 	// Record when this worker receives SpatialOS Position component authority over the Actor.
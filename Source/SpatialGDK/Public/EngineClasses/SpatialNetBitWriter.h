@@ -14,6 +14,7 @@ class SPATIALGDK_API FSpatialNetBitWriter : public FNetBitWriter
 {
 public:
 	FSpatialNetBitWriter(USpatialPackageMapClient* InPackageMap);
+	FSpatialNetBitWriter(USpatialPackageMapClient* InPackageMap, int64 InMaxBits);
 
 	using FArchive::operator<<; // For visibility of the overloads we don't override
 
@@ -26,3 +27,49 @@ public:
 protected:
 	static void SerializeObjectRef(FArchive& Archive, FUnrealObjectRef& ObjectRef);
 };
+
+// Per-thread pool of pre-sized FSpatialNetBitWriters, used when packing RPC payloads so that the writer's buffer
+// isn't allocated and grown again for every RPC. Writers are bucketed by buffer size class and returned to the pool
+// when the FScopedWriter handing them out goes out of scope, so the payload must be copied out before then.
+class SPATIALGDK_API FSpatialNetBitWriterPool
+{
+public:
+	struct FStats
+	{
+		uint64 NumAcquired = 0;
+		uint64 NumReused = 0;
+		uint64 NumDiscarded = 0;
+		int32 NumInUse = 0;
+		int32 HighWaterInUse = 0;
+		int32 NumPooled = 0;
+		int64 HighWaterBytes = 0;
+	};
+
+	class SPATIALGDK_API FScopedWriter
+	{
+	public:
+		FScopedWriter(FScopedWriter&& Other);
+		FScopedWriter(const FScopedWriter&) = delete;
+		FScopedWriter& operator=(FScopedWriter&&) = delete;
+		FScopedWriter& operator=(const FScopedWriter&) = delete;
+		~FScopedWriter();
+
+		FSpatialNetBitWriter& operator*() const { return *Writer; }
+		FSpatialNetBitWriter* operator->() const { return Writer.Get(); }
+
+	private:
+		friend class FSpatialNetBitWriterPool;
+		explicit FScopedWriter(TUniquePtr<FSpatialNetBitWriter>&& InWriter);
+
+		TUniquePtr<FSpatialNetBitWriter> Writer;
+	};
+
+	// SizeHintBytes selects the smallest size class able to hold the expected payload.
+	static FScopedWriter Acquire(USpatialPackageMapClient* PackageMap, int64 SizeHintBytes = 0);
+
+	// Stats for the calling thread's pool.
+	static FStats GetStats();
+
+private:
+	static void Release(TUniquePtr<FSpatialNetBitWriter>&& Writer);
+};
@@ -8,6 +8,7 @@
 #include "Interop/CrossServerRPCSender.h"
 #include "Interop/EntityQueryHandler.h"
 #include "Interop/OwnershipCompletenessHandler.h"
+#include "Utils/ActorReplicationSchedule.h"
 #include "Utils/SpatialBasicAwaiter.h"
 #include "Utils/SpatialDebugger.h"
 
@@ -88,6 +89,7 @@ class InitialOnlyFilter;
 class CrossServerRPCSender;
 class CrossServerRPCHandler;
 class SpatialStrategySystem;
+class FNetworkFrameProfiler;
 } // namespace SpatialGDK
 
 UCLASS()
@@ -120,7 +122,11 @@ public:
 	virtual bool IsLevelInitializedForActor(const AActor* InActor, const UNetConnection* InConnection) const override;
 	virtual void NotifyActorDestroyed(AActor* Actor, bool IsSeamlessTravel = false) override;
 	virtual void Shutdown() override;
+	virtual void SetWorld(UWorld* InWorld) override;
+	virtual void AddNetworkActor(AActor* Actor) override;
+	virtual void RemoveNetworkActor(AActor* Actor) override;
 	virtual void NotifyActorFullyDormantForConnection(AActor* Actor, UNetConnection* NetConnection) override;
+	virtual void ForceNetUpdate(AActor* Actor) override;
 	virtual void OnOwnerUpdated(AActor* Actor, AActor* OldOwner) override;
 
 	virtual void NotifyActorLevelUnloaded(AActor* Actor) override;
@@ -149,6 +155,9 @@ public:
 	// You can check if we connected by calling GetSpatialOS()->IsConnected()
 	USpatialNetConnection* GetSpatialOSNetConnection() const;
 
+	// Null if there are no metrics.
+	SpatialGDK::FNetworkFrameProfiler* GetFrameProfiler() const;
+
 	// When the AcceptingPlayers/SessionID state on the GSM has changed this method will be called.
 	void ClientOnGSMQuerySuccess();
 	void RetryQueryGSM();
@@ -257,6 +266,9 @@ public:
 
 	void DelayedRetireEntity(Worker_EntityId EntityId, float Delay, bool bIsNetStartupActor);
 
+	// Makes the actor be considered for replication on the next tick, e.g. when this worker gains authority over it.
+	void WakeActorForReplication(AActor* Actor);
+
 #if WITH_EDITOR
 	// We store the PlayInEditorID associated with this NetDriver to handle replace a worker initialization when in the editor.
 	int32 PlayInEditorID;
@@ -345,6 +357,7 @@ private:
 	// Could have marked them virtual in base class but that's a pointless source change as these functions are not meant to be called from
 	// anywhere except USpatialNetDriver::ServerReplicateActors.
 	int32 ServerReplicateActors_PrepConnections(const float DeltaSeconds);
+	void ServerReplicateActors_BuildConsiderList(TArray<FNetworkObjectInfo*>& OutConsiderList, const float ServerTickTime);
 	int32 ServerReplicateActors_PrioritizeActors(UNetConnection* Connection, const TArray<FNetViewer>& ConnectionViewers,
 												 FSpatialLoadBalancingHandler&, const TArray<FNetworkObjectInfo*> ConsiderList,
 												 const bool bCPUSaturated, FActorPriority*& OutPriorityList,
@@ -377,6 +390,12 @@ private:
 	int32 ConsiderListSize = 0;
 #endif
 
+	// When each active network actor is next due to be considered for replication, see ServerReplicateActors_BuildConsiderList.
+	// Actors are scheduled as they join the active list and removed as they leave it.
+	SpatialGDK::FActorReplicationSchedule ReplicationSchedule;
+	float NextReplicationScheduleReconcileTime = 0.0f;
+	void ResetReplicationSchedule();
+
 #if WITH_EDITOR
 	static const int32 EDITOR_TOMBSTONED_ENTITY_TRACKING_RESERVATION_COUNT = 256;
 	TArray<Worker_EntityId> TombstonedEntities;
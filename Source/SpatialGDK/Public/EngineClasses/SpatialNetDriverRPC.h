@@ -32,6 +32,11 @@ struct FRPCPayload
 	void WriteToSchema(Schema_Object* RPCObject) const;
 };
 
+inline SIZE_T GetPayloadAllocatedSize(const FRPCPayload& Payload)
+{
+	return Payload.PayloadData.GetAllocatedSize();
+}
+
 /**
  * Payload version for commands, adding a unique Id to try to prevent double-execution
  * when double sending happens.
@@ -135,7 +140,7 @@ public:
 
 	void AdvanceView();
 	virtual void ProcessReceivedRPCs();
-	virtual void FlushRPCUpdates();
+	void FlushRPCUpdates();
 	void FlushRPCQueue(StandardQueue& Queue);
 	void FlushRPCQueueForEntity(Worker_EntityId, StandardQueue& Queue);
 	TArray<FWorkerComponentData> GetRPCComponentsOnEntityCreation(const Worker_EntityId EntityId);
@@ -143,6 +148,13 @@ public:
 	FSpatialGDKSpanId CreatePushRPCEvent(UObject* TargetObject, UFunction* Function);
 	TArray<uint8> CreateRPCPayloadData(UFunction* Function, void* Parameters);
 
+	// Flow-control state and statistics of the locally authoritative sender of the given type for an entity.
+	ERPCFlowControl GetFlowControl(Worker_EntityId EntityId, ERPCType RPCType) const;
+	TOptional<SpatialGDK::RPCSenderStats> GetSenderStats(Worker_EntityId EntityId, ERPCType RPCType) const;
+
+	// Memory held by the RPC senders, queues and receivers, including queued and received payloads.
+	SIZE_T GetAllocatedSize() const;
+
 protected:
 	void MakeRingBufferWithACKSender(ERPCType RPCType, Worker_ComponentSetId AuthoritySet,
 									 TUniquePtr<SpatialGDK::RPCBufferSender>& SenderPtr,
@@ -153,6 +165,11 @@ protected:
 
 	virtual void GetRPCComponentsOnEntityCreation(const Worker_EntityId EntityId, TArray<FWorkerComponentData>& OutData);
 
+	// Write functions expect an update context to be opened, see FlushRPCUpdates.
+	virtual void WriteQueuedRPCs();
+	void WriteRPCQueue(StandardQueue& Queue);
+	void WriteACKs();
+
 	struct UpdateToSend : FNoHeapAllocation
 	{
 		Worker_EntityId EntityId;
@@ -162,6 +179,7 @@ protected:
 	StandardQueue::SentRPCCallback MakeRPCSentCallback();
 	SpatialGDK::RPCCallbacks::UpdateWritten MakeDataWriteCallback(TArray<FWorkerComponentData>& OutArray) const;
 	SpatialGDK::RPCCallbacks::UpdateWritten MakeUpdateWriteCallback();
+	SpatialGDK::RPCCallbacks::UpdateWritten MakeACKWriteCallback();
 
 	static void OnRPCSent(SpatialGDK::SpatialEventTracer& EventTracer, TArray<UpdateToSend>& OutUpdates, FName Name,
 						  Worker_EntityId EntityId, Worker_ComponentId ComponentId, uint64 RPCId, const FSpatialGDKSpanId& SpanId);
@@ -169,6 +187,7 @@ protected:
 							  Schema_ComponentUpdate* InData);
 	static void OnUpdateWritten(TArray<UpdateToSend>& OutUpdates, Worker_EntityId EntityId, Worker_ComponentId ComponentId,
 								Schema_ComponentUpdate* InUpdate);
+	static void MergeUpdate(FWorkerComponentUpdate& Update, Schema_ComponentUpdate* InUpdate);
 
 	bool CanExtractRPC(Worker_EntityId EntityId) const;
 	bool CanExtractRPCOnServer(Worker_EntityId EntityId) const;
@@ -178,8 +197,17 @@ protected:
 	SpatialGDK::SpatialEventTracer* EventTracer = nullptr;
 	TUniquePtr<SpatialGDK::RPCService> RPCService;
 
+	struct SenderAndQueue
+	{
+		SpatialGDK::RPCBufferSender* Sender;
+		SpatialGDK::TRPCQueue<FRPCPayload, FSpatialGDKSpanId>* Queue;
+	};
+	TMap<ERPCType, SenderAndQueue> SendersByType;
+
 	// Caching the array of updates to send, to avoid a reallocation each frame.
 	TArray<UpdateToSend> UpdateToSend_Cache;
+	// Index of the pending update for each entity/component, used to merge ACKs into already written updates.
+	TMap<SpatialGDK::EntityComponentId, int32> PendingUpdateIndices_Cache;
 	std::atomic<bool> bUpdateCacheInUse;
 	struct RAIIUpdateContext;
 
@@ -200,7 +228,6 @@ public:
 							   const SpatialGDK::FSubView& InActorNonAuthSubView);
 
 	void ProcessReceivedRPCs() override;
-	void FlushRPCUpdates() override;
 
 	TUniquePtr<SpatialGDK::TRPCQueue<FRPCPayload, FSpatialGDKSpanId>> ClientReliableQueue;
 	TUniquePtr<SpatialGDK::TRPCQueue<FRPCPayload, FSpatialGDKSpanId>> ClientUnreliableQueue;
@@ -208,6 +235,7 @@ public:
 
 protected:
 	void GetRPCComponentsOnEntityCreation(const Worker_EntityId EntityId, TArray<FWorkerComponentData>& OutData) override;
+	void WriteQueuedRPCs() override;
 
 	TUniquePtr<SpatialGDK::RPCBufferSender> ClientReliableSender;
 	TUniquePtr<SpatialGDK::RPCBufferSender> ClientUnreliableSender;
@@ -226,13 +254,13 @@ public:
 							   const SpatialGDK::FSubView& InActorNonAuthSubView);
 
 	void ProcessReceivedRPCs() override;
-	void FlushRPCUpdates() override;
 
 	TUniquePtr<SpatialGDK::TRPCQueue<FRPCPayload, FSpatialGDKSpanId>> ServerReliableQueue;
 	TUniquePtr<SpatialGDK::TRPCQueue<FRPCPayload, FSpatialGDKSpanId>> ServerUnreliableQueue;
 
 protected:
 	void GetRPCComponentsOnEntityCreation(const Worker_EntityId EntityId, TArray<FWorkerComponentData>& OutData) override;
+	void WriteQueuedRPCs() override;
 
 	TUniquePtr<SpatialGDK::RPCBufferSender> ServerReliableSender;
 	TUniquePtr<SpatialGDK::RPCBufferSender> ServerUnreliableSender;
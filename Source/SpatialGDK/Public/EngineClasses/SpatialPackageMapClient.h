@@ -99,6 +99,8 @@ public:
 	FNetworkGUID GetNetGUIDFromUnrealObjectRef(const FUnrealObjectRef& ObjectRef);
 	FUnrealObjectRef GetUnrealObjectRefFromNetGUID(const FNetworkGUID& NetGUID) const;
 	FNetworkGUID GetNetGUIDFromEntityId(Worker_EntityId EntityId) const;
+	// Same as GetUnrealObjectRefFromNetGUID(NetGUID).Entity, without copying the object ref.
+	Worker_EntityId GetEntityIdFromNetGUID(const FNetworkGUID& NetGUID) const;
 
 	void NetworkRemapObjectRefPaths(FUnrealObjectRef& ObjectRef, bool bReading) const;
 
@@ -106,6 +108,9 @@ public:
 	// to undo the unintended registering of objects when looking them up with static paths.
 	void UnregisterActorObjectRefOnly(const FUnrealObjectRef& ObjectRef);
 
+	// Includes the engine's own lookup maps as well as the Spatial ones.
+	SIZE_T GetAllocatedSize() const;
+
 private:
 	FNetworkGUID GetNetGUIDFromUnrealObjectRefInternal(const FUnrealObjectRef& ObjectRef);
 
@@ -115,6 +120,17 @@ private:
 	FNetworkGUID RegisterNetGUIDFromPathForStaticObject(const FString& PathName, const FNetworkGUID& OuterGUID, bool bNoLoadOnClient);
 	FNetworkGUID GenerateNewNetGUID(const int32 IsStatic);
 
+	// Refs to entities and their subobjects are looked up in EntityObjectNetGUIDs, every other ref in UnrealObjectRefToNetGUID.
+	static bool IsEntityObjectRef(const FUnrealObjectRef& ObjectRef);
+	const FNetworkGUID* FindNetGUID(const FUnrealObjectRef& ObjectRef) const;
+	void AddNetGUIDLookup(const FUnrealObjectRef& ObjectRef, const FNetworkGUID& NetGUID);
+	void RemoveNetGUIDLookup(const FUnrealObjectRef& ObjectRef);
+
 	TMap<FNetworkGUID, FUnrealObjectRef> NetGUIDToUnrealObjectRef;
 	TMap<FUnrealObjectRef, FNetworkGUID> UnrealObjectRefToNetGUID;
+
+	// Most lookups are for an entity ID and offset, which don't need the path and outer hashed and compared.
+	// An entity only has a handful of subobjects, so their offsets are scanned rather than hashed.
+	using FEntityObjectNetGUIDs = TArray<TPair<ObjectOffset, FNetworkGUID>, TInlineAllocator<4>>;
+	TMap<Worker_EntityId_Key, FEntityObjectNetGUIDs> EntityObjectNetGUIDs;
 };
@@ -5,6 +5,7 @@
 #include "Schema/SpawnData.h"
 #include "Schema/UnrealMetadata.h"
 #include "Utils/RepDataUtils.h"
+#include "Utils/ReplicationLatencyStamp.h"
 
 #include "Interop/ClientNetLoadActorHelper.h"
 #include "Interop/CreateEntityHandler.h"
@@ -30,6 +31,7 @@ namespace SpatialGDK
 {
 class SpatialEventTracer;
 class FSubView;
+class FNetworkFrameProfiler;
 
 struct ActorData
 {
@@ -44,7 +46,7 @@ public:
 				const FSubView& InSimulatedSubView, const FSubView& InTombstoneSubView, USpatialNetDriver* InNetDriver,
 				SpatialEventTracer* InEventTracer);
 
-	void Advance();
+	void Advance(FNetworkFrameProfiler* FrameProfiler = nullptr);
 
 	UnrealMetadata* GetUnrealMetadata(Worker_EntityId EntityId);
 
@@ -111,6 +113,7 @@ private:
 
 	void AuthorityLost(Worker_EntityId EntityId, Worker_ComponentSetId ComponentSetId);
 	void AuthorityGained(Worker_EntityId EntityId, Worker_ComponentSetId ComponentSetId);
+	void RecordAuthorityHandoverLatency(Worker_EntityId EntityId) const;
 	void HandleActorAuthority(Worker_EntityId EntityId, Worker_ComponentSetId ComponentSetId, Worker_Authority Authority);
 
 	void ComponentAdded(Worker_EntityId EntityId, Worker_ComponentId ComponentId, Schema_ComponentData* Data);
@@ -193,6 +196,8 @@ private:
 
 	// Deserialized state store for Actor relevant components.
 	TMap<Worker_EntityId_Key, ActorData> ActorDataStore;
+
+	FReplicationLatencySampler ReplicationLatencySampler;
 };
 
 } // namespace SpatialGDK
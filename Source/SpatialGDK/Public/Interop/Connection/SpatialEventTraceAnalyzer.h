@@ -0,0 +1,171 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Interop/Connection/SpatialEventTraceWriter.h"
+
+namespace SpatialGDK
+{
+// Rebuilds causal chains from event trace files written by FSpatialEventTraceWriter, possibly from several workers.
+// A chain runs from a root event, such as an RPC being pushed, to a terminal event, such as that RPC being applied.
+// It is found by following span causes back from the terminal event. Timestamps are UTC, so when a chain crosses
+// machines, its latency includes their clock offset.
+// Only the spans of the last chain timeout of trace time are kept: older terminal events are resolved or counted as incomplete,
+// then older spans are dropped. The terminal span of a complete chain is dropped right away, the rest of it can be shared with
+// other chains, so it is kept until it times out.
+class SPATIALGDK_API FSpatialEventTraceAnalyzer
+{
+public:
+	struct FChainDefinition
+	{
+		FName Name;
+		FName RootEventType;
+		FName TerminalEventType;
+	};
+
+	struct FLatencyStats
+	{
+		FString Name;
+		int32 Count = 0;
+		double P50Microseconds = 0.0;
+		double P90Microseconds = 0.0;
+		double P99Microseconds = 0.0;
+		double MaxMicroseconds = 0.0;
+	};
+
+	struct FWorkerThroughput
+	{
+		FName Worker;
+		uint64 NumEvents = 0;
+		double DurationSeconds = 0.0;
+		double EventsPerSecond = 0.0;
+		TMap<FName, uint64> EventCounts;
+	};
+
+	struct FChainStep
+	{
+		FName Worker;
+		FName EventType;
+		FDateTime Timestamp;
+	};
+
+	struct FChain
+	{
+		FName ChainName;
+		double LatencyMicroseconds = 0.0;
+		TArray<FChainStep> Steps;
+	};
+
+	struct FResults
+	{
+		// One entry per chain definition that had at least one complete chain.
+		TArray<FLatencyStats> ChainLatencies;
+		// Latency between consecutive events of complete chains, named "<from> -> <to>".
+		TArray<FLatencyStats> HopLatencies;
+		TArray<FWorkerThroughput> Workers;
+		// Slowest first.
+		TArray<FChain> SlowestChains;
+		// Terminal events whose root could not be found, usually because it was sampled out, is in a file that wasn't read
+		// or is further back than the chain timeout.
+		int32 NumIncompleteChains = 0;
+	};
+
+	struct FTraceFile
+	{
+		FString FilePath;
+		FName Worker;
+	};
+
+	static constexpr int32 DefaultMaxSlowestChains = 100;
+	static constexpr double DefaultChainTimeoutSeconds = 30.0;
+
+	// RPC push to apply, property change to receive and cross-server RPC send to apply.
+	static TArray<FChainDefinition> GetDefaultChainDefinitions();
+
+	// Only the slowest InMaxSlowestChains chains keep their steps, so Analyze can't report more than that.
+	explicit FSpatialEventTraceAnalyzer(TArray<FChainDefinition> InChainDefinitions = GetDefaultChainDefinitions(),
+										int32 InMaxSlowestChains = DefaultMaxSlowestChains,
+										FTimespan InChainTimeout = FTimespan::FromSeconds(DefaultChainTimeoutSeconds));
+
+	// Reads every item of the files, merged in timestamp order so that chains across workers complete before they time out.
+	// The tracer writes each worker's files into a folder named after the worker ID. Returns the files that couldn't be read.
+	TArray<FString> AddFiles(const TArray<FTraceFile>& Files);
+	bool AddFile(const FString& FilePath, FName Worker);
+	void AddItem(const FSpatialEventTraceReader::FItem& Item, FName Worker);
+
+	FResults Analyze(int32 MaxSlowestChains) const;
+
+	// The number of spans currently kept.
+	int32 GetNumSpans() const { return Nodes.Num(); }
+
+private:
+	struct FSpanKey
+	{
+		uint8 Bytes[TRACE_SPAN_ID_SIZE_BYTES] = {};
+
+		explicit FSpanKey(const TArray<uint8>& SpanId);
+
+		bool operator==(const FSpanKey& Other) const { return FMemory::Memcmp(Bytes, Other.Bytes, sizeof(Bytes)) == 0; }
+		friend uint32 GetTypeHash(const FSpanKey& Key) { return FCrc::MemCrc32(Key.Bytes, sizeof(Key.Bytes)); }
+	};
+
+	// Spans and their events are written as separate items with the same span ID.
+	struct FSpanNode
+	{
+		TArray<FSpanKey> Causes;
+		FName EventType;
+		FName Worker;
+		FDateTime Timestamp;
+	};
+
+	// A terminal event waiting for its chain's root.
+	struct FPendingChain
+	{
+		FSpanKey Terminal;
+		int32 DefinitionIndex;
+	};
+
+	// What is left of complete chains once their spans are dropped.
+	struct FChainResults
+	{
+		TArray<TArray<double>> ChainLatencies;
+		TMap<FString, TArray<double>> HopLatencies;
+		// Slowest first, at most MaxKeptSlowestChains.
+		TArray<FChain> SlowestChains;
+		int32 NumIncompleteChains = 0;
+	};
+
+	bool FindPathToRoot(const FSpanKey& Key, FName RootEventType, TSet<FSpanKey>& Visited, TArray<const FSpanNode*>& OutPath) const;
+
+	// Returns false if the chain's root isn't among the kept spans.
+	bool TryCompleteChain(const FPendingChain& Pending, FChainResults& OutResults) const;
+
+	// Completes or times out pending chains, then drops the spans older than the chain timeout.
+	void DropExpiredSpans();
+
+	static FLatencyStats MakeLatencyStats(FString Name, TArray<double>& Values);
+
+	struct FWorkerState
+	{
+		TMap<FName, uint64> EventCounts;
+		uint64 NumEvents = 0;
+		FDateTime FirstEventTime = FDateTime::MaxValue();
+		FDateTime LastEventTime = FDateTime::MinValue();
+	};
+
+	TArray<FChainDefinition> ChainDefinitions;
+	int32 MaxKeptSlowestChains;
+	FTimespan ChainTimeout;
+
+	TMap<FSpanKey, FSpanNode> Nodes;
+	TMap<FName, FWorkerState> Workers;
+	TArray<FPendingChain> PendingChains;
+	FChainResults CompletedChains;
+
+	// The latest timestamp added, and when spans are next checked against the chain timeout.
+	FDateTime LatestTimestamp = FDateTime::MinValue();
+	FDateTime NextExpiryCheck = FDateTime::MinValue();
+};
+} // namespace SpatialGDK
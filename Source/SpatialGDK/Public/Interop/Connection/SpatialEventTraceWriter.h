@@ -0,0 +1,235 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+
+#include <WorkerSDK/improbable/c_trace.h>
+
+#include <atomic>
+
+class FRunnableThread;
+class IFileHandle;
+
+namespace SpatialGDK
+{
+class FSpatialTraceEventDataBuilder;
+
+// Layout of the binary event trace files written by FSpatialEventTraceWriter.
+//
+// File header: uint32 Magic, uint16 Version, uint16 SpanIdSize, int64 StartUtcTicks, uint64 StartCycles, double SecondsPerCycle.
+// Each record: uint32 PayloadSize, then the payload:
+//   uint8 ItemType (ESpatialTraceItemType), uint64 Cycles, uint8[SpanIdSize] SpanId,
+//   span:  uint16 NumCauses, uint8[SpanIdSize * NumCauses] Causes
+//   event: String Type, String Message, uint16 NumFields, String Key/String Value * NumFields
+// Strings are stored as a uint16 length followed by that many ANSI characters. All values are little-endian.
+namespace SpatialEventTraceFormat
+{
+constexpr uint32 Magic = 0x544B4447; // "GDKT"
+constexpr uint16 Version = 1;
+constexpr uint32 FileHeaderSize = 4 + 2 + 2 + 8 + 8 + 8;
+// Named apart from the SDK's .etlog trace files, since tools for those can't read this format.
+constexpr const TCHAR* FileName = TEXT("gdk_events");
+constexpr const TCHAR* FileExtension = TEXT(".gdktrace");
+} // namespace SpatialEventTraceFormat
+
+enum class ESpatialTraceItemType : uint8
+{
+	Event = 0,
+	Span = 1,
+};
+
+// Bounded multi-producer, single-consumer ring buffer of variable sized records.
+// Producers reserve space with a CAS on the write position, fill it in and publish it by setting the record header.
+// The consumer reads published records in reservation order, so a slow producer holds back the records behind it.
+class SPATIALGDK_API FEventTraceRingBuffer
+{
+public:
+	// Capacity is rounded up to a power of two.
+	explicit FEventTraceRingBuffer(uint32 InCapacity);
+
+	// Reserves space for a record of Size bytes. Returns nullptr if there is not enough free space.
+	uint8* BeginWrite(uint32 Size, uint64& OutRecordPosition);
+	void EndWrite(uint64 RecordPosition, uint32 Size);
+
+	// Consumer only. Calls Callback(const uint8* Data, uint32 Size) for each published record, and frees their space.
+	template <typename FuncType>
+	uint32 ConsumePublished(FuncType&& Callback);
+
+	uint64 GetCapacity() const { return Capacity; }
+
+private:
+	static constexpr uint64 HeaderSize = sizeof(int64);
+	static constexpr uint64 PublishedBit = 1ull << 63;
+	static constexpr uint64 PaddingBit = 1ull << 62;
+
+	static uint64 GetRecordSize(uint32 PayloadSize) { return Align(HeaderSize + PayloadSize, HeaderSize); }
+	volatile int64* GetHeader(uint64 Position) { return reinterpret_cast<volatile int64*>(Data + (Position & Mask)); }
+
+	TArray<uint64> Storage;
+	uint8* Data;
+	uint64 Capacity;
+	uint64 Mask;
+
+	std::atomic<uint64> WritePosition{ 0 };
+	std::atomic<uint64> ReadPosition{ 0 };
+};
+
+// Serializes trace items into an FEventTraceRingBuffer on the calling thread, and writes them to disk on a dedicated thread.
+// Items are dropped and counted when the ring buffer is full, so tracing never blocks the caller.
+class SPATIALGDK_API FSpatialEventTraceWriter : public FRunnable
+{
+public:
+	struct FParameters
+	{
+		FString FolderPath;
+		FString FileName;
+		FString FileExtension;
+		uint32 BufferSizeBytes = 0;
+		// 0 indicates unbounded.
+		int64 MaxFileSizeBytes = 0;
+		// If set, a new file is started whenever the current one is full, keeping at most MaxFileCount files.
+		bool bRotateFiles = false;
+		int32 MaxFileCount = 0;
+	};
+
+	struct FStats
+	{
+		uint64 ItemsWritten = 0;
+		uint64 BytesWritten = 0;
+		// Items which could not be added because the ring buffer was full.
+		uint64 ItemsDropped = 0;
+		uint64 BytesDropped = 0;
+		// Items which were discarded because the (non-rotating) file reached its maximum size.
+		uint64 ItemsDiscardedFileFull = 0;
+	};
+
+	explicit FSpatialEventTraceWriter(FParameters InParameters);
+	virtual ~FSpatialEventTraceWriter();
+
+	// Thread safe.
+	void WriteItem(const Trace_Item& Item, const FSpatialTraceEventDataBuilder* EventData);
+
+	// Blocks until everything written before the call is on disk.
+	void Flush();
+	void SetFlushOnWrite(bool bValue);
+
+	FStats GetStats() const;
+	bool IsValid() const { return bIsValid; }
+
+	// FRunnable
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+
+private:
+	void WriteEvent(const Trace_Event& Event, const FSpatialTraceEventDataBuilder* EventData);
+	void WriteSpan(const Trace_Span& Span);
+	void OnItemPublished();
+	void CountDroppedItem(uint32 Size);
+
+	// Writer thread only.
+	void DrainRingBuffer();
+	bool OpenNextFile();
+	void WriteToFile(const uint8* Bytes, uint32 Size);
+	void FlushStagingBuffer();
+
+	FParameters Parameters;
+	FEventTraceRingBuffer RingBuffer;
+
+	FRunnableThread* Thread = nullptr;
+	FEvent* WakeEvent = nullptr;
+	std::atomic<bool> bStopping{ false };
+	std::atomic<bool> bFlushOnWrite{ false };
+	std::atomic<uint64> FlushesRequested{ 0 };
+	std::atomic<uint64> FlushesCompleted{ 0 };
+	bool bIsValid = false;
+
+	std::atomic<uint64> ItemsWritten{ 0 };
+	std::atomic<uint64> BytesWritten{ 0 };
+	std::atomic<uint64> ItemsDropped{ 0 };
+	std::atomic<uint64> BytesDropped{ 0 };
+	std::atomic<uint64> ItemsDiscardedFileFull{ 0 };
+	std::atomic<bool> bHasLoggedDrop{ false };
+
+	// Writer thread state.
+	TUniquePtr<IFileHandle> File;
+	TArray<uint8> StagingBuffer;
+	int64 CurrentFileSize = 0;
+	int32 CurrentFileIndex = -1;
+	bool bFileFull = false;
+};
+
+// Reads files written by FSpatialEventTraceWriter, one record at a time.
+class SPATIALGDK_API FSpatialEventTraceReader
+{
+public:
+	struct FItem
+	{
+		ESpatialTraceItemType Type;
+		FDateTime Timestamp;
+		TArray<uint8> SpanId;
+		// Spans only.
+		TArray<TArray<uint8>> Causes;
+		// Events only.
+		FString EventType;
+		FString Message;
+		TArray<TPair<FString, FString>> Data;
+	};
+
+	// Returns false if the file could not be read or is not an event trace file.
+	bool Open(const FString& FilePath);
+
+	// Returns false at the end of the file, or if the next record is malformed.
+	bool ReadNextItem(FItem& OutItem);
+
+private:
+	TUniquePtr<FArchive> File;
+	int64 FileSize = 0;
+	// Holds the record being read, so it only grows to the size of the largest record rather than the file.
+	TArray<uint8> RecordBuffer;
+	uint16 SpanIdSize = 0;
+	int64 StartUtcTicks = 0;
+	uint64 StartCycles = 0;
+	double SecondsPerCycle = 0.0;
+};
+
+template <typename FuncType>
+uint32 FEventTraceRingBuffer::ConsumePublished(FuncType&& Callback)
+{
+	const uint64 StartPosition = ReadPosition.load(std::memory_order_relaxed);
+	const uint64 EndPosition = WritePosition.load(std::memory_order_acquire);
+
+	uint64 Position = StartPosition;
+	while (Position < EndPosition)
+	{
+		volatile int64* Header = GetHeader(Position);
+		const uint64 HeaderValue = static_cast<uint64>(FPlatformAtomics::AtomicRead(Header));
+		if ((HeaderValue & PublishedBit) == 0)
+		{
+			break;
+		}
+
+		const uint64 Offset = Position & Mask;
+		uint64 RecordSize;
+		if ((HeaderValue & PaddingBit) != 0)
+		{
+			RecordSize = Capacity - Offset;
+		}
+		else
+		{
+			const uint32 PayloadSize = static_cast<uint32>(HeaderValue);
+			RecordSize = GetRecordSize(PayloadSize);
+			Callback(Data + Offset + HeaderSize, PayloadSize);
+		}
+
+		// Headers of later records can land anywhere in this space, so it must be cleared before it is reused.
+		FMemory::Memzero(Data + Offset, RecordSize);
+		Position += RecordSize;
+	}
+
+	ReadPosition.store(Position, std::memory_order_release);
+	return static_cast<uint32>(Position - StartPosition);
+}
+
+} // namespace SpatialGDK
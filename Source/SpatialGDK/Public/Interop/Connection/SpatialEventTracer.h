@@ -2,13 +2,14 @@
 
 #pragma once
 
+#include "Interop/Connection/SpatialEventTraceWriter.h"
 #include "Interop/Connection/SpatialGDKSpanId.h"
 #include "Interop/Connection/SpatialTraceEventDataBuilder.h"
+#include "Interop/Connection/SpatialTraceSampler.h"
 #include "Interop/Connection/UserSpanId.h"
 #include "SpatialCommonTypes.h"
 #include "SpatialView/EntityComponentId.h"
 
-#include <WorkerSDK/improbable/c_io.h>
 #include <WorkerSDK/improbable/c_trace.h>
 
 // Documentation for event tracing in the GDK can be found here: https://brevi.link/gdk-event-tracing-documentation
@@ -56,33 +57,28 @@ public:
 	FSpatialGDKSpanId PopLatentPropertyUpdateSpanId(const TWeakObjectPtr<UObject>& Object);
 
 	void SetFlushOnWrite(bool bValue);
+	// Blocks until all trace items recorded so far have been written to disk.
+	void Flush();
+	FSpatialEventTraceWriter::FStats GetWriterStats() const;
 
-private:
-	struct StreamDeleter
-	{
-		void operator()(Io_Stream* StreamToDestroy) const
-		{
-			if (StreamToDestroy != nullptr)
-			{
-				Io_Stream_Destroy(StreamToDestroy);
-			}
-		}
-	};
+	// Per event type rate limits for events which start a trace chain. Can be adjusted at runtime.
+	FSpatialTraceSampler& GetSampler() { return Sampler; }
 
+private:
 	static void TraceCallback(void* UserData, const Trace_Item* Item);
 
+	void AddEvent(Trace_Event& Event, const FSpatialTraceEventDataBuilder& EventData) const;
+
 	FString FolderPath;
 
-	int32 FlushOnWriteAtomic = 0;
-	TUniquePtr<Io_Stream, StreamDeleter> Stream;
+	// Trace items are serialized on the calling thread and written to disk on the writer's thread.
+	TUniquePtr<FSpatialEventTraceWriter> Writer;
 	Trace_EventTracer* EventTracer = nullptr;
+	mutable FSpatialTraceSampler Sampler;
 
 	TArray<FSpatialGDKSpanId> SpanIdStack;
 	TMap<TWeakObjectPtr<UObject>, FSpatialGDKSpanId> ObjectSpanIdStacks;
 
-	uint64 BytesWrittenToStream = 0;
-	uint64 MaxFileSize = 0;
-
 	// Span IDs received from the wire, these live for a frame and are expected to continue into the stack
 	// on an ops tick.
 	TMap<EntityComponentId, TArray<FSpatialGDKSpanId>> EntityComponentSpanIds;
@@ -120,6 +116,18 @@ FSpatialGDKSpanId SpatialEventTracer::TraceEvent(const char* EventType, const ch
 	// This would allow for sampling dependent on trace event data.
 	Trace_Event Event = { nullptr, 0, Message, EventType, nullptr };
 
+	if (!Sampler.ShouldSample(EventType, Causes, NumCauses))
+	{
+		return FSpatialGDKSpanId(FSpatialTraceSampler::GetUnsampledSpanId());
+	}
+
+	FSpatialTraceSampler::FCauseArray SampledCauses;
+	if (FSpatialTraceSampler::HasUnsampledCause(Causes, NumCauses))
+	{
+		NumCauses = FSpatialTraceSampler::CopySampledCauses(Causes, NumCauses, SampledCauses);
+		Causes = SampledCauses.GetData();
+	}
+
 	if (!Trace_EventTracer_ShouldSampleSpan(EventTracer, Causes, NumCauses, &Event))
 	{
 		return {};
@@ -141,7 +149,7 @@ FSpatialGDKSpanId SpatialEventTracer::TraceEvent(const char* EventType, const ch
 	EventDataBuilder.AddKeyValue("frame_num", GFrameCounter);
 
 	Event.data = EventDataBuilder.GetEventData();
-	Trace_EventTracer_AddEvent(EventTracer, &Event);
+	AddEvent(Event, EventDataBuilder);
 	return TraceSpanId;
 }
 
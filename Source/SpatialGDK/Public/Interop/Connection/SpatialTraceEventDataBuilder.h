@@ -114,11 +114,16 @@ public:
 	void AddKeyValue(const char* Key, const int64 Value);
 	void AddKeyValue(const char* Key, const bool bValue);
 
-	const Trace_EventData* GetEventData() { return EventData; };
+	const Trace_EventData* GetEventData() const { return EventData; };
+
+	int32 GetNumKeyValues() const { return KeyValueHandles.Num(); }
+	const char* GetKey(int32 Index) const { return StringConverter.Get(KeyValueHandles[Index].Key); }
+	const char* GetValue(int32 Index) const { return StringConverter.Get(KeyValueHandles[Index].Value); }
 
 private:
 	Trace_EventData* EventData;
 	FStringCache StringConverter;
+	TArray<TPair<int32, int32>, TInlineAllocator<16>> KeyValueHandles;
 
 	void AddKeyValue(int32 KeyHandle, int32 ValueHandle);
 
@@ -0,0 +1,96 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/ScopeRWLock.h"
+
+#include <WorkerSDK/improbable/c_trace.h>
+
+#include <atomic>
+
+namespace SpatialGDK
+{
+// Head-based sampler used by SpatialEventTracer before the worker's own sampling.
+// Events with a sampled cause continue their trace chain and are always kept, so chains are never cut short.
+// Events without a sampled cause start a new chain, and are limited by a token bucket for their event type.
+// A dropped head is given the unsampled span ID, and events caused only by it are dropped too, so chains are never started halfway.
+// Buckets are found by the event type pointer and updated with atomics, so sampling takes no exclusive lock after an event type's
+// first use.
+class SPATIALGDK_API FSpatialTraceSampler
+{
+public:
+	struct FBudget
+	{
+		// <= 0 means unlimited.
+		double TokensPerSecond = 0.0;
+		// <= 0 means one second's worth of tokens.
+		double BurstSize = 0.0;
+	};
+
+	struct FCategoryStats
+	{
+		FName Category;
+		FBudget Budget;
+		uint64 NumSampled = 0;
+		uint64 NumRateLimited = 0;
+	};
+
+	FSpatialTraceSampler() = default;
+	FSpatialTraceSampler(const FBudget& InDefaultBudget, const TMap<FName, FBudget>& InCategoryBudgets);
+
+	bool ShouldSample(const char* EventType, const Trace_SpanIdType* Causes, int32 NumCauses);
+	bool ShouldSample(const char* EventType, const Trace_SpanIdType* Causes, int32 NumCauses, double NowSeconds);
+
+	// Budgets can be changed at any time, and apply from the next sampled event.
+	void SetDefaultBudget(const FBudget& Budget);
+	void SetCategoryBudget(FName Category, const FBudget& Budget);
+	void ClearCategoryBudget(FName Category);
+
+	TArray<FCategoryStats> GetStats() const;
+	void ResetStats();
+
+	using FCauseArray = TArray<Trace_SpanIdType, TInlineAllocator<TRACE_SPAN_ID_SIZE_BYTES * 4>>;
+
+	// Whether any cause is a span which was sampled, and is not the unsampled span ID.
+	static bool HasSampledCause(const Trace_SpanIdType* Causes, int32 NumCauses);
+	static bool HasUnsampledCause(const Trace_SpanIdType* Causes, int32 NumCauses);
+	// Copies the causes without the unsampled span ID, which must not reach the worker SDK.
+	static int32 CopySampledCauses(const Trace_SpanIdType* Causes, int32 NumCauses, FCauseArray& OutCauses);
+
+	// Span ID returned for events dropped by the sampler. It is never given to the worker SDK.
+	static const Trace_SpanIdType* GetUnsampledSpanId();
+	static bool IsUnsampledSpanId(const Trace_SpanIdType* SpanId);
+
+private:
+	// Generic cell rate algorithm: the bucket is the time at which it would be full again, advanced by one interval per event.
+	struct FTokenBucket
+	{
+		FBudget Budget;
+		bool bHasCategoryBudget = false;
+		// Null terminated, compared with cached event type pointers.
+		TArray<ANSICHAR> Category;
+
+		std::atomic<double> EmissionInterval{ 0.0 };
+		std::atomic<double> BurstTolerance{ 0.0 };
+		std::atomic<double> TheoreticalArrivalSeconds{ 0.0 };
+		std::atomic<uint64> NumSampled{ 0 };
+		std::atomic<uint64> NumRateLimited{ 0 };
+
+		void SetBudget(const FBudget& InBudget, double NowSeconds);
+		bool TryConsume(double NowSeconds);
+	};
+
+	FTokenBucket& FindOrAddBucket(const char* EventType, double NowSeconds);
+	FTokenBucket& FindOrAddBucketLocked(FName Category, double NowSeconds);
+
+	// Bounds the event type cache, which can see many pointers for event types built at runtime.
+	static constexpr int32 MaxCachedEventTypes = 1024;
+
+	mutable FRWLock BucketsLock;
+	FBudget DefaultBudget;
+	TMap<FName, TUniquePtr<FTokenBucket>> Buckets;
+	// Event types are mostly string literals, so their pointers find the bucket without building an FName.
+	TMap<const char*, FTokenBucket*> BucketsByEventType;
+};
+} // namespace SpatialGDK
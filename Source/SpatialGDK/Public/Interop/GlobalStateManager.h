@@ -113,6 +113,7 @@ public:
 
 private:
 	void SetDeploymentMapURL(const FString& MapURL);
+	void SetSchemaHash(uint32 InSchemaHash);
 	void SendSessionIdUpdate();
 
 	void SendCanBeginPlayUpdate(const bool bInCanBeginPlay);
@@ -45,6 +45,8 @@ public:
 	void IncrementAckedRPCID(Worker_EntityId EntityId, ERPCType Type);
 	uint64 GetAckFromView(Worker_EntityId EntityId, ERPCType Type);
 
+	SIZE_T GetAllocatedSize() const;
+
 private:
 	void SetEntityData(Worker_EntityId EntityId);
 	// Process relevant view delta changes.
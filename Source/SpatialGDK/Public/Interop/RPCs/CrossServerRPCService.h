@@ -26,7 +26,7 @@ struct CrossServerEndpoints
 {
 	// Locally authoritative state
 	CrossServer::RPCSchedule ReceiverSchedule;
-	CrossServer::WriterState SenderState;
+	CrossServer::SlotWriterState SenderState;
 	CrossServer::ReaderState ReceiverACKState;
 
 	// Observed state
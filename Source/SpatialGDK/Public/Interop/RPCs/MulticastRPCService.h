@@ -25,6 +25,8 @@ public:
 	void AdvanceView();
 	void ProcessChanges();
 
+	SIZE_T GetAllocatedSize() const;
+
 private:
 	// Process relevant view delta changes.
 	void EntityAdded(Worker_EntityId EntityId);
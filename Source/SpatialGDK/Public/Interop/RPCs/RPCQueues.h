@@ -57,6 +57,8 @@ struct TRPCUnboundedQueue : public TRPCQueue<Payload, AdditionalSendingData>
 		OverflowSizes.Remove(EntityId);
 	}
 
+	virtual SIZE_T GetAllocatedSize() const override { return Super::GetAllocatedSize() + OverflowSizes.GetAllocatedSize(); }
+
 protected:
 	void CheckOverflow(Worker_EntityId EntityId, QueueData& Queue)
 	{
@@ -40,6 +40,9 @@ public:
 
 	const TMap<FName, RPCReceiverDescription>& GetReceivers() { return Receivers; }
 
+	// Memory held by the registered senders, queues and receivers, including their queued and received payloads.
+	SIZE_T GetAllocatedSize() const;
+
 private:
 	void AdvanceSenderQueues();
 	void AdvanceReceivers();
@@ -75,6 +75,9 @@ struct FRPCStore
 	Schema_ComponentData* GetOrCreateComponentData(EntityComponentId EntityComponentIdPair);
 	void AddSpanIdForComponentUpdate(EntityComponentId EntityComponentIdPair, const FSpatialGDKSpanId& SpanId);
 
+	// Pending schema objects are counted by their serialized size.
+	SIZE_T GetAllocatedSize() const;
+
 	TMap<EntityRPCType, uint64> LastSentRPCIds;
 	TMap<EntityComponentId, PendingUpdate> PendingComponentUpdatesToSend;
 	TMap<EntityComponentId, Schema_ComponentData*> PendingRPCsOnEntityCreation;
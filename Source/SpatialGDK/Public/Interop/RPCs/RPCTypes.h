@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Interop/Connection/SpatialGDKSpanId.h"
+#include "SpatialConstants.h"
 #include "SpatialView/EntityView.h"
 #include "Utils/ObjectAllocUtils.h"
 
@@ -24,8 +25,57 @@ using ResponseWritten = TFunction<void(Worker_EntityId, Schema_CommandResponse*)
 using RPCWritten = TFunction<void(Worker_ComponentId, uint64)>;
 using QueueErrorCallback = TFunction<void(FName, Worker_EntityId, QueueError)>;
 using CanExtractRPCs = TFunction<bool(Worker_EntityId)>;
+using HasPendingUpdate = TFunction<bool(Worker_EntityId, Worker_ComponentId)>;
 } // namespace RPCCallbacks
 
+/**
+ * Parameters controlling how many ring buffer slots a sender uses for a given entity.
+ * The schema-declared slot count is the upper bound. When enabled, the capacity grows when RPCs overflow
+ * and shrinks back when the entity keeps using less than half of it.
+ */
+struct RPCAdaptiveCapacitySettings
+{
+	bool bEnabled = false;
+	uint32 MinCapacity = 1;
+	// Number of consecutive ACKs with low occupancy before the capacity is halved.
+	uint32 ShrinkAfterIdleACKs = 16;
+	// Fraction of the entity's current capacity in flight above which the sender reports ERPCFlowControl::Congested.
+	float CongestedRatio = 0.75f;
+};
+
+/**
+ * Controls when a receiver writes ACKs for the RPCs it consumed.
+ * An ACK is written on flush as soon as any of the conditions is met.
+ * The default policy ACKs consumed RPCs on the next flush.
+ */
+struct RPCACKPolicy
+{
+	// Write an ACK once this many RPCs have been consumed since the last one.
+	uint32 EveryNRPCs = 1;
+	// Write an ACK once the oldest unacknowledged RPC was consumed this long ago, in milliseconds. 0 disables the timer,
+	// which is only allowed when every RPC is ACKed; batching receivers fall back to DefaultBatchedMaxDelayMs.
+	uint32 MaxDelayMs = 0;
+	// Write an ACK once this fraction of the sender's ring buffer is waiting for one.
+	float SenderCapacityRatio = 0.5f;
+	// Write pending ACKs when an update is already being sent for the entity's ACK component.
+	bool bPiggyback = true;
+
+	static constexpr uint32 DefaultBatchedMaxDelayMs = 100;
+};
+
+/**
+ * Per-entity sender statistics, used to adapt the ring buffer capacity and report flow control.
+ */
+struct RPCSenderStats
+{
+	uint32 Capacity = 0;
+	uint32 InFlight = 0;
+	uint64 OverflowCount = 0;
+	// Exponential moving average of the time between writing an RPC and receiving its ACK, in seconds.
+	double AverageACKLatency = 0.0;
+	double MaxACKLatency = 0.0;
+};
+
 /**
  * Structure encapsulating a read operation
  */
@@ -118,6 +168,13 @@ protected:
 	bool bWriterOpened = false;
 };
 
+// Heap memory owned by a queued or received payload, overloaded next to payload types that own allocations.
+template <typename PayloadType>
+SIZE_T GetPayloadAllocatedSize(const PayloadType&)
+{
+	return 0;
+}
+
 /**
  * Class responsible for managing the sending side of a given RPC type
  * It will operate on the locally authoritative view of the actors.
@@ -132,6 +189,14 @@ public:
 	virtual void OnAuthGained_ReadComponent(const RPCReadingContext& iCtx) = 0;
 	virtual void OnAuthLost(Worker_EntityId EntityId) = 0;
 
+	virtual ERPCFlowControl GetFlowControl(Worker_EntityId EntityId) const { return ERPCFlowControl::Open; }
+	virtual TOptional<RPCSenderStats> GetStats(Worker_EntityId EntityId) const { return {}; }
+
+	virtual SIZE_T GetAllocatedSize() const
+	{
+		return ComponentsToReadOnAuthGained.GetAllocatedSize() + ComponentsToReadOnUpdate.GetAllocatedSize();
+	}
+
 	const TSet<Worker_ComponentId>& GetComponentsToReadOnUpdate() const { return ComponentsToReadOnUpdate; }
 
 protected:
@@ -152,7 +217,10 @@ public:
 	virtual void OnAdded_ReadComponent(const RPCReadingContext& Ctx) = 0;
 	virtual void OnRemoved(Worker_EntityId EntityId) = 0;
 	virtual void OnUpdate(const RPCReadingContext& iCtx) = 0;
-	virtual void FlushUpdates(RPCWritingContext& Ctx) = 0;
+	virtual void FlushUpdates(RPCWritingContext& Ctx,
+							  const RPCCallbacks::HasPendingUpdate& HasPendingUpdate = RPCCallbacks::HasPendingUpdate()) = 0;
+
+	virtual SIZE_T GetAllocatedSize() const { return ComponentsToRead.GetAllocatedSize(); }
 
 	const TSet<Worker_ComponentId>& GetComponentsToRead() const { return ComponentsToRead; }
 
@@ -209,6 +277,20 @@ public:
 		RPCs.Emplace(Wrapper.MakeWrappedData(EntityId, MoveTemp(Data), RPCId));
 	}
 
+	virtual SIZE_T GetAllocatedSize() const override
+	{
+		SIZE_T Size = RPCBufferReceiver::GetAllocatedSize() + ReceivedRPCs.GetAllocatedSize();
+		for (const auto& Pair : ReceivedRPCs)
+		{
+			Size += Pair.Value.GetAllocatedSize();
+			for (const auto& RPC : Pair.Value)
+			{
+				Size += GetPayloadAllocatedSize(RPC.GetData());
+			}
+		}
+		return Size;
+	}
+
 protected:
 	TMap<Worker_EntityId_Key, TArray<typename PayloadWrapper<PayloadType>::WrappedData>> ReceivedRPCs;
 	PayloadWrapper<PayloadType> Wrapper;
@@ -226,6 +308,8 @@ struct RPCQueue
 	virtual void OnAuthGained_ReadComponent(const RPCReadingContext& Ctx) = 0;
 	virtual void OnAuthLost(Worker_EntityId EntityId) = 0;
 
+	virtual SIZE_T GetAllocatedSize() const { return ComponentsToReadOnAuthGained.GetAllocatedSize(); }
+
 	const FName Name;
 
 	void SetErrorCallback(RPCCallbacks::QueueErrorCallback InCallback) { ErrorCallback = MoveTemp(InCallback); }
@@ -295,6 +379,26 @@ struct TRPCQueue : TWrappedRPCQueue<AdditionalSendingData>
 
 	void OnAuthGained_ReadComponent(const RPCReadingContext& iCtx) override {}
 
+	int32 GetNumQueued(Worker_EntityId EntityId) const
+	{
+		const QueueData* Queue = Queues.Find(EntityId);
+		return Queue != nullptr ? Queue->RPCs.Num() : 0;
+	}
+
+	virtual SIZE_T GetAllocatedSize() const override
+	{
+		SIZE_T Size = RPCQueue::GetAllocatedSize() + Queues.GetAllocatedSize();
+		for (const auto& Pair : Queues)
+		{
+			Size += Pair.Value.RPCs.GetAllocatedSize() + Pair.Value.AddData.GetAllocatedSize();
+			for (const PayloadType& RPC : Pair.Value.RPCs)
+			{
+				Size += GetPayloadAllocatedSize(RPC);
+			}
+		}
+		return Size;
+	}
+
 protected:
 	struct QueueData
 	{
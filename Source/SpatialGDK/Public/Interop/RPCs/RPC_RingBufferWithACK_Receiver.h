@@ -16,11 +16,18 @@ class MonotonicRingBufferWithACKReceiver : public TRPCBufferReceiver<PayloadType
 	using typename Super::ProcessRPC;
 
 public:
-	MonotonicRingBufferWithACKReceiver(SerializerType&& InSerializer, int32 InNumberOfSlots, PayloadWrapper<PayloadType>&& InWrapper)
+	MonotonicRingBufferWithACKReceiver(SerializerType&& InSerializer, int32 InNumberOfSlots, PayloadWrapper<PayloadType>&& InWrapper,
+									   const RPCACKPolicy& InACKPolicy = RPCACKPolicy())
 		: Super(MoveTemp(InWrapper))
 		, Serializer(MoveTemp(InSerializer))
 		, NumberOfSlots(InNumberOfSlots)
+		, ACKPolicy(InACKPolicy)
 	{
+		// Without a timer, a batching receiver could hold the last few RPCs of a burst unacknowledged forever.
+		if (ACKPolicy.EveryNRPCs > 1 && ACKPolicy.MaxDelayMs == 0)
+		{
+			ACKPolicy.MaxDelayMs = RPCACKPolicy::DefaultBatchedMaxDelayMs;
+		}
 		ComponentsToRead.Add(Serializer.GetComponentId());
 		ComponentsToRead.Add(Serializer.GetACKComponentId());
 	}
@@ -88,18 +95,21 @@ public:
 		}
 	}
 
-	virtual void FlushUpdates(RPCWritingContext& Ctx) override
+	virtual void FlushUpdates(RPCWritingContext& Ctx,
+							  const RPCCallbacks::HasPendingUpdate& HasPendingUpdate = RPCCallbacks::HasPendingUpdate()) override
 	{
+		const uint64 NowCycles = FPlatformTime::Cycles64();
 		for (auto& Receiver : ReceiverStates)
 		{
 			Worker_EntityId EntityId = Receiver.Key;
 			ReceiverState& State = Receiver.Value;
-			if (State.LastExecuted != State.LastWrittenACK)
+			if (State.LastExecuted != State.LastWrittenACK && ShouldWriteACK(EntityId, State, NowCycles, HasPendingUpdate))
 			{
 				auto EntityWriter = Ctx.WriteTo(EntityId, Serializer.GetACKComponentId());
 				Serializer.WriteACKCount(EntityWriter, State.LastExecuted);
 				State.LastWrittenACK = State.LastExecuted;
 			}
+			State.bReceivedSinceFlush = false;
 		}
 	}
 
@@ -146,10 +156,16 @@ public:
 				Payloads.SetNum(RemainingRPCs);
 			}
 
+			if (ProcessedRPCs > 0 && State.LastExecuted == State.LastWrittenACK)
+			{
+				State.FirstUnackedCycles = FPlatformTime::Cycles64();
+			}
 			State.LastExecuted += ProcessedRPCs;
 		}
 	}
 
+	virtual SIZE_T GetAllocatedSize() const override { return Super::GetAllocatedSize() + ReceiverStates.GetAllocatedSize(); }
+
 protected:
 	struct ReceiverState
 	{
@@ -158,8 +174,42 @@ protected:
 		uint64 LastExecuted;
 		uint64 r_LastWrittenACK;
 		uint64 r_LasAcktExecuted;
+		// Time at which the oldest RPC not covered by the last written ACK was consumed.
+		uint64 FirstUnackedCycles = 0;
+		// Whether new RPCs were read since the last FlushUpdates.
+		bool bReceivedSinceFlush = false;
 	};
 
+	bool ShouldWriteACK(Worker_EntityId EntityId, const ReceiverState& State, uint64 NowCycles,
+						const RPCCallbacks::HasPendingUpdate& HasPendingUpdate) const
+	{
+		if (State.LastExecuted - State.LastWrittenACK >= ACKPolicy.EveryNRPCs)
+		{
+			return true;
+		}
+
+		// Nothing new arrived since the last flush, so the sender may be waiting on us: an adaptive sender can have fewer RPCs in
+		// flight than the batch size or the capacity threshold below, and would otherwise never see an ACK.
+		if (!State.bReceivedSinceFlush)
+		{
+			return true;
+		}
+
+		// The sender cannot reuse slots until we ACK, so do not let it run out of capacity waiting on us.
+		if (State.LastRead - State.LastWrittenACK >= uint64(FMath::Max(1.0f, NumberOfSlots * ACKPolicy.SenderCapacityRatio)))
+		{
+			return true;
+		}
+
+		if (ACKPolicy.MaxDelayMs > 0
+			&& (NowCycles - State.FirstUnackedCycles) * FPlatformTime::GetSecondsPerCycle64() * 1000.0 >= ACKPolicy.MaxDelayMs)
+		{
+			return true;
+		}
+
+		return ACKPolicy.bPiggyback && HasPendingUpdate && HasPendingUpdate(EntityId, Serializer.GetACKComponentId());
+	}
+
 	void ReadRPCs(const RPCReadingContext& Ctx, ReceiverState& State)
 	{
 
@@ -177,6 +227,7 @@ protected:
 				this->QueueReceivedRPC(Ctx.EntityId, MoveTemp(NewPayload), RPCId);
 			}
 			State.LastRead = RPCCount;
+			State.bReceivedSinceFlush = true;
 		}
 	}
 
@@ -184,6 +235,7 @@ protected:
 
 	SerializerType Serializer;
 	int32 NumberOfSlots;
+	RPCACKPolicy ACKPolicy;
 };
 
 } // namespace SpatialGDK
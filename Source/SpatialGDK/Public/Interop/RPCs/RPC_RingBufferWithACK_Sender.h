@@ -16,9 +16,11 @@ class MonotonicRingBufferWithACKSender : public TRPCBufferSender<Payload>
 	using Super::ComponentsToReadOnUpdate;
 
 public:
-	MonotonicRingBufferWithACKSender(SerializerType&& InSerializer, int32 InNumberOfSlots)
+	MonotonicRingBufferWithACKSender(SerializerType&& InSerializer, int32 InNumberOfSlots,
+									 const RPCAdaptiveCapacitySettings& InAdaptiveCapacity = RPCAdaptiveCapacitySettings())
 		: Serializer(MoveTemp(InSerializer))
 		, NumberOfSlots(InNumberOfSlots)
+		, AdaptiveCapacity(InAdaptiveCapacity)
 	{
 		ComponentsToReadOnAuthGained.Add(Serializer.GetComponentId());
 		ComponentsToReadOnAuthGained.Add(Serializer.GetACKComponentId());
@@ -29,19 +31,12 @@ public:
 	{
 		if (Ctx.ComponentId == Serializer.GetACKComponentId())
 		{
-			//BufferStateData& State = BufferState.FindChecked(Ctx.EntityId);
 			BufferStateData& State = BufferState.FindOrAdd(Ctx.EntityId);
 			TOptional<uint64> NewACKCount = Serializer.ReadACKCount(Ctx);
 			if (NewACKCount)
 			{
-				uint64 LastACK_old = State.LastACK;
 				State.LastACK = NewACKCount.GetValue();
-
-				Worker_EntityId work_system_id = 0;
-				USpatialNetDriver* SpatialNetDriver = Cast<USpatialNetDriver>(GWorld->GetWorld()->GetNetDriver());
-				if(SpatialNetDriver)
-					work_system_id = SpatialNetDriver->Connection->GetWorkerSystemEntityId();
-				//UE_LOG(LogTemp,Warning,TEXT("%s,work_system_id=%lld,MonotonicRingBufferWithACKSender OnUpdate cid=%d,EntityId=%lld, ACKCount=%lld,LastACK_old=%lld"), GWorld->GetWorld()->IsServer()?TEXT("Server"):TEXT("Client"),work_system_id,Serializer.GetACKComponentId(),Ctx.EntityId, State.LastACK,LastACK_old);
+				OnACKReceived(State);
 			}
 		}
 	}
@@ -91,7 +86,14 @@ public:
 	{
 
 		BufferStateData& NextSlot = BufferState.FindOrAdd(EntityId);
-		int32 AvailableSlots = FMath::Max(0, int32(NumberOfSlots) - int32(NextSlot.CountWritten - NextSlot.LastACK));
+		const int32 InFlight = int32(NextSlot.CountWritten - NextSlot.LastACK);
+		const int32 AvailableSlots = FMath::Max(0, int32(GetCapacity(NextSlot)) - InFlight);
+		if (RPCs.Num() > AvailableSlots)
+		{
+			// The RPCs that don't fit stay queued, more slots are only available from the next write on.
+			++NextSlot.OverflowCount;
+			GrowCapacity(NextSlot);
+		}
 		/*if(AvailableSlots < 20)
 		{
 			Worker_EntityId work_system_id = 0;
@@ -120,22 +122,142 @@ public:
 				}*/
 			}
 			Serializer.WriteRPCCount(EntityWrite, NextSlot.CountWritten);
+
+			NextSlot.PeakInFlight = FMath::Max(NextSlot.PeakInFlight, uint32(NextSlot.CountWritten - NextSlot.LastACK));
+			if (NextSlot.LatencySampleRPCId == 0)
+			{
+				// Only one RPC is timed at a time, which is enough to follow the ACK latency trend.
+				NextSlot.LatencySampleRPCId = NextSlot.CountWritten;
+				NextSlot.LatencySampleStartCycles = FPlatformTime::Cycles64();
+			}
 		}
 
 
 		return RPCsToWrite;
 	}
 
+	virtual ERPCFlowControl GetFlowControl(Worker_EntityId EntityId) const override
+	{
+		const BufferStateData* State = BufferState.Find(EntityId);
+		if (State == nullptr)
+		{
+			return ERPCFlowControl::Open;
+		}
+
+		const uint64 InFlight = State->CountWritten - State->LastACK;
+		const uint32 Capacity = State->Capacity != 0 ? State->Capacity : GetInitialCapacity();
+		if (InFlight >= Capacity)
+		{
+			return ERPCFlowControl::Saturated;
+		}
+		if (InFlight >= uint64(Capacity * AdaptiveCapacity.CongestedRatio))
+		{
+			return ERPCFlowControl::Congested;
+		}
+		return ERPCFlowControl::Open;
+	}
+
+	virtual TOptional<RPCSenderStats> GetStats(Worker_EntityId EntityId) const override
+	{
+		const BufferStateData* State = BufferState.Find(EntityId);
+		if (State == nullptr)
+		{
+			return {};
+		}
+
+		RPCSenderStats Stats;
+		Stats.Capacity = State->Capacity != 0 ? State->Capacity : GetInitialCapacity();
+		Stats.InFlight = uint32(State->CountWritten - State->LastACK);
+		Stats.OverflowCount = State->OverflowCount;
+		Stats.AverageACKLatency = State->AverageACKLatency;
+		Stats.MaxACKLatency = State->MaxACKLatency;
+		return Stats;
+	}
+
+	virtual SIZE_T GetAllocatedSize() const override { return Super::GetAllocatedSize() + BufferState.GetAllocatedSize(); }
+
 private:
 	struct BufferStateData
 	{
 		uint64 CountWritten = 0;
 		uint64 LastACK = 0;
+
+		// Number of slots this entity is currently allowed to use, 0 until the first write.
+		uint32 Capacity = 0;
+		uint32 PeakInFlight = 0;
+		uint32 IdleACKs = 0;
+		uint64 OverflowCount = 0;
+
+		uint64 LatencySampleRPCId = 0;
+		uint64 LatencySampleStartCycles = 0;
+		double AverageACKLatency = 0.0;
+		double MaxACKLatency = 0.0;
 	};
+
+	uint32 GetInitialCapacity() const
+	{
+		if (!AdaptiveCapacity.bEnabled)
+		{
+			return NumberOfSlots;
+		}
+		return FMath::Clamp<uint32>(AdaptiveCapacity.MinCapacity, 1, NumberOfSlots);
+	}
+
+	uint32 GetCapacity(BufferStateData& State) const
+	{
+		if (State.Capacity == 0)
+		{
+			State.Capacity = GetInitialCapacity();
+		}
+		return State.Capacity;
+	}
+
+	void GrowCapacity(BufferStateData& State) const
+	{
+		if (AdaptiveCapacity.bEnabled)
+		{
+			State.Capacity = FMath::Min<uint32>(NumberOfSlots, State.Capacity * 2);
+			State.IdleACKs = 0;
+		}
+	}
+
+	void OnACKReceived(BufferStateData& State) const
+	{
+		if (State.LatencySampleRPCId != 0 && State.LastACK >= State.LatencySampleRPCId)
+		{
+			const double Latency = (FPlatformTime::Cycles64() - State.LatencySampleStartCycles) * FPlatformTime::GetSecondsPerCycle64();
+			State.AverageACKLatency =
+				State.AverageACKLatency == 0.0 ? Latency : State.AverageACKLatency + (Latency - State.AverageACKLatency) * 0.125;
+			State.MaxACKLatency = FMath::Max(State.MaxACKLatency, Latency);
+			State.LatencySampleRPCId = 0;
+		}
+
+		if (!AdaptiveCapacity.bEnabled || State.Capacity == 0)
+		{
+			return;
+		}
+
+		const uint32 MinCapacity = GetInitialCapacity();
+		if (State.PeakInFlight * 2 <= State.Capacity && State.Capacity > MinCapacity)
+		{
+			if (++State.IdleACKs >= AdaptiveCapacity.ShrinkAfterIdleACKs)
+			{
+				State.Capacity = FMath::Max(MinCapacity, State.Capacity / 2);
+				State.IdleACKs = 0;
+			}
+		}
+		else
+		{
+			State.IdleACKs = 0;
+		}
+		State.PeakInFlight = uint32(State.CountWritten - State.LastACK);
+	}
+
 	TMap<Worker_EntityId_Key, BufferStateData> BufferState;
 
 	SerializerType Serializer;
 	int32 NumberOfSlots;
+	RPCAdaptiveCapacitySettings AdaptiveCapacity;
 
 };
 
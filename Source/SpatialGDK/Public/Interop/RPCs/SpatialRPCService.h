@@ -39,6 +39,7 @@ public:
 	void PushUpdates();
 
 	void ProcessIncomingRPCs();
+	void OnObjectRefResolved(const FUnrealObjectRef& ObjectRef);
 	void ProcessOutgoingRPCs();
 
 	void ProcessOrQueueIncomingRPC(const FUnrealObjectRef& InTargetObjectRef, const RPCSender& InSender, RPCPayload InPayload,
@@ -64,6 +65,9 @@ public:
 										  ERPCType Type, void* Params) const;
 	void ProcessOrQueueOutgoingRPC(const FUnrealObjectRef& InTargetObjectRef, const RPCSender& InSenderInfo, RPCPayload&& InPayload);
 
+	// Ring buffer state, queued RPCs and pending updates held by the service.
+	SIZE_T GetAllocatedSize() const;
+
 private:
 	EPushRPCResult PushRPCInternal(Worker_EntityId EntityId, ERPCType Type, PendingRPCPayload Payload, bool bCreatedEntity);
 
@@ -77,7 +81,7 @@ private:
 	bool SendRingBufferedRPC(UObject* TargetObject, const RPCSender& Sender, UFunction* Function, const RPCPayload& Payload,
 							 USpatialActorChannel* Channel, const FUnrealObjectRef& TargetObjectRef, const FSpatialGDKSpanId& SpanId);
 	void TrackRPC(AActor* Actor, UFunction* Function, const RPCPayload& Payload, ERPCType RPCType) const;
-	FSpatialNetBitWriter PackRPCDataToSpatialNetBitWriter(UFunction* Function, void* Parameters) const;
+	FSpatialNetBitWriterPool::FScopedWriter PackRPCDataToSpatialNetBitWriter(UFunction* Function, void* Parameters) const;
 
 	bool ActorCanExtractRPC(Worker_EntityId) const;
 
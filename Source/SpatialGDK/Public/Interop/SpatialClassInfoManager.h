@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 
 #include "Utils/GDKPropertyMacros.h"
+#include "Utils/InternedObjectPaths.h"
 #include "Utils/SchemaDatabase.h"
 
 #include <WorkerSDK/improbable/c_worker.h>
@@ -45,6 +46,14 @@ struct FRPCInfo
 	uint32 Index;
 };
 
+namespace SpatialGDK
+{
+class FRepFieldDispatchTable;
+struct FGeneratedClassCodec;
+} // namespace SpatialGDK
+
+class FRepLayout;
+
 struct FInterestPropertyInfo
 {
 	GDK_PROPERTY(Property) * Property;
@@ -62,6 +71,7 @@ struct FClassInfo
 	TArray<UFunction*> RPCs;
 	TMap<UFunction*, FRPCInfo> RPCInfoMap;
 	TArray<FInterestPropertyInfo> InterestProperties;
+	TSharedPtr<const SpatialGDK::FRepFieldDispatchTable> FieldDispatchTable;
 
 	// For Actors and default Subobjects belonging to Actors
 	Worker_ComponentId SchemaComponents[ESchemaComponentType::SCHEMA_Count] = {};
@@ -101,6 +111,9 @@ public:
 
 	const FClassInfo& GetOrCreateClassInfoByClass(UClass* Class);
 	const FClassInfo& GetOrCreateClassInfoByObject(UObject* Object);
+
+	// The class's field dispatch table, rebuilt from RepLayout and kept in the class info if it was built from another layout.
+	const SpatialGDK::FRepFieldDispatchTable& GetFieldDispatchTable(UClass* Class, const FRepLayout& RepLayout);
 	const FClassInfo& GetClassInfoByComponentId(Worker_ComponentId ComponentId);
 
 	UClass* GetClassByComponentId(Worker_ComponentId ComponentId);
@@ -130,6 +143,15 @@ public:
 	const FClassInfo* GetClassInfoForNewSubobject(const UObject* Object, Worker_EntityId EntityId,
 												  USpatialPackageMapClient* PackageMapClient);
 
+	// Object reference paths from the schema database, used when replicating properties.
+	const SpatialGDK::FInternedObjectPaths& GetInternedObjectPaths() const { return InternedObjectPaths; }
+
+	// The schema bundle hash combined with the interned object paths' hash. Published on the deployment map for workers to check.
+	uint32 GetSchemaHash() const;
+
+	// Interned path IDs are only sent while the deployment's schema hash matches this worker's, full paths are sent otherwise.
+	void OnDeploymentSchemaHashChanged(uint32 DeploymentSchemaHash);
+
 	UPROPERTY()
 	USchemaDatabase* SchemaDatabase;
 
@@ -144,6 +166,15 @@ private:
 
 	bool IsComponentIdForTypeValid(const Worker_ComponentId ComponentId, const ESchemaComponentType Type) const;
 
+	// Returns the codec generated for the class, if it was generated along with the schema in use.
+	const SpatialGDK::FGeneratedClassCodec* FindGeneratedCodec(const FString& ClassPath) const;
+
+	// Returns the handles of the class's arrays that are replicated as element deltas.
+	TArrayView<const uint32> GetDeltaArrayHandles(const FString& ClassPath) const;
+
+	// Returns the quantization of the class's properties set with the SpatialQuantization metadata.
+	TArrayView<const FQuantizedPropertySchemaData> GetQuantizedProperties(const FString& ClassPath) const;
+
 private:
 	UPROPERTY()
 	USpatialNetDriver* NetDriver;
@@ -156,4 +187,6 @@ private:
 	TMap<Worker_ComponentId, ESchemaComponentType> ComponentToCategoryMap;
 
 	TOptional<bool> bHandoverActive;
+
+	SpatialGDK::FInternedObjectPaths InternedObjectPaths;
 };
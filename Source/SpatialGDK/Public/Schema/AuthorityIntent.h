@@ -38,6 +38,7 @@ struct AuthorityIntent : AbstractMutableComponent
 		Schema_Object* ComponentObject = Schema_GetComponentDataFields(Data);
 
 		VirtualWorkerId = Schema_GetUint32(ComponentObject, SpatialConstants::AUTHORITY_INTENT_VIRTUAL_WORKER_ID);
+		ChangeTimeTicks = Schema_GetInt64(ComponentObject, SpatialConstants::AUTHORITY_INTENT_CHANGE_TIME_ID);
 	}
 
 	Worker_ComponentData CreateComponentData() const override
@@ -48,6 +49,7 @@ struct AuthorityIntent : AbstractMutableComponent
 		Schema_Object* ComponentObject = Schema_GetComponentDataFields(Data.schema_type);
 
 		Schema_AddUint32(ComponentObject, SpatialConstants::AUTHORITY_INTENT_VIRTUAL_WORKER_ID, VirtualWorkerId);
+		Schema_AddInt64(ComponentObject, SpatialConstants::AUTHORITY_INTENT_CHANGE_TIME_ID, ChangeTimeTicks);
 
 		return Data;
 	}
@@ -60,6 +62,7 @@ struct AuthorityIntent : AbstractMutableComponent
 		Schema_Object* ComponentObject = Schema_GetComponentUpdateFields(Update.schema_type);
 
 		Schema_AddUint32(ComponentObject, SpatialConstants::AUTHORITY_INTENT_VIRTUAL_WORKER_ID, VirtualWorkerId);
+		Schema_AddInt64(ComponentObject, SpatialConstants::AUTHORITY_INTENT_CHANGE_TIME_ID, ChangeTimeTicks);
 
 		return Update;
 	}
@@ -70,11 +73,19 @@ struct AuthorityIntent : AbstractMutableComponent
 	{
 		Schema_Object* ComponentObject = Schema_GetComponentUpdateFields(Update);
 		VirtualWorkerId = Schema_GetUint32(ComponentObject, SpatialConstants::AUTHORITY_INTENT_VIRTUAL_WORKER_ID);
+		if (Schema_GetInt64Count(ComponentObject, SpatialConstants::AUTHORITY_INTENT_CHANGE_TIME_ID) > 0)
+		{
+			ChangeTimeTicks = Schema_GetInt64(ComponentObject, SpatialConstants::AUTHORITY_INTENT_CHANGE_TIME_ID);
+		}
 	}
 
 	// Id of the Unreal server worker which should be authoritative for the entity.
 	// 0 is reserved as an invalid/unset value.
 	VirtualWorkerId VirtualWorkerId;
+
+	// UTC ticks at which VirtualWorkerId was last changed, or 0 if it hasn't changed since the entity was created.
+	// Times are UTC, so handover latencies measured across machines include their clock offset.
+	int64 ChangeTimeTicks = 0;
 };
 
 } // namespace SpatialGDK
@@ -29,6 +29,15 @@ enum class ERPCType : uint8
 	RingBufferTypeEnd = CrossServer
 };
 
+// Flow-control signal for ring buffered RPCs, based on how much of the ring buffer is in flight for an entity.
+UENUM(BlueprintType)
+enum class ERPCFlowControl : uint8
+{
+	Open,	   // Slots are available, RPCs are written right away.
+	Congested, // Most of the ring buffer is waiting for ACKs, gameplay should consider throttling.
+	Saturated  // Every slot the entity can currently use is in flight, new RPCs are queued locally or dropped.
+};
+
 enum ESchemaComponentType : int32
 {
 	SCHEMA_Invalid = -1,
@@ -170,6 +179,18 @@ const Schema_FieldId STARTUP_ACTOR_MANAGER_CAN_BEGIN_PLAY_ID = 2;
 const Schema_FieldId ACTOR_COMPONENT_REPLICATES_ID = 1;
 const Schema_FieldId ACTOR_TEAROFF_ID = 4;
 
+// Added to sampled updates of generated components, and cleared from component data. The largest valid field ID, so it is never
+// assigned to a property.
+const Schema_FieldId REPLICATION_LATENCY_STAMP_ID = (1 << 29) - 1;
+const Schema_FieldId REPLICATION_LATENCY_STAMP_SEND_TIME_ID = 1;
+const Schema_FieldId REPLICATION_LATENCY_STAMP_FRAME_NUMBER_ID = 2;
+
+// Added to updates of generated components, one object for each array sent as element deltas.
+const Schema_FieldId ARRAY_DELTA_ID = (1 << 29) - 2;
+const Schema_FieldId ARRAY_DELTA_FIELD_ID = 1;
+const Schema_FieldId ARRAY_DELTA_LENGTH_ID = 2;
+const Schema_FieldId ARRAY_DELTA_INDICES_ID = 3;
+
 const Schema_FieldId SHUTDOWN_MULTI_PROCESS_REQUEST_ID = 1;
 const Schema_FieldId SHUTDOWN_ADDITIONAL_SERVERS_EVENT_ID = 1;
 
@@ -195,6 +216,7 @@ const Schema_FieldId UNREAL_OBJECT_REF_PATH_ID = 3;
 const Schema_FieldId UNREAL_OBJECT_REF_NO_LOAD_ON_CLIENT_ID = 4;
 const Schema_FieldId UNREAL_OBJECT_REF_OUTER_ID = 5;
 const Schema_FieldId UNREAL_OBJECT_REF_USE_CLASS_PATH_TO_LOAD_ID = 6;
+const Schema_FieldId UNREAL_OBJECT_REF_INTERNED_PATH_ID = 7;
 
 // UnrealRPCPayload Field IDs
 const Schema_FieldId UNREAL_RPC_PAYLOAD_OFFSET_ID = 1;
@@ -215,6 +237,7 @@ const Schema_FieldId PLAYER_SPAWNER_SPAWN_PLAYER_COMMAND_ID = 1;
 
 // AuthorityIntent codes and Field IDs.
 const Schema_FieldId AUTHORITY_INTENT_VIRTUAL_WORKER_ID = 2;
+const Schema_FieldId AUTHORITY_INTENT_CHANGE_TIME_ID = 3;
 
 // VirtualWorkerTranslation Field IDs.
 const Schema_FieldId VIRTUAL_WORKER_TRANSLATION_MAPPING_ID = 2;
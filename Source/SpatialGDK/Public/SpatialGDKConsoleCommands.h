@@ -10,5 +10,9 @@ class UWorld;
 namespace SpatialGDKConsoleCommands
 {
 void ConsoleCommand_ConnectToLocator(const TArray<FString>& Args, UWorld* World);
+void ConsoleCommand_SetEventTracingRateLimit(const TArray<FString>& Args, UWorld* World);
+void ConsoleCommand_ClearEventTracingRateLimit(const TArray<FString>& Args, UWorld* World);
+void ConsoleCommand_DumpEventTracingSampling(const TArray<FString>& Args, UWorld* World);
+void ConsoleCommand_DumpMemory(const TArray<FString>& Args, UWorld* World);
 }
 // namespace
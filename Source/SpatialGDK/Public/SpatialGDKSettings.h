@@ -65,6 +65,20 @@ struct FDistanceFrequencyPair
 	float Frequency = 0.0f;    // SKYCELL add
 };
 
+USTRUCT(BlueprintType)
+struct FEventTracingRateLimit
+{
+	GENERATED_BODY()
+
+	/* Average number of trace chains an event type may start per second. 0 means unlimited. */
+	UPROPERTY(EditAnywhere, Category = "Event Tracing", meta = (ClampMin = 0.0f))
+	float EventsPerSecond = 0.0f;
+
+	/* Number of trace chains an event type may start in a burst. 0 means one second's worth of events. */
+	UPROPERTY(EditAnywhere, Category = "Event Tracing", meta = (ClampMin = 0.0f))
+	float BurstSize = 0.0f;
+};
+
 UCLASS(Blueprintable)
 class SPATIALGDK_API UEventTracingSamplingSettings : public UObject
 {
@@ -91,6 +105,14 @@ public:
 	UPROPERTY(EditAnywhere, Category = "Event Tracing")
 	TMap<FName, double> EventSamplingModeOverrides;
 
+	/* Rate limit applied to each event type that starts a new trace chain. Events caused by a sampled event are not limited. */
+	UPROPERTY(EditAnywhere, Category = "Event Tracing")
+	FEventTracingRateLimit DefaultRateLimit;
+
+	/* Per event type rate limits, which replace the default rate limit. */
+	UPROPERTY(EditAnywhere, Category = "Event Tracing")
+	TMap<FName, FEventTracingRateLimit> EventRateLimitOverrides;
+
 	UPROPERTY(EditAnywhere, Category = "Event Tracing")
 	FString GDKEventPreFilter;
 
@@ -283,6 +305,14 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Metrics")
 	bool bUseFrameTimeAsLoad;
 
+	/**
+	 * Fraction of replicated component updates stamped with the sending worker's timestamp and frame number.
+	 * Receiving workers record the time from send to apply per component class, and report it with the metrics.
+	 * 0 disables stamping.
+	 */
+	UPROPERTY(EditAnywhere, config, Category = "Metrics", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float ReplicationLatencySampleRate;
+
 	/** Batch entity position updates to be processed on a single frame.*/
 	UPROPERTY(config)
 	bool bBatchSpatialPositionUpdates;
@@ -359,6 +389,35 @@ public:
 
 	uint32 GetRPCRingBufferSize(ERPCType RPCType) const;
 
+	/**
+	 * Let RPC senders adapt the number of ring buffer slots used per entity, between the minimum below and the ring buffer size.
+	 * Capacity grows when RPCs overflow and shrinks back when an entity stays mostly idle.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "Replication", meta = (DisplayName = "Adaptive RPC Ring Buffer Capacity"))
+	bool bEnableAdaptiveRPCRingBufferCapacity;
+
+	/** Number of ring buffer slots an entity starts with, and shrinks back to, when adaptive capacity is enabled. */
+	UPROPERTY(EditAnywhere, Config, Category = "Replication",
+			  meta = (DisplayName = "Minimum Adaptive RPC Ring Buffer Size", EditCondition = "bEnableAdaptiveRPCRingBufferCapacity",
+					  ClampMin = 1))
+	uint32 MinAdaptiveRPCRingBufferSize;
+
+	/** Number of consumed RPCs after which a receiver writes an ACK. 1 ACKs every frame in which RPCs were consumed. */
+	UPROPERTY(EditAnywhere, Config, Category = "Replication", AdvancedDisplay, meta = (DisplayName = "RPC ACK Batch Size", ClampMin = 1))
+	uint32 RPCACKBatchSize;
+
+	/**
+	 * Maximum time, in milliseconds, a receiver holds back an ACK for consumed RPCs. 0 disables the timer, which is only valid
+	 * with an ACK batch size of 1; batched ACKs always use a timer and fall back to 100 ms when this is 0.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "Replication", AdvancedDisplay, meta = (DisplayName = "RPC ACK Max Delay (ms)"))
+	uint32 RPCACKMaxDelayMs;
+
+	/** Fraction of the ring buffer waiting for an ACK at which a receiver writes one regardless of the batch size and delay. */
+	UPROPERTY(EditAnywhere, Config, Category = "Replication", AdvancedDisplay,
+			  meta = (DisplayName = "RPC ACK Sender Capacity Ratio", ClampMin = 0.0f, ClampMax = 1.0f))
+	float RPCACKSenderCapacityRatio;
+
 	float GetSecondsBeforeWarning(const ERPCResult Result) const;
 
 	bool ShouldRPCTypeAllowUnresolvedParameters(const ERPCType Type) const;
@@ -522,6 +581,14 @@ public:
 	UPROPERTY(Config)
 	int32 EventTracingRotatingLogsMaxFileCount;
 
+	/*
+	 * -- EXPERIMENTAL --
+	 * Size of the buffer trace items are queued in before a background thread writes them to disk.
+	 * Trace items are dropped, and counted, if the buffer is full.
+	 */
+	UPROPERTY(Config)
+	uint32 EventTracingWriteBufferSizeBytes;
+
 	UPROPERTY(Config)
 	bool bEnableAlwaysWriteRPCs;
 
@@ -17,6 +17,8 @@ struct OpList
 	Worker_Op* Ops;
 	uint32 Count;
 	TUniquePtr<OpListData> Storage;
+	// Cycle count at which the op list was taken from the connection, 0 if it was never stamped.
+	uint64 ReceivedCycles = 0;
 };
 
 } // namespace SpatialGDK
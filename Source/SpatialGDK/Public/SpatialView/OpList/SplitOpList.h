@@ -23,9 +23,9 @@ struct SplitOpListPair
 		check(InitialOpListCount <= OriginalOpList.Count);
 		// Transfer ownership to a shared pointer.
 		TSharedPtr<OpListData> SplitData(OriginalOpList.Storage.Release());
-		Head = { OriginalOpList.Ops, InitialOpListCount, MakeUnique<SplitOpListData>(SplitData) };
+		Head = { OriginalOpList.Ops, InitialOpListCount, MakeUnique<SplitOpListData>(SplitData), OriginalOpList.ReceivedCycles };
 		Tail = { OriginalOpList.Ops + InitialOpListCount, OriginalOpList.Count - InitialOpListCount,
-				 MakeUnique<SplitOpListData>(MoveTemp(SplitData)) };
+				 MakeUnique<SplitOpListData>(MoveTemp(SplitData)), OriginalOpList.ReceivedCycles };
 	}
 
 	OpList Head;
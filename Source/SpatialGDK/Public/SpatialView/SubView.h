@@ -62,6 +62,8 @@ public:
 	static FDispatcherRefreshCallback CreateAuthorityChangeRefreshCallback(IDispatcher& Dispatcher, const Worker_ComponentId ComponentId,
 																		   const FAuthorityChangeRefreshPredicate& RefreshPredicate);
 
+	SIZE_T GetAllocatedSize() const;
+
 private:
 	void RegisterTagCallbacks(IDispatcher& Dispatcher);
 	void RegisterRefreshCallbacks(IDispatcher& Dispatcher, const TArray<FDispatcherRefreshCallback>& DispatcherRefreshCallbacks);
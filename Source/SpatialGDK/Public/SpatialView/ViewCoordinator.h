@@ -11,6 +11,7 @@
 #include "SpatialView/SpatialOSWorker.h"
 #include "SpatialView/SubView.h"
 #include "SpatialView/WorkerView.h"
+#include "Utils/LatencyHistogram.h"
 
 #include "Templates/UniquePtr.h"
 
@@ -18,6 +19,17 @@ namespace SpatialGDK
 {
 class SpatialEventTracer;
 
+// Time spent in each stage of the last call to ViewCoordinator::Advance.
+struct FViewAdvanceTimings
+{
+	uint64 OpRetrievalCycles = 0;
+	uint64 ViewDeltaCycles = 0;
+	uint64 DispatcherCycles = 0;
+	uint64 SubViewCycles = 0;
+	uint32 NumOps = 0;
+	uint32 NumEntityDeltas = 0;
+};
+
 class ViewCoordinator : public ISpatialOSWorker
 {
 public:
@@ -35,6 +47,14 @@ public:
 	void Advance(float DeltaTimeS);
 	const ViewDelta& GetViewDelta() const;
 	void FlushMessagesToSend();
+	// Call once the systems reading the view delta have processed it, to record the time taken to apply the op lists in it.
+	void RecordOpListsApplied();
+	// Returns the time taken from receiving op lists to applying them since the last call, and resets it.
+	FLatencyHistogram ConsumeOpListApplyLatency();
+	const FViewAdvanceTimings& GetLastAdvanceTimings() const { return LastAdvanceTimings; }
+
+	int32 GetNumSubViews() const { return SubViews.Num(); }
+	SIZE_T GetSubViewsAllocatedSize() const;
 
 	// Create a subview with the specified tag, filter, and refresh callbacks.
 	FSubView& CreateSubView(Worker_ComponentId Tag, const FFilterPredicate& Filter,
@@ -120,6 +140,11 @@ private:
 	TCommandRetryHandler<FDeleteEntityRetryHandlerImpl> DeleteEntityRetryHandler;
 	TCommandRetryHandler<FEntityQueryRetryHandlerImpl> EntityQueryRetryHandler;
 	TCommandRetryHandler<FEntityCommandRetryHandlerImpl> EntityCommandRetryHandler;
+
+	// Receive times of the op lists in the view delta, until RecordOpListsApplied.
+	TArray<uint64, TInlineAllocator<4>> UnappliedOpListReceivedCycles;
+	FLatencyHistogram OpListApplyLatency;
+	FViewAdvanceTimings LastAdvanceTimings;
 };
 
 template <class T>
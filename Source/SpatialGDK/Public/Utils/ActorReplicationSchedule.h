@@ -0,0 +1,54 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class AActor;
+
+namespace SpatialGDK
+{
+// Tracks the time each actor in the net driver's active network object list is next due to be considered for replication.
+// Building the consider list pops the actors that are due instead of walking the whole list, so quiet actors aren't visited until
+// their update timer runs out or they are woken early.
+// Rescheduling leaves the actor's previous heap entry in place, it is skipped when popped as it no longer matches the scheduled time.
+class SPATIALGDK_API FActorReplicationSchedule
+{
+public:
+	// Starts tracking Actor if needed, and makes it due at Time in place of any time it was scheduled at before.
+	void Schedule(AActor* Actor, float Time);
+
+	// Makes Actor due on the next PopDue, whatever time it is for. Used when something happens that the actor should replicate for.
+	void Wake(AActor* Actor);
+
+	void Remove(AActor* Actor);
+
+	bool IsTracked(AActor* Actor) const { return ScheduledTimes.Contains(Actor); }
+	int32 Num() const { return ScheduledTimes.Num(); }
+
+	// Adds the actors due at or before Now to OutDueActors, in the order they became due.
+	// They stop being tracked, so the caller should schedule again every actor it keeps considering.
+	void PopDue(float Now, TArray<AActor*>& OutDueActors);
+
+	void Empty();
+
+private:
+	struct FEntry
+	{
+		float Time;
+		TWeakObjectPtr<AActor> Actor;
+	};
+
+	struct FEntryCompare
+	{
+		bool operator()(const FEntry& A, const FEntry& B) const { return A.Time < B.Time; }
+	};
+
+	void Push(const TWeakObjectPtr<AActor>& Actor, float Time);
+	void CompactIfNeeded();
+
+	TArray<FEntry> Heap;
+	TMap<TWeakObjectPtr<AActor>, float> ScheduledTimes;
+};
+} // namespace SpatialGDK
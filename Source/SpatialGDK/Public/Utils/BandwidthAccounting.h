@@ -0,0 +1,110 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <WorkerSDK/improbable/c_worker.h>
+
+namespace SpatialGDK
+{
+enum class EBandwidthDirection : uint8
+{
+	Sent,
+	Received,
+
+	Count
+};
+
+enum class EBandwidthCategory : uint8
+{
+	Component,
+	ActorClass,
+	RPC,
+
+	Count
+};
+
+// Serialized bytes attributed to component IDs, actor classes and RPCs, over a rolling window of fixed length intervals.
+// Each record is a map lookup and two additions. Totals over the window are only summed and sorted when a report is requested.
+class SPATIALGDK_API FBandwidthAccounting
+{
+public:
+	static constexpr int32 DefaultNumIntervals = 10;
+	static constexpr double DefaultIntervalSeconds = 1.0;
+
+	struct FEntry
+	{
+		EBandwidthCategory Category;
+		// Set for actor classes and RPCs.
+		FName Name;
+		// Set for RPCs, the class that declares the function.
+		FName OuterName;
+		// Set for components.
+		Worker_ComponentId ComponentId;
+		uint64 Bytes[static_cast<uint8>(EBandwidthDirection::Count)];
+		uint64 Messages[static_cast<uint8>(EBandwidthDirection::Count)];
+
+		FString GetDisplayName() const;
+	};
+
+	explicit FBandwidthAccounting(int32 InNumIntervals = DefaultNumIntervals, double InIntervalSeconds = DefaultIntervalSeconds);
+
+	void RecordComponent(EBandwidthDirection Direction, Worker_ComponentId ComponentId, uint32 Bytes, double NowSeconds);
+	void RecordActorClass(EBandwidthDirection Direction, FName ClassName, uint32 Bytes, double NowSeconds);
+	// RPCs are told apart by their class as well as their name, as functions of different classes can share a name.
+	void RecordRPC(EBandwidthDirection Direction, FName ClassName, FName FunctionName, uint32 Bytes, double NowSeconds);
+
+	// The entries of a category with the most bytes in the given direction over the window, highest first.
+	TArray<FEntry> GetTopEntries(EBandwidthCategory Category, EBandwidthDirection Direction, int32 MaxEntries, double NowSeconds) const;
+
+	// Time covered by the window so far, used to turn totals into rates.
+	double GetWindowSeconds(double NowSeconds) const;
+
+	void Reset();
+
+	void DumpTopEntries(FOutputDevice& Ar, int32 MaxEntries, double NowSeconds) const;
+
+	static const TCHAR* GetCategoryName(EBandwidthCategory Category);
+
+private:
+	struct FKey
+	{
+		EBandwidthCategory Category;
+		FName Name;
+		FName OuterName;
+		Worker_ComponentId ComponentId;
+
+		bool operator==(const FKey& Other) const
+		{
+			return Category == Other.Category && ComponentId == Other.ComponentId && Name == Other.Name && OuterName == Other.OuterName;
+		}
+
+		friend uint32 GetTypeHash(const FKey& Key)
+		{
+			return HashCombine(HashCombine(HashCombine(::GetTypeHash(static_cast<uint8>(Key.Category)), ::GetTypeHash(Key.ComponentId)),
+										   ::GetTypeHash(Key.Name)),
+							   ::GetTypeHash(Key.OuterName));
+		}
+	};
+
+	struct FCounts
+	{
+		uint64 Bytes[static_cast<uint8>(EBandwidthDirection::Count)] = {};
+		uint64 Messages[static_cast<uint8>(EBandwidthDirection::Count)] = {};
+	};
+
+	struct FInterval
+	{
+		double StartSeconds = 0.0;
+		TMap<FKey, FCounts> Counts;
+	};
+
+	void Record(const FKey& Key, EBandwidthDirection Direction, uint32 Bytes, double NowSeconds);
+	bool IsInWindow(const FInterval& Interval, double NowSeconds) const;
+
+	TArray<FInterval> Intervals;
+	double IntervalSeconds;
+	int32 CurrentInterval = INDEX_NONE;
+};
+} // namespace SpatialGDK
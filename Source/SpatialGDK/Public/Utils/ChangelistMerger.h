@@ -0,0 +1,32 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace SpatialGDK
+{
+// Merges the RepLayout changelists of several history items into the one that is sent.
+// Changelists that only hold top-level handles are merged in a bitset with one bit per handle, and only turned back into a sorted,
+// zero terminated handle list at the end. The bitset and the scratch changelist keep their allocations between merges, so once
+// they have grown to the largest layout replicated through them, merging doesn't allocate.
+class SPATIALGDK_API FChangelistMerger
+{
+public:
+	// Merges Changelists and the handles already in OutMerged into OutMerged, and returns true.
+	// If any of them changes a handle above NumHandles or a dynamic array, whose per-element changes have to be clamped to the current
+	// array sizes, nothing is merged and false is returned, so the caller can fall back to FRepLayout::MergeChangeList.
+	bool TryMergeFlat(int32 NumHandles, TArrayView<const TArray<uint16>* const> Changelists,
+					  TFunctionRef<bool(uint16 Handle)> IsDynamicArrayHandle, TArray<uint16>& OutMerged);
+
+	// FRepLayout::MergeChangeList can't merge in place, this holds the previous merge result between calls.
+	TArray<uint16>& GetScratchChangelist() { return ScratchChangelist; }
+
+private:
+	static bool IsFlat(int32 NumHandles, const TArray<uint16>& Changelist, TFunctionRef<bool(uint16 Handle)> IsDynamicArrayHandle);
+	void AddToBitset(const TArray<uint16>& Changelist);
+
+	TArray<uint32> ChangedHandles;
+	TArray<uint16> ScratchChangelist;
+};
+} // namespace SpatialGDK
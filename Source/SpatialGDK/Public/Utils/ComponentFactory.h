@@ -12,6 +12,7 @@
 
 DECLARE_LOG_CATEGORY_EXTERN(LogComponentFactory, Log, All);
 
+class USpatialActorChannel;
 class USpatialNetDriver;
 class USpatialPackageMap;
 class USpatialClassInfoManager;
@@ -24,6 +25,9 @@ enum EReplicatedPropertyGroup : uint32;
 
 namespace SpatialGDK
 {
+class FRepFieldDispatchTable;
+struct FRepFieldDispatchEntry;
+
 class SPATIALGDK_API ComponentFactory
 {
 public:
@@ -38,6 +42,14 @@ public:
 
 	static FWorkerComponentData CreateEmptyComponentData(Worker_ComponentId ComponentId);
 
+#if WITH_DEV_AUTOMATION_TESTS
+	void AddArrayDeltaForTesting(Schema_Object* Object, Schema_FieldId FieldId, const FRepFieldDispatchEntry& Entry,
+								 GDK_PROPERTY(ArrayProperty) * Property, const uint8* Data, TArrayView<const uint16> ElementChangelist)
+	{
+		AddArrayDelta(Object, FieldId, Entry, Property, Data, ElementChangelist, nullptr);
+	}
+#endif
+
 private:
 	FWorkerComponentData CreateComponentData(Worker_ComponentId ComponentId, UObject* Object, const FRepChangeState& Changes,
 											 ESchemaComponentType PropertyGroup, uint32& OutBytesWritten);
@@ -47,13 +59,27 @@ private:
 	uint32 FillSchemaObject(Schema_Object* ComponentObject, UObject* Object, const FRepChangeState& Changes,
 							ESchemaComponentType PropertyGroup, bool bIsInitialData, TArray<Schema_FieldId>* ClearedIds = nullptr);
 
+	const FRepFieldDispatchTable& GetDispatchTable(UObject* Object, const FRepLayout& RepLayout);
+
 	void AddProperty(Schema_Object* Object, Schema_FieldId FieldId, GDK_PROPERTY(Property) * Property, const uint8* Data,
 					 TArray<Schema_FieldId>* ClearedIds,bool is_repeated = false,int index = -1);
 
+	// False if the array has to be sent whole: it got shorter, or the channel hasn't sent it since gaining authority.
+	// Element deltas never shrink an array, as only the update path applies the length, and the runtime's stored data keeps the rest.
+	bool CanSendArrayDelta(UObject* Object, Schema_FieldId FieldId, GDK_PROPERTY(ArrayProperty) * Property, const uint8* Data);
+
+	// Writes the array's new length and the elements touched by its part of the changelist, each at its own index of the field.
+	void AddArrayDelta(Schema_Object* Object, Schema_FieldId FieldId, const FRepFieldDispatchEntry& Entry,
+					   GDK_PROPERTY(ArrayProperty) * Property, const uint8* Data, TArrayView<const uint16> ElementChangelist,
+					   TArray<Schema_FieldId>* ClearedIds);
+
 	USpatialNetDriver* NetDriver;
 	USpatialPackageMapClient* PackageMap;
 	USpatialClassInfoManager* ClassInfoManager;
 
+	// The channel of the entity being updated, which keeps the lengths arrays were last sent with.
+	USpatialActorChannel* UpdateChannel = nullptr;
+
 	bool bInterestHasChanged;
 	bool bInitialOnlyDataWritten;
 	bool bInitialOnlyReplicationEnabled;
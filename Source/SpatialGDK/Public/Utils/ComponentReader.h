@@ -11,8 +11,10 @@ DECLARE_LOG_CATEGORY_EXTERN(LogSpatialComponentReader, All, All);
 namespace SpatialGDK
 {
 class SpatialEventTracer;
+class FRepFieldDispatchTable;
+struct FRepFieldDispatchEntry;
 
-class ComponentReader
+class SPATIALGDK_API ComponentReader
 {
 public:
 	explicit ComponentReader(class USpatialNetDriver* InNetDriver, FObjectReferencesMap& InObjectReferencesMap,
@@ -25,16 +27,30 @@ public:
 	void ApplyComponentUpdate(Worker_ComponentId ComponentId, Schema_ComponentUpdate* Update, UObject& Object,
 							  USpatialActorChannel& Channel, bool& bOutReferencesChanged);
 
+#if WITH_DEV_AUTOMATION_TESTS
+	void ApplyArrayForTesting(Schema_Object* Object, Schema_FieldId FieldId, FObjectReferencesMap& InObjectReferencesMap,
+							  GDK_PROPERTY(ArrayProperty) * Property, uint8* Data, int32 Offset, bool& bOutReferencesChanged,
+							  Schema_Object* ArrayDelta)
+	{
+		ApplyArray(Object, FieldId, InObjectReferencesMap, Property, Data, Offset, Offset, INDEX_NONE, bOutReferencesChanged, ArrayDelta);
+	}
+#endif
+
 private:
 	void ApplySchemaObject(Schema_Object* ComponentObject, UObject& Object, USpatialActorChannel& Channel, bool bIsInitialData,
-						   const TArray<Schema_FieldId>& UpdatedIds, Worker_ComponentId ComponentId, bool& bOutReferencesChanged);
+						   TArrayView<const Schema_FieldId> UpdatedIds, Worker_ComponentId ComponentId, bool& bOutReferencesChanged);
+
+	const FRepFieldDispatchTable& GetDispatchTable(UObject& Object, const FRepLayout& RepLayout);
 
 	void ApplyProperty(Schema_Object* Object, Schema_FieldId FieldId, FObjectReferencesMap& InObjectReferencesMap, uint32 Index,
 					   GDK_PROPERTY(Property) * Property, uint8* Data, int32 Offset, int32 CmdIndex, int32 ParentIndex,
 					   bool& bOutReferencesChanged);
+	// With an ArrayDelta, the array is resized to the delta's length and only the elements it lists are applied, in place.
 	void ApplyArray(Schema_Object* Object, Schema_FieldId FieldId, FObjectReferencesMap& InObjectReferencesMap,
 					GDK_PROPERTY(ArrayProperty) * Property, uint8* Data, int32 Offset, int32 CmdIndex, int32 ParentIndex,
-					bool& bOutReferencesChanged);
+					bool& bOutReferencesChanged, Schema_Object* ArrayDelta = nullptr);
+	void ApplyFastArray(Schema_Object* ComponentObject, Schema_FieldId FieldId, UObject& Object, const FRepFieldDispatchEntry& Entry,
+						int32 Offset, bool& bOutReferencesChanged);
 
 	uint32 GetPropertyCount(const Schema_Object* Object, Schema_FieldId Id, GDK_PROPERTY(Property) * Property);
 
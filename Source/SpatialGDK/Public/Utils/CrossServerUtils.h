@@ -88,13 +88,15 @@ struct SlotAlloc
 	template <typename Functor>
 	void ForeachClearedSlot(Functor&& Fun)
 	{
-		for (int32 ToClearIdx = ToClear.Find(true); ToClearIdx >= 0; ToClearIdx = ToClear.Find(true))
+		for (TConstSetBitIterator<FDefaultBitArrayAllocator> It(ToClear); It; ++It)
 		{
-			Fun(ToClearIdx);
-			ToClear[ToClearIdx] = false;
+			Fun(It.GetIndex());
 		}
+		FMemory::Memzero(ToClear.GetData(), NumWords() * sizeof(uint32));
 	}
 
+	int32 NumWords() const { return FMath::DivideAndRoundUp(Occupied.Num(), static_cast<int32>(NumBitsPerDWORD)); }
+
 	TBitArray<FDefaultBitArrayAllocator> Occupied;
 	TBitArray<FDefaultBitArrayAllocator> ToClear;
 };
@@ -143,6 +145,55 @@ struct WriterState
 	SlotAlloc Alloc;
 };
 
+// IDs of the RPCs sent by a single sender, and the ring buffer slot each of them occupies.
+// Occupancy is tracked by the SlotAlloc used alongside it, and slots must be removed here when they are freed there.
+struct SlotMailbox
+{
+	SlotMailbox()
+	{
+		const uint32 NumSlots = RPCRingBufferUtils::GetRingBufferSize(ERPCType::CrossServer);
+		RPCIds.SetNumZeroed(NumSlots);
+		// There is at most one entry per slot, so adding and removing RPCs never allocates.
+		SlotsByRPCId.Reserve(NumSlots);
+	}
+
+	void Add(uint32 Slot, uint64 RPCId)
+	{
+		Remove(Slot);
+		RPCIds[Slot] = RPCId;
+		SlotsByRPCId.Add(RPCId, Slot);
+	}
+
+	void Remove(uint32 Slot)
+	{
+		const uint32* RPCSlot = SlotsByRPCId.Find(RPCIds[Slot]);
+		if (RPCSlot != nullptr && *RPCSlot == Slot)
+		{
+			SlotsByRPCId.Remove(RPCIds[Slot]);
+		}
+	}
+
+	TOptional<uint32> FindSlot(const TBitArray<FDefaultBitArrayAllocator>& Occupied, uint64 RPCId) const
+	{
+		const uint32* Slot = SlotsByRPCId.Find(RPCId);
+		if (Slot != nullptr && Occupied[*Slot])
+		{
+			return *Slot;
+		}
+		return {};
+	}
+
+	TArray<uint64> RPCIds;
+	TMap<uint64, uint32> SlotsByRPCId;
+};
+
+struct SlotWriterState
+{
+	uint64 LastSentRPCId = 0;
+	SlotMailbox Mailbox;
+	SlotAlloc Alloc;
+};
+
 struct RPCSlots
 {
 	Worker_EntityId CounterpartEntity;
@@ -0,0 +1,158 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+
+namespace SpatialGDK
+{
+using FGeneratedFieldEncoder = void (*)(Schema_Object* Object, Schema_FieldId FieldId, const uint8* Data);
+using FGeneratedFieldDecoder = void (*)(Schema_Object* Object, Schema_FieldId FieldId, uint8* Data);
+
+// Encode and decode functions for one replicated property, with the schema type picked by the schema generator.
+struct FGeneratedFieldCodec
+{
+	uint16 Handle;
+	// Checked against the RepLayout command when binding, along with the value size, in case the class changed since generation.
+	const TCHAR* PropertyName;
+	int32 ValueSize;
+	FGeneratedFieldEncoder Encode;
+	FGeneratedFieldDecoder Decode;
+};
+
+// Codecs generated for the replicated properties of a class. Properties without one go through reflection.
+struct FGeneratedClassCodec
+{
+	const TCHAR* ClassPath;
+	// Hash of the replicated fields the schema was generated from, only codecs that match the schema database are used.
+	uint32 RepFieldsHash;
+	TArrayView<const FGeneratedFieldCodec> Fields;
+};
+
+// Generated codecs register themselves here when their module is loaded, before USpatialClassInfoManager binds them to classes.
+class SPATIALGDK_API FGeneratedCodecRegistry
+{
+public:
+	static FGeneratedCodecRegistry& Get();
+
+	void Register(const FGeneratedClassCodec& Codec);
+	const FGeneratedClassCodec* Find(const FString& ClassPath) const;
+
+private:
+	TMap<FString, const FGeneratedClassCodec*> Codecs;
+};
+
+struct FGeneratedCodecRegistrar
+{
+	explicit FGeneratedCodecRegistrar(const FGeneratedClassCodec& Codec) { FGeneratedCodecRegistry::Get().Register(Codec); }
+};
+
+// Typed field functions the generated codecs are made of. They write the same schema types as ComponentFactory::AddProperty,
+// and read them back the same way ComponentReader::ApplyProperty does for the first value of a field.
+namespace GeneratedCodecs
+{
+inline void AddValue(Schema_Object* Object, Schema_FieldId FieldId, bool Value)
+{
+	Schema_AddBool(Object, FieldId, (uint8)Value);
+}
+inline void AddValue(Schema_Object* Object, Schema_FieldId FieldId, float Value)
+{
+	Schema_AddFloat(Object, FieldId, Value);
+}
+inline void AddValue(Schema_Object* Object, Schema_FieldId FieldId, double Value)
+{
+	Schema_AddDouble(Object, FieldId, Value);
+}
+inline void AddValue(Schema_Object* Object, Schema_FieldId FieldId, int8 Value)
+{
+	Schema_AddInt32(Object, FieldId, (int32)Value);
+}
+inline void AddValue(Schema_Object* Object, Schema_FieldId FieldId, int16 Value)
+{
+	Schema_AddInt32(Object, FieldId, (int32)Value);
+}
+inline void AddValue(Schema_Object* Object, Schema_FieldId FieldId, int32 Value)
+{
+	Schema_AddInt32(Object, FieldId, Value);
+}
+inline void AddValue(Schema_Object* Object, Schema_FieldId FieldId, int64 Value)
+{
+	Schema_AddInt64(Object, FieldId, Value);
+}
+inline void AddValue(Schema_Object* Object, Schema_FieldId FieldId, uint8 Value)
+{
+	Schema_AddUint32(Object, FieldId, (uint32)Value);
+}
+inline void AddValue(Schema_Object* Object, Schema_FieldId FieldId, uint16 Value)
+{
+	Schema_AddUint32(Object, FieldId, (uint32)Value);
+}
+inline void AddValue(Schema_Object* Object, Schema_FieldId FieldId, uint32 Value)
+{
+	Schema_AddUint32(Object, FieldId, Value);
+}
+inline void AddValue(Schema_Object* Object, Schema_FieldId FieldId, uint64 Value)
+{
+	Schema_AddUint64(Object, FieldId, Value);
+}
+
+inline void IndexValue(const Schema_Object* Object, Schema_FieldId FieldId, bool& OutValue)
+{
+	OutValue = Schema_IndexBool(Object, FieldId, 0) != 0;
+}
+inline void IndexValue(const Schema_Object* Object, Schema_FieldId FieldId, float& OutValue)
+{
+	OutValue = Schema_IndexFloat(Object, FieldId, 0);
+}
+inline void IndexValue(const Schema_Object* Object, Schema_FieldId FieldId, double& OutValue)
+{
+	OutValue = Schema_IndexDouble(Object, FieldId, 0);
+}
+inline void IndexValue(const Schema_Object* Object, Schema_FieldId FieldId, int8& OutValue)
+{
+	OutValue = (int8)Schema_IndexInt32(Object, FieldId, 0);
+}
+inline void IndexValue(const Schema_Object* Object, Schema_FieldId FieldId, int16& OutValue)
+{
+	OutValue = (int16)Schema_IndexInt32(Object, FieldId, 0);
+}
+inline void IndexValue(const Schema_Object* Object, Schema_FieldId FieldId, int32& OutValue)
+{
+	OutValue = Schema_IndexInt32(Object, FieldId, 0);
+}
+inline void IndexValue(const Schema_Object* Object, Schema_FieldId FieldId, int64& OutValue)
+{
+	OutValue = Schema_IndexInt64(Object, FieldId, 0);
+}
+inline void IndexValue(const Schema_Object* Object, Schema_FieldId FieldId, uint8& OutValue)
+{
+	OutValue = (uint8)Schema_IndexUint32(Object, FieldId, 0);
+}
+inline void IndexValue(const Schema_Object* Object, Schema_FieldId FieldId, uint16& OutValue)
+{
+	OutValue = (uint16)Schema_IndexUint32(Object, FieldId, 0);
+}
+inline void IndexValue(const Schema_Object* Object, Schema_FieldId FieldId, uint32& OutValue)
+{
+	OutValue = Schema_IndexUint32(Object, FieldId, 0);
+}
+inline void IndexValue(const Schema_Object* Object, Schema_FieldId FieldId, uint64& OutValue)
+{
+	OutValue = Schema_IndexUint64(Object, FieldId, 0);
+}
+
+template <typename T>
+void Encode(Schema_Object* Object, Schema_FieldId FieldId, const uint8* Data)
+{
+	AddValue(Object, FieldId, *reinterpret_cast<const T*>(Data));
+}
+
+template <typename T>
+void Decode(Schema_Object* Object, Schema_FieldId FieldId, uint8* Data)
+{
+	IndexValue(Object, FieldId, *reinterpret_cast<T*>(Data));
+}
+} // namespace GeneratedCodecs
+} // namespace SpatialGDK
@@ -0,0 +1,38 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace SpatialGDK
+{
+// Compact IDs for the paths in object references, so references to classes, assets and level objects don't send path strings.
+// The paths come from the schema database every worker loads. Schema generation only appends to them, so an ID keeps naming the
+// same path for as long as the schema database is kept, like generated component IDs do. 0 is never a valid ID.
+class SPATIALGDK_API FInternedObjectPaths
+{
+public:
+	void Init(TArrayView<const FString> InPaths);
+
+	// 0 if the path isn't interned, or IDs aren't being sent.
+	uint32 FindId(const FString& Path) const;
+
+	// Null if the ID isn't known, which means the sender used a different schema database.
+	const FString* FindPath(uint32 Id) const;
+
+	int32 Num() const { return Paths.Num(); }
+
+	// Hash of the paths in order. Workers whose hashes differ can't rely on reading each other's IDs.
+	uint32 GetHash() const { return Hash; }
+
+	// Cleared while the deployment's schema hash differs from this worker's, so references are written with their full paths.
+	void SetSendIds(bool bInSendIds) { bSendIds = bInSendIds; }
+	bool IsSendingIds() const { return bSendIds; }
+
+private:
+	TArray<FString> Paths;
+	TMap<FString, uint32> PathToId;
+	uint32 Hash = 0;
+	bool bSendIds = true;
+};
+} // namespace SpatialGDK
@@ -0,0 +1,50 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace SpatialGDK
+{
+// Fixed-memory log-linear histogram (HDR-style) for latency values, usually in microseconds.
+// Each power of two range is split into 16 linear sub-buckets, so recorded values are accurate to within ~6%.
+// Values above 2^MaxValueLog2 are clamped into the last bucket.
+// Copying a histogram takes a snapshot, and snapshots can be merged together.
+class SPATIALGDK_API FLatencyHistogram
+{
+public:
+	static constexpr int32 SubBucketBits = 4;
+	static constexpr int32 SubBucketCount = 1 << SubBucketBits;
+	static constexpr int32 MaxValueLog2 = 40;
+	static constexpr int32 NumBuckets = SubBucketCount + (MaxValueLog2 - SubBucketBits + 1) * SubBucketCount;
+
+	FLatencyHistogram();
+
+	void RecordValue(uint64 Value);
+	// Records the time elapsed since StartCycles, as returned by FPlatformTime::Cycles64, in microseconds.
+	void RecordMicrosecondsSince(uint64 StartCycles);
+
+	void Merge(const FLatencyHistogram& Other);
+	void Reset();
+
+	uint64 GetTotalCount() const { return TotalCount; }
+	uint64 GetMin() const { return TotalCount > 0 ? MinValue : 0; }
+	uint64 GetMax() const { return MaxValue; }
+	double GetMean() const { return TotalCount > 0 ? static_cast<double>(Sum) / TotalCount : 0.0; }
+
+	// Percentile in the range [0, 100]. Returns the highest value equivalent to the bucket holding that percentile.
+	uint64 GetValueAtPercentile(double Percentile) const;
+
+	static uint64 CyclesToMicroseconds(uint64 Cycles);
+
+private:
+	static int32 GetBucketIndex(uint64 Value);
+	static uint64 GetBucketHighestValue(int32 BucketIndex);
+
+	uint64 Counts[NumBuckets];
+	uint64 TotalCount;
+	uint64 Sum;
+	uint64 MinValue;
+	uint64 MaxValue;
+};
+} // namespace SpatialGDK
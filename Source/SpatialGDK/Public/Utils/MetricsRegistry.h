@@ -0,0 +1,74 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <atomic>
+
+namespace SpatialGDK
+{
+// Handle to a counter registered with FMetricsRegistry. Only valid for the registry that issued it.
+struct FMetricHandle
+{
+	bool IsValid() const { return Index != INDEX_NONE; }
+
+	int32 Index = INDEX_NONE;
+};
+
+// Registry of integer counters meant to be incremented on hot paths.
+// Counters are registered up front and incremented through their handle. Each thread increments its own copy of the
+// counters, which are only merged when values are read, so incrementing takes no locks and does no string work.
+class SPATIALGDK_API FMetricsRegistry
+{
+public:
+	static constexpr int32 MaxCounters = 1024;
+
+	FMetricsRegistry();
+	~FMetricsRegistry();
+
+	FMetricsRegistry(const FMetricsRegistry&) = delete;
+	FMetricsRegistry& operator=(const FMetricsRegistry&) = delete;
+
+	// Registration takes a lock and should happen outside of hot paths. Registering a name again returns the handle it was first
+	// registered with. Returns an invalid handle once MaxCounters is reached.
+	FMetricHandle RegisterCounter(FName Name);
+
+	void Increment(FMetricHandle Handle, int64 Delta = 1)
+	{
+		if (Handle.IsValid())
+		{
+			std::atomic<int64>& Value = GetThreadCounters().Values[Handle.Index];
+			Value.store(Value.load(std::memory_order_relaxed) + Delta, std::memory_order_relaxed);
+		}
+	}
+
+	// Sum of the counter across all threads since the last Reset.
+	int64 GetValue(FMetricHandle Handle) const;
+	FName GetName(FMetricHandle Handle) const;
+	int32 GetNumCounters() const;
+
+	// Counters keep counting on their threads; Reset records the current values as the new baseline.
+	void Reset();
+
+private:
+	struct FThreadCounters
+	{
+		explicit FThreadCounters(uint32 InThreadId);
+
+		const uint32 ThreadId;
+		std::atomic<int64> Values[MaxCounters];
+	};
+
+	FThreadCounters& GetThreadCounters();
+	FThreadCounters& FindOrAddThreadCounters();
+	int64 GetMergedValue(int32 Index) const;
+
+	const uint32 RegistryId;
+
+	mutable FCriticalSection Mutex;
+	TArray<FName> Names;
+	TArray<int64> Baselines;
+	TArray<TUniquePtr<FThreadCounters>> ThreadCounters;
+};
+} // namespace SpatialGDK
@@ -0,0 +1,108 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace SpatialGDK
+{
+enum class ENetworkFrameStage : uint8
+{
+	// All of USpatialWorkerConnection::Advance, including the view coordinator stages below.
+	ConnectionAdvance,
+	OpRetrieval,
+	ViewDelta,
+	DispatcherCallbacks,
+	SubViewAdvance,
+	ActorSystemRemoves,
+	ActorSystemUpdates,
+	ActorSystemAdds,
+	ProcessOps,
+	RPCServices,
+	ServerReplicateActors,
+	Flush,
+
+	Count
+};
+
+enum class ENetworkFrameCounter : uint8
+{
+	OpsReceived,
+	EntityDeltas,
+	RPCPayloadBytesSent,
+	ActorsReplicated,
+
+	Count
+};
+
+// Records per-stage time and counters for each net driver frame into a rolling window of frames.
+// Recording is a couple of additions per stage, so the profiler is always on. Summaries are only computed when requested.
+class SPATIALGDK_API FNetworkFrameProfiler
+{
+public:
+	static constexpr int32 DefaultWindowSize = 600;
+
+	explicit FNetworkFrameProfiler(int32 InWindowSize = DefaultWindowSize);
+
+	void AddStageCycles(ENetworkFrameStage Stage, uint64 Cycles) { CurrentFrame.StageCycles[static_cast<uint8>(Stage)] += Cycles; }
+	void AddCounter(ENetworkFrameCounter Counter, uint64 Value) { CurrentFrame.Counters[static_cast<uint8>(Counter)] += Value; }
+
+	// Moves the current frame into the window.
+	void EndFrame();
+
+	int32 GetNumFrames() const { return NumFrames; }
+
+	// Percentile in the range [0, 100] of the per-frame values in the window.
+	double GetStagePercentileMicroseconds(ENetworkFrameStage Stage, double Percentile) const;
+	uint64 GetCounterPercentile(ENetworkFrameCounter Counter, double Percentile) const;
+
+	void DumpSummary(FOutputDevice& Ar) const;
+
+	static const TCHAR* GetStageName(ENetworkFrameStage Stage);
+	static const TCHAR* GetCounterName(ENetworkFrameCounter Counter);
+
+private:
+	struct FFrame
+	{
+		uint64 StageCycles[static_cast<uint8>(ENetworkFrameStage::Count)] = {};
+		uint64 Counters[static_cast<uint8>(ENetworkFrameCounter::Count)] = {};
+	};
+
+	template <typename GetValueFunc>
+	TArray<uint64> GetSortedValues(GetValueFunc&& GetValue) const;
+	static uint64 GetPercentile(const TArray<uint64>& SortedValues, double Percentile);
+
+	TArray<FFrame> Window;
+	int32 NextFrameIndex = 0;
+	int32 NumFrames = 0;
+	FFrame CurrentFrame;
+};
+
+// Adds the time spent in its scope to a stage of the profiler, if there is one.
+class FNetworkFrameStageScope
+{
+public:
+	FNetworkFrameStageScope(FNetworkFrameProfiler* InProfiler, ENetworkFrameStage InStage)
+		: Profiler(InProfiler)
+		, Stage(InStage)
+		, StartCycles(InProfiler != nullptr ? FPlatformTime::Cycles64() : 0)
+	{
+	}
+
+	~FNetworkFrameStageScope()
+	{
+		if (Profiler != nullptr)
+		{
+			Profiler->AddStageCycles(Stage, FPlatformTime::Cycles64() - StartCycles);
+		}
+	}
+
+	FNetworkFrameStageScope(const FNetworkFrameStageScope&) = delete;
+	FNetworkFrameStageScope& operator=(const FNetworkFrameStageScope&) = delete;
+
+private:
+	FNetworkFrameProfiler* Profiler;
+	ENetworkFrameStage Stage;
+	uint64 StartCycles;
+};
+} // namespace SpatialGDK
@@ -0,0 +1,68 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace SpatialGDK
+{
+namespace PartialSortPrivate
+{
+// Restores the heap below Index, with the element that comes last by Predicate on top.
+template <typename T, typename PredicateType>
+void SiftDown(T** Heap, int32 Index, int32 Count, const PredicateType& Predicate)
+{
+	for (;;)
+	{
+		int32 Last = Index;
+		const int32 Left = 2 * Index + 1;
+		const int32 Right = Left + 1;
+		if (Left < Count && Predicate(*Heap[Last], *Heap[Left]))
+		{
+			Last = Left;
+		}
+		if (Right < Count && Predicate(*Heap[Last], *Heap[Right]))
+		{
+			Last = Right;
+		}
+		if (Last == Index)
+		{
+			return;
+		}
+		Swap(Heap[Index], Heap[Last]);
+		Index = Last;
+	}
+}
+} // namespace PartialSortPrivate
+
+// Reorders the Num pointers in Items so the first K point to the K elements that come first by Predicate, sorted the same way Sort
+// sorts arrays of pointers. The rest are left in no particular order.
+// The first K seen so far are kept in a heap with the one that comes last on top, so this is O(Num log K) instead of O(Num log Num).
+template <typename T, typename PredicateType>
+void PartialSort(T** Items, int32 Num, int32 K, const PredicateType& Predicate)
+{
+	if (K <= 0 || Num <= 0)
+	{
+		return;
+	}
+
+	if (K < Num)
+	{
+		for (int32 Index = K / 2 - 1; Index >= 0; --Index)
+		{
+			PartialSortPrivate::SiftDown(Items, Index, K, Predicate);
+		}
+
+		for (int32 Index = K; Index < Num; ++Index)
+		{
+			if (Predicate(*Items[Index], *Items[0]))
+			{
+				Swap(Items[Index], Items[0]);
+				PartialSortPrivate::SiftDown(Items, 0, K, Predicate);
+			}
+		}
+	}
+
+	Sort(Items, FMath::Min(K, Num), Predicate);
+}
+} // namespace SpatialGDK
@@ -0,0 +1,42 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Serialization/BitReader.h"
+#include "Serialization/BitWriter.h"
+
+#include "Utils/SchemaDatabase.h"
+
+namespace SpatialGDK
+{
+struct FPropertyQuantization
+{
+	ESpatialQuantization Mode = ESpatialQuantization::None;
+	uint8 Bits = 0;
+	float Bounds = 0.f;
+	// Only for FRepMovement, the velocities are clamped to this instead of Bounds. 0 uses DefaultVelocityBounds.
+	float VelocityBounds = 0.f;
+};
+
+// Writes FVector, FRotator, FQuat and FRepMovement values with fewer bits than their NetSerialize, trading precision for bandwidth.
+//  - FVector: FixedPoint, each component clamped to [-Bounds, Bounds] and written as a signed multiple of
+//    Bounds / (2^(Bits-1) - 1), so 0 and the bounds round-trip exactly.
+//  - FRotator: Angle, each axis as a fraction of a full turn.
+//  - FQuat: SmallestThree, the quaternion is normalized and its largest component rebuilt from the other three when read.
+//  - FRepMovement: FixedPoint for the location within Bounds and the velocities within VelocityBounds, with 16 bit angles for
+//    the rotation.
+namespace PropertyQuantization
+{
+// Bits are kept below 31 so quantized values fit FBitWriter::WriteInt.
+constexpr uint8 MaxBits = 30;
+
+// Velocity bounds of FRepMovement when none are set, in cm/s (and deg/s for the angular velocity).
+constexpr float DefaultVelocityBounds = 16384.f;
+
+SPATIALGDK_API bool IsSupported(const UScriptStruct* Struct, const FPropertyQuantization& Quantization);
+
+SPATIALGDK_API void Write(FBitWriter& Writer, const UScriptStruct* Struct, const FPropertyQuantization& Quantization, const uint8* Data);
+SPATIALGDK_API void Read(FBitReader& Reader, const UScriptStruct* Struct, const FPropertyQuantization& Quantization, uint8* Data);
+} // namespace PropertyQuantization
+} // namespace SpatialGDK
@@ -66,6 +66,9 @@ struct FRPCErrorInfo
 	TWeakObjectPtr<UFunction> Function = nullptr;
 	ERPCResult ErrorCode = ERPCResult::Unknown;
 	ERPCQueueProcessResult QueueProcessResult = ERPCQueueProcessResult::StopProcessing;
+
+	// References the RPC is blocked on. Used to retry the queue only once one of them resolves.
+	TArray<FUnrealObjectRef> UnresolvedRefs;
 };
 
 struct SPATIALGDK_API FPendingRPCParams
@@ -108,18 +111,45 @@ public:
 	void ProcessRPCs();
 	void DropForEntity(const Worker_EntityId& EntityId);
 
+	// Queues of a type with a retry deadline are no longer walked by every ProcessRPCs call once blocked.
+	// They are retried when one of the references they are waiting on resolves, or once the deadline has passed.
+	void SetRetryDeadline(ERPCType Type, float Seconds);
+	void OnObjectRefResolved(const FUnrealObjectRef& ObjectRef);
+
 	bool ObjectHasRPCsQueuedOfType(const Worker_EntityId& EntityId, ERPCType Type) const;
 
+	SIZE_T GetAllocatedSize() const;
+
 private:
 	using FArrayOfParams = TArray<FPendingRPCParams>;
 	using FRPCMap = TMap<Worker_EntityId_Key, FArrayOfParams>;
 	using RPCContainerType = TMap<ERPCType, FRPCMap>;
+	using FQueueKey = TPair<ERPCType, Worker_EntityId_Key>;
+
+	struct FBlockedQueue
+	{
+		TArray<FUnrealObjectRef> WaitingOnRefs;
+		FDateTime RetryDeadline;
+	};
+
+	void ProcessQueue(const FQueueKey& Key, FArrayOfParams& RPCList);
+	void ProcessQueuesWaitingOn(const FUnrealObjectRef& ObjectRef);
+	void ProcessDeferredResolvedRefs();
+	ERPCQueueProcessResult ApplyFunction(FPendingRPCParams& Params, TArray<FUnrealObjectRef>& OutUnresolvedRefs);
+
+	void BlockQueue(const FQueueKey& Key, const FDateTime& HeadTimestamp, TArray<FUnrealObjectRef>&& UnresolvedRefs);
+	void UnblockQueue(const FQueueKey& Key);
+	bool IsWaitingForRetry(const FQueueKey& Key, const FDateTime& Now) const;
 
-	void ProcessRPCs(FArrayOfParams& RPCList);
-	ERPCQueueProcessResult ApplyFunction(FPendingRPCParams& Params);
 	RPCContainerType QueuedRPCs;
 	FProcessRPCDelegate ProcessingFunction;
 	bool bAlreadyProcessingRPCs = false;
 
+	TMap<ERPCType, FTimespan> RetryDeadlines;
+	TMap<FQueueKey, FBlockedQueue> BlockedQueues;
+	TMap<FUnrealObjectRef, TArray<FQueueKey>> QueuesWaitingOnRef;
+	// References resolved while the container was already processing, handled once it is done.
+	TArray<FUnrealObjectRef> DeferredResolvedRefs;
+
 	ERPCQueueType QueueType = ERPCQueueType::Unknown;
 };
@@ -17,6 +17,8 @@ struct RPCRingBuffer
 
 	const TOptional<RPCPayload>& GetRingBufferElement(uint64 RPCId) const { return RingBuffer[(RPCId - 1) % RingBuffer.Num()]; }
 
+	SIZE_T GetAllocatedSize() const;
+
 	ERPCType Type;
 	TArray<TOptional<RPCPayload>> RingBuffer;
 	TArray<TOptional<CrossServerRPCInfo>> Counterpart;
@@ -0,0 +1,89 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Net/RepLayout.h"
+
+#include "Utils/GDKPropertyMacros.h"
+#include "Utils/GeneratedComponentCodec.h"
+#include "Utils/PropertyQuantization.h"
+
+namespace SpatialGDK
+{
+enum class ERepFieldDecoder : uint8
+{
+	Property,
+	DynamicArray,
+	FastArray,
+	// A dynamic array command without an array property, which can't be applied.
+	Invalid,
+};
+
+// Everything ComponentReader needs to apply one replicated field, resolved from the class's RepLayout ahead of time.
+struct FRepFieldDispatchEntry
+{
+	GDK_PROPERTY(Property) * Property = nullptr;
+	GDK_PROPERTY(Property) * ParentProperty = nullptr;
+	// Only for FastArray fields.
+	UScriptStruct* FastArrayStruct = nullptr;
+
+	int32 CmdIndex = INDEX_NONE;
+	int32 ParentIndex = INDEX_NONE;
+	int32 ParentArrayIndex = 0;
+	int32 Offset = 0;
+	int32 ShadowOffset = 0;
+	// Only for DynamicArray fields, the number of rep handles in each element's part of the array's changelist.
+	int32 ArrayHandlesPerElement = 0;
+
+	// Role and RemoteRole are written to each other on actors, unless the channel skips the role swap.
+	// For every other field these are the same as Offset and ShadowOffset.
+	int32 SwappedOffset = 0;
+	int32 SwappedShadowOffset = 0;
+
+	ELifetimeCondition Condition = COND_None;
+	ELifetimeRepNotifyCondition RepNotifyCondition = REPNOTIFY_OnChanged;
+	ERepFieldDecoder Decoder = ERepFieldDecoder::Property;
+	bool bHasRepNotify = false;
+	bool bIsRemoteRole = false;
+	bool bSwapsRole = false;
+	// Opted in with the SpatialArrayDelta metadata. Component updates then only hold the array's new length and its changed elements.
+	bool bSendsArrayDeltas = false;
+
+	// Set with the SpatialQuantization metadata on supported struct properties, which are then written with PropertyQuantization.
+	FPropertyQuantization Quantization;
+
+	// Set when a generated codec for the class matched this property, used in place of reflection.
+	FGeneratedFieldEncoder GeneratedEncode = nullptr;
+	FGeneratedFieldDecoder GeneratedDecode = nullptr;
+
+	int32 GetOffset(bool bSkipRoleSwap) const { return bSwapsRole && !bSkipRoleSwap ? SwappedOffset : Offset; }
+	int32 GetShadowOffset(bool bSkipRoleSwap) const { return bSwapsRole && !bSkipRoleSwap ? SwappedShadowOffset : ShadowOffset; }
+};
+
+// Immutable table from a class's rep handles to their RepLayout commands, built once when the class info is created.
+// Schema field IDs of replicated properties are offset rep handles, so applying an update only indexes into it.
+class SPATIALGDK_API FRepFieldDispatchTable
+{
+public:
+	static TSharedRef<const FRepFieldDispatchTable> Create(const FRepLayout& RepLayout, const FGeneratedClassCodec* Codec = nullptr,
+														   TArrayView<const uint32> DeltaArrayHandles = TArrayView<const uint32>(),
+														   TArrayView<const FQuantizedPropertySchemaData> QuantizedProperties =
+															   TArrayView<const FQuantizedPropertySchemaData>());
+
+	// Null if the handle isn't part of the layout.
+	const FRepFieldDispatchEntry* FindByHandle(int32 Handle) const
+	{
+		return Entries.IsValidIndex(Handle - 1) ? &Entries[Handle - 1] : nullptr;
+	}
+
+	int32 Num() const { return Entries.Num(); }
+
+	// True if every replicated property of the class uses push model, so an object without dirty properties hasn't changed.
+	bool AreAllPropertiesPushBased() const { return bAllPropertiesPushBased; }
+
+private:
+	TArray<FRepFieldDispatchEntry> Entries;
+	bool bAllPropertiesPushBased = false;
+};
+} // namespace SpatialGDK
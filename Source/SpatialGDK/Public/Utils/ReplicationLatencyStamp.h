@@ -0,0 +1,41 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+
+namespace SpatialGDK
+{
+// Send time and frame of a sampled component update, carried in a reserved field of the update.
+// Times are UTC, so latencies measured across machines include their clock offset.
+struct SPATIALGDK_API FReplicationLatencyStamp
+{
+	int64 SendTimeTicks = 0;
+	uint64 FrameNumber = 0;
+
+	static FReplicationLatencyStamp Now();
+
+	void WriteToUpdate(Schema_ComponentUpdate* Update) const;
+	static TOptional<FReplicationLatencyStamp> ReadFromUpdate(Schema_ComponentUpdate* Update);
+	// Stamped updates leave their stamp behind when applied to component data, where it is stale.
+	static void ClearFromData(Schema_ComponentData* Data);
+
+	uint64 GetMicrosecondsSinceSent(int64 NowTicks) const;
+};
+
+// Picks a fixed fraction of updates to stamp, spread evenly rather than at random.
+class SPATIALGDK_API FReplicationLatencySampler
+{
+public:
+	explicit FReplicationLatencySampler(float InSampleRate = 0.0f);
+
+	bool IsEnabled() const { return SampleRate > 0.0f; }
+	bool ShouldStamp();
+
+private:
+	float SampleRate;
+	float Accumulator = 0.0f;
+};
+} // namespace SpatialGDK
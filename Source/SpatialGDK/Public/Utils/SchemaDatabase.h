@@ -27,6 +27,43 @@ struct FActorSpecificSubobjectSchemaData
 	uint32 SchemaComponents[SCHEMA_Count] = {};
 };
 
+// How a replicated vector, rotator, quaternion or movement struct is written, set with the SpatialQuantization metadata.
+UENUM()
+enum class ESpatialQuantization : uint8
+{
+	None,
+	// Each vector component as a fixed point number within Bounds of 0.
+	FixedPoint,
+	// Each rotator axis as a fraction of a full turn.
+	Angle,
+	// The index of the largest quaternion component, and the other three.
+	SmallestThree,
+};
+
+USTRUCT()
+struct FQuantizedPropertySchemaData
+{
+	GENERATED_USTRUCT_BODY()
+
+	UPROPERTY(Category = "SpatialGDK", VisibleAnywhere)
+	uint32 Handle = 0;
+
+	UPROPERTY(Category = "SpatialGDK", VisibleAnywhere)
+	ESpatialQuantization Mode = ESpatialQuantization::None;
+
+	// Bits written for each component.
+	UPROPERTY(Category = "SpatialGDK", VisibleAnywhere)
+	uint8 Bits = 0;
+
+	// Only for FixedPoint, values are clamped to [-Bounds, Bounds].
+	UPROPERTY(Category = "SpatialGDK", VisibleAnywhere)
+	float Bounds = 0.f;
+
+	// Only for FixedPoint on FRepMovement, the velocities are clamped to [-VelocityBounds, VelocityBounds]. 0 uses the default.
+	UPROPERTY(Category = "SpatialGDK", VisibleAnywhere)
+	float VelocityBounds = 0.f;
+};
+
 // Schema data related to an Actor class
 USTRUCT()
 struct FActorSchemaData
@@ -41,6 +78,17 @@ struct FActorSchemaData
 
 	UPROPERTY(Category = "SpatialGDK", VisibleAnywhere)
 	TMap<uint32, FActorSpecificSubobjectSchemaData> SubobjectData;
+
+	// Hash of the replicated fields the schema was generated from, matched against generated codecs. 0 if unknown.
+	UPROPERTY(Category = "SpatialGDK", VisibleAnywhere)
+	uint32 RepFieldsHash = 0;
+
+	// Rep handles of the arrays marked with the SpatialArrayDelta metadata, which isn't available in cooked builds.
+	UPROPERTY(Category = "SpatialGDK", VisibleAnywhere)
+	TArray<uint32> DeltaArrayHandles;
+
+	UPROPERTY(Category = "SpatialGDK", VisibleAnywhere)
+	TArray<FQuantizedPropertySchemaData> QuantizedProperties;
 };
 
 USTRUCT()
@@ -64,6 +112,17 @@ struct FSubobjectSchemaData
 	UPROPERTY(Category = "SpatialGDK", VisibleAnywhere)
 	TArray<FDynamicSubobjectSchemaData> DynamicSubobjectComponents;
 
+	// Hash of the replicated fields the schema was generated from, matched against generated codecs. 0 if unknown.
+	UPROPERTY(Category = "SpatialGDK", VisibleAnywhere)
+	uint32 RepFieldsHash = 0;
+
+	// Rep handles of the arrays marked with the SpatialArrayDelta metadata, which isn't available in cooked builds.
+	UPROPERTY(Category = "SpatialGDK", VisibleAnywhere)
+	TArray<uint32> DeltaArrayHandles;
+
+	UPROPERTY(Category = "SpatialGDK", VisibleAnywhere)
+	TArray<FQuantizedPropertySchemaData> QuantizedProperties;
+
 	FORCEINLINE Worker_ComponentId GetDynamicSubobjectComponentId(int Idx, ESchemaComponentType ComponentType) const
 	{
 		Worker_ComponentId ComponentId = 0;
@@ -160,6 +219,11 @@ public:
 	UPROPERTY(Category = "SpatialGDK", VisibleAnywhere)
 	TMap<ERPCType, uint32> RPCRingBufferSizeMap;
 
+	// Package paths and object names of the classes and levels in the schema. Object references naming one of these send its
+	// position in this list instead of the string, see FInternedObjectPaths. Schema generation only appends to it.
+	UPROPERTY(Category = "SpatialGDK", VisibleAnywhere)
+	TArray<FString> InternedObjectPaths;
+
 	UPROPERTY(Category = "SpatialGDK", VisibleAnywhere)
 	ESchemaDatabaseVersion SchemaDatabaseVersion;
 };
@@ -7,6 +7,7 @@
 
 #include "Schema/UnrealObjectRef.h"
 #include "SpatialConstants.h"
+#include "Utils/InternedObjectPaths.h"
 
 #include <WorkerSDK/improbable/c_schema.h>
 #include <WorkerSDK/improbable/c_worker.h>
@@ -81,7 +82,11 @@ inline TArray<uint8> GetBytesFromSchema(const Schema_Object* Object, Schema_Fiel
 	//return IndexBytesFromSchema(Object, Id, 0);
 }
 
-inline void AddObjectRefToSchema(Schema_Object* Object, Schema_FieldId Id, const FUnrealObjectRef& ObjectRef,bool is_repeat = false)
+// Paths found in InternedPaths are sent as their ID, unless it stopped sending IDs because the deployment's schema hash, which
+// covers the interned paths, differs from this worker's. Schema generation only appends paths, so IDs stored in snapshots and
+// persisted component data keep naming the same paths for as long as the schema database is kept.
+inline void AddObjectRefToSchema(Schema_Object* Object, Schema_FieldId Id, const FUnrealObjectRef& ObjectRef,bool is_repeat = false,
+								 const FInternedObjectPaths* InternedPaths = nullptr)
 {
 	using namespace SpatialConstants;
 
@@ -91,13 +96,21 @@ inline void AddObjectRefToSchema(Schema_Object* Object, Schema_FieldId Id, const
 	Schema_AddUint32(ObjectRefObject, UNREAL_OBJECT_REF_OFFSET_ID, ObjectRef.Offset);
 	if (ObjectRef.Path)
 	{
-		AddStringToSchema(ObjectRefObject, UNREAL_OBJECT_REF_PATH_ID, *ObjectRef.Path);
+		const uint32 InternedPathId = InternedPaths != nullptr ? InternedPaths->FindId(*ObjectRef.Path) : 0;
+		if (InternedPathId != 0)
+		{
+			Schema_AddUint32(ObjectRefObject, UNREAL_OBJECT_REF_INTERNED_PATH_ID, InternedPathId);
+		}
+		else
+		{
+			AddStringToSchema(ObjectRefObject, UNREAL_OBJECT_REF_PATH_ID, *ObjectRef.Path);
+		}
 		//FString str =  GetStringFromSchema(ObjectRefObject,UNREAL_OBJECT_REF_PATH_ID);
 		Schema_AddBool(ObjectRefObject, UNREAL_OBJECT_REF_NO_LOAD_ON_CLIENT_ID, ObjectRef.bNoLoadOnClient);
 	}
 	if (ObjectRef.Outer)
 	{
-		AddObjectRefToSchema(ObjectRefObject, UNREAL_OBJECT_REF_OUTER_ID, *ObjectRef.Outer);
+		AddObjectRefToSchema(ObjectRefObject, UNREAL_OBJECT_REF_OUTER_ID, *ObjectRef.Outer, false, InternedPaths);
 	}
 	if (ObjectRef.bUseClassPathToLoadObject)
 	{
@@ -107,7 +120,9 @@ inline void AddObjectRefToSchema(Schema_Object* Object, Schema_FieldId Id, const
 
 FUnrealObjectRef GetObjectRefFromSchema(Schema_Object* Object, Schema_FieldId Id);
 
-inline FUnrealObjectRef IndexObjectRefFromSchema(Schema_Object* Object, Schema_FieldId Id,uint32 Index)
+// InternedPaths has to be the one the reference was written with, if any.
+inline FUnrealObjectRef IndexObjectRefFromSchema(Schema_Object* Object, Schema_FieldId Id,uint32 Index,
+												 const FInternedObjectPaths* InternedPaths = nullptr)
 {
 	using namespace SpatialConstants;
 
@@ -125,13 +140,20 @@ inline FUnrealObjectRef IndexObjectRefFromSchema(Schema_Object* Object, Schema_F
 	{
 		ObjectRef.Path = GetStringFromSchema(ObjectRefObject, UNREAL_OBJECT_REF_PATH_ID);
 	}
+	else if (InternedPaths != nullptr && Schema_GetUint32Count(ObjectRefObject, UNREAL_OBJECT_REF_INTERNED_PATH_ID) > 0)
+	{
+		if (const FString* InternedPath = InternedPaths->FindPath(Schema_GetUint32(ObjectRefObject, UNREAL_OBJECT_REF_INTERNED_PATH_ID)))
+		{
+			ObjectRef.Path = *InternedPath;
+		}
+	}
 	if (Schema_GetBoolCount(ObjectRefObject, UNREAL_OBJECT_REF_NO_LOAD_ON_CLIENT_ID) > 0)
 	{
 		ObjectRef.bNoLoadOnClient = GetBoolFromSchema(ObjectRefObject, UNREAL_OBJECT_REF_NO_LOAD_ON_CLIENT_ID);
 	}
 	if (Schema_GetObjectCount(ObjectRefObject, UNREAL_OBJECT_REF_OUTER_ID) > 0)
 	{
-		ObjectRef.Outer = GetObjectRefFromSchema(ObjectRefObject, UNREAL_OBJECT_REF_OUTER_ID);
+		ObjectRef.Outer = IndexObjectRefFromSchema(ObjectRefObject, UNREAL_OBJECT_REF_OUTER_ID, 0, InternedPaths);
 	}
 	if (Schema_GetBoolCount(ObjectRefObject, UNREAL_OBJECT_REF_USE_CLASS_PATH_TO_LOAD_ID) > 0)
 	{
@@ -228,6 +250,18 @@ inline FVector GetVectorFromSchema(Schema_Object* Object, Schema_FieldId Id)
 	return IndexVectorFromSchema(Object, Id, 0);
 }
 
+// Size of the component data or update once serialized. Walks the whole schema object, so only use where the size is needed.
+inline uint32 GetSerializedSize(Schema_ComponentData* Data)
+{
+	return Schema_GetWriteBufferLength(Schema_GetComponentDataFields(Data));
+}
+
+inline uint32 GetSerializedSize(Schema_ComponentUpdate* Update)
+{
+	return Schema_GetWriteBufferLength(Schema_GetComponentUpdateFields(Update))
+		   + Schema_GetWriteBufferLength(Schema_GetComponentUpdateEvents(Update));
+}
+
 // Generates the full path from an ObjectRef, if it has paths. Writes the result to OutPath.
 // Does not clear OutPath first.
 void GetFullPathFromUnrealObjectReference(const FUnrealObjectRef& ObjectRef, FString& OutPath);
@@ -5,6 +5,7 @@
 #include "LoadBalancing/WorkerRegion.h"
 #include "SpatialCommonTypes.h"
 #include "SpatialDebuggerConfigUI.h"
+#include "Utils/SpatialDebuggerActorGrid.h"
 
 #include "Containers/Map.h"
 #include "CoreMinimal.h"
@@ -19,6 +20,7 @@
 class APawn;
 class APlayerController;
 class APlayerState;
+class USceneComponent;
 class USpatialNetDriver;
 class UFont;
 class UTexture2D;
@@ -33,6 +35,8 @@ DECLARE_CYCLE_STAT(TEXT("Projection"), STAT_Projection, STATGROUP_SpatialDebugge
 DECLARE_CYCLE_STAT(TEXT("DrawIcons"), STAT_DrawIcons, STATGROUP_SpatialDebugger);
 DECLARE_CYCLE_STAT(TEXT("DrawText"), STAT_DrawText, STATGROUP_SpatialDebugger);
 DECLARE_CYCLE_STAT(TEXT("BuildText"), STAT_BuildText, STATGROUP_SpatialDebugger);
+DECLARE_CYCLE_STAT(TEXT("UpdateActorGrid"), STAT_UpdateActorGrid, STATGROUP_SpatialDebugger);
+DECLARE_CYCLE_STAT(TEXT("Picking"), STAT_Picking, STATGROUP_SpatialDebugger);
 
 namespace SpatialGDK
 {
@@ -242,6 +246,16 @@ private:
 
 	bool ProjectActorToScreen(const FVector& ActorLocation, const FVector& PlayerLocation, FVector2D& OutLocation, const UCanvas* Canvas);
 
+	// Keep the actor grid in step with the actors tracked by the debugger system.
+	void OnEntityRemoved(Worker_EntityId EntityId);
+	void OnActorTransformUpdated(USceneComponent* Component, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport,
+								 Worker_EntityId EntityId);
+	void UpdateActorGrid(Worker_EntityId EntityId, const AActor& Actor);
+	void ResetActorGrid();
+	void UpdateViewVersion(const UCanvas* Canvas);
+	FVector2D GetCachedScreenLocation(Worker_EntityId EntityId, const FVector& ActorLocation, const UCanvas* Canvas);
+	bool IsPickable(const AActor& Actor, const FVector& RayStart, const FVector& RayEnd) const;
+
 	FVector GetLocalPawnLocation();
 
 	// Allow user to select actor(s) for debugging - the mesh on the actor must have collision presets enabled to block on at least one of
@@ -258,7 +272,7 @@ private:
 
 	void RevertHoverMaterials();
 
-	void DrawTag(UCanvas* Canvas, const FVector2D& ScreenLocation, const Worker_EntityId EntityId, const FString& ActorName,
+	void DrawTag(UCanvas* Canvas, const FVector2D& ScreenLocation, const Worker_EntityId EntityId, const FName ActorName,
 				 const bool bCentre);
 	void DrawDebugLocalPlayer(UCanvas* Canvas);
 
@@ -327,4 +341,35 @@ private:
 
 	// Select actor object types to query
 	FCollisionObjectQueryParams CollisionObjectParams;
+
+	// Tracked actors bucketed by location, used to cull tags and pick actors without visiting every entity
+	SpatialGDK::FSpatialDebuggerActorGrid ActorGrid;
+
+	// Root components whose moves update the actor grid, and the bindings to remove when their entity is removed
+	TMap<Worker_EntityId_Key, TPair<TWeakObjectPtr<USceneComponent>, FDelegateHandle>> ActorGridTransformBindings;
+
+	// Text and widths of an entity's tag, rebuilt only when what it shows changes. The screen location is reused while neither the
+	// actor nor the view has moved.
+	struct FTagLayout
+	{
+		bool bIsBuilt = false;
+		FName ActorName;
+		int32 AuthoritativeVirtualWorkerId = 0;
+		int32 IntentVirtualWorkerId = 0;
+		uint8 ShowFlags = 0;
+		FString AuthIdText;
+		FString IntentIdText;
+		FString Label;
+		float AuthIdWidth = 0.0f;
+		float AuthIntentIdWidth = 0.0f;
+		float CentredOffset = 0.0f;
+
+		FVector ProjectedTagLocation = FVector::ZeroVector;
+		FVector2D ScreenLocation = FVector2D::ZeroVector;
+		uint32 ProjectedViewVersion = 0;
+	};
+	TMap<Worker_EntityId_Key, FTagLayout> TagLayoutCache;
+
+	FMatrix LastViewProjectionMatrix = FMatrix::Identity;
+	uint32 ViewVersion = 1;
 };
@@ -0,0 +1,67 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "SpatialCommonTypes.h"
+
+struct FConvexVolume;
+
+namespace SpatialGDK
+{
+// Uniform spatial hash of the entities tracked by the spatial debugger, so drawing and picking only visit the cells near the player.
+// The debugger keeps it up to date as tracked actors are added, removed and moved, and each of those is constant time.
+class SPATIALGDK_API FSpatialDebuggerActorGrid
+{
+public:
+	static constexpr float DefaultCellSize = 25.0f * 100.0f; // 25m
+
+	explicit FSpatialDebuggerActorGrid(float InCellSize = DefaultCellSize);
+
+	void AddOrUpdate(Worker_EntityId EntityId, const FVector& Location, float BoundsRadius);
+	void Remove(Worker_EntityId EntityId);
+	void Reset();
+
+	int32 Num() const { return EntityCells.Num(); }
+	int32 GetNumCells() const { return Cells.Num(); }
+
+	// Calls Visitor for every entity within Range of Origin whose location plus FrustumOffset is inside Frustum, if there is one.
+	// Cells outside the range or the frustum are skipped without looking at their entities.
+	void ForEachInRange(const FVector& Origin, float Range, const FConvexVolume* Frustum, const FVector& FrustumOffset,
+						TFunctionRef<void(Worker_EntityId EntityId, const FVector& Location)> Visitor) const;
+
+	// Entities whose bounding sphere is crossed by the segment, nearest first.
+	void Raycast(const FVector& Start, const FVector& End, TArray<Worker_EntityId>& OutEntityIds) const;
+
+private:
+	struct FEntry
+	{
+		Worker_EntityId EntityId;
+		FVector Location;
+		float BoundsRadius;
+	};
+
+	struct FCell
+	{
+		TArray<FEntry> Entries;
+		// Bounds of the entities can reach past the cell by up to this much.
+		float MaxBoundsRadius = 0.0f;
+	};
+
+	struct FEntityState
+	{
+		FIntVector Cell;
+		// Index of the entity's entry in its cell's Entries.
+		int32 EntryIndex = INDEX_NONE;
+	};
+
+	FIntVector GetCellCoordinates(const FVector& Location) const;
+	FBox GetCellBox(const FIntVector& Coordinates, float Padding) const;
+	void RemoveFromCell(const FEntityState& State);
+
+	float CellSize;
+	TMap<FIntVector, FCell> Cells;
+	TMap<Worker_EntityId_Key, FEntityState> EntityCells;
+};
+} // namespace SpatialGDK
@@ -30,6 +30,10 @@ public:
 	DECLARE_MULTICAST_DELEGATE_OneParam(FSpatialDebuggerActorAddedDelegate, AActor*);
 	FSpatialDebuggerActorAddedDelegate OnEntityActorAddedDelegate;
 
+	// Broadcast when an entity's actor stops being tracked, because the entity left the view or the actor was destroyed.
+	DECLARE_MULTICAST_DELEGATE_OneParam(FSpatialDebuggerActorRemovedDelegate, Worker_EntityId);
+	FSpatialDebuggerActorRemovedDelegate OnEntityActorRemovedDelegate;
+
 	TOptional<SpatialDebugging> GetDebuggingData(Worker_EntityId Entity) const;
 	AActor* GetActor(Worker_EntityId EntityId) const;
 
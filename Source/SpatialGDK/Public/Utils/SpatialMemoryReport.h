@@ -0,0 +1,45 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "SpatialView/EntityView.h"
+
+class USpatialNetDriver;
+
+namespace SpatialGDK
+{
+// Memory held by the GDK's networking state, gathered on demand by walking the containers that own it.
+// Schema objects are counted by their serialized size, as the schema library does not expose its allocations.
+struct SPATIALGDK_API FSpatialMemoryReport
+{
+	struct FSubsystemMemory
+	{
+		FString Name;
+		uint64 Bytes = 0;
+	};
+
+	struct FComponentMemory
+	{
+		Worker_ComponentId ComponentId = 0;
+		uint32 Count = 0;
+		uint64 SchemaBytes = 0;
+	};
+
+	TArray<FSubsystemMemory> Subsystems;
+	// Schema data stored in the view, highest first.
+	TArray<FComponentMemory> Components;
+	int32 NumEntities = 0;
+
+	static FSpatialMemoryReport Gather(const USpatialNetDriver& NetDriver);
+
+	// Adds the view's containers and schema data as an "EntityView" subsystem, and its per-component breakdown.
+	void AddEntityView(const EntityView& View);
+	void AddSubsystem(const TCHAR* Name, uint64 Bytes);
+
+	uint64 GetTotalBytes() const;
+
+	void Dump(FOutputDevice& Ar, int32 MaxComponents) const;
+};
+} // namespace SpatialGDK
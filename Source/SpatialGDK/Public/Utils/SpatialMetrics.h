@@ -5,6 +5,10 @@
 #include "CoreMinimal.h"
 
 #include "SpatialConstants.h"
+#include "Utils/BandwidthAccounting.h"
+#include "Utils/LatencyHistogram.h"
+#include "Utils/MetricsRegistry.h"
+#include "Utils/NetworkFrameProfiler.h"
 
 #include <WorkerSDK/improbable/c_schema.h>
 #include <WorkerSDK/improbable/c_worker.h>
@@ -24,6 +28,21 @@ enum class ESpatialServerCommands : uint8
 	StopInsights,
 };
 
+// Latency histograms kept by USpatialMetrics. Values are recorded in microseconds.
+enum class ESpatialLatencyMetric : uint8
+{
+	// From an op list being taken from the connection to every system having processed the view delta it is in.
+	OpListApply,
+	// From an RPC being received to it being executed.
+	RPCReceiveToExecute,
+	// From a create entity request being sent to its successful response.
+	EntityCreationRoundTrip,
+	// From a worker changing an entity's authority intent to the intended worker gaining authority over it.
+	AuthorityHandover,
+
+	Count
+};
+
 UCLASS()
 class SPATIALGDK_API USpatialMetrics : public UObject
 {
@@ -59,6 +78,43 @@ public:
 
 	void HandleWorkerMetrics(const Worker_Op& Op);
 
+	// Histograms cover the time since the last metrics report, and are sent as p50/p90/p99/p999 gauges with each report.
+	void RecordLatency(ESpatialLatencyMetric Metric, uint64 Microseconds);
+	void RecordLatencySince(ESpatialLatencyMetric Metric, uint64 StartCycles);
+	const SpatialGDK::FLatencyHistogram& GetLatencyHistogram(ESpatialLatencyMetric Metric) const;
+
+	// Send-to-apply latency of sampled component updates, by the class of the object they were applied to.
+	// Sampling is controlled by USpatialGDKSettings::ReplicationLatencySampleRate on the sending worker.
+	void RecordReplicationLatency(const UClass* Class, uint64 Microseconds);
+	const SpatialGDK::FLatencyHistogram* GetReplicationLatencyHistogram(const UClass* Class) const;
+
+	UFUNCTION(Exec)
+	void SpatialDumpReplicationLatency();
+
+	// Per-stage timings of the net driver's dispatch and flush, over a rolling window of frames.
+	SpatialGDK::FNetworkFrameProfiler& GetFrameProfiler() { return FrameProfiler; }
+
+	UFUNCTION(Exec)
+	void SpatialDumpNetFrameProfile();
+
+	// Bandwidth accounting is activated with "SpatialStartBandwidthAccounting" and stopped with "SpatialStopBandwidthAccounting".
+	// While active, the serialized size of every component add, update and RPC payload sent or received by the actor system is
+	// attributed to its component ID, actor class and RPC. "SpatialDumpBandwidth [N]" logs the top N of each over the last few seconds.
+	UFUNCTION(Exec)
+	void SpatialStartBandwidthAccounting();
+
+	UFUNCTION(Exec)
+	void SpatialStopBandwidthAccounting();
+
+	UFUNCTION(Exec)
+	void SpatialDumpBandwidth(int32 MaxEntries);
+
+	bool IsBandwidthAccountingEnabled() const { return bBandwidthAccountingEnabled; }
+	void TrackComponentBandwidth(SpatialGDK::EBandwidthDirection Direction, Worker_ComponentId ComponentId, const UObject* Actor,
+								 uint32 Bytes);
+	void TrackRPCBandwidth(SpatialGDK::EBandwidthDirection Direction, const UFunction* Function, const UObject* Actor, uint32 Bytes);
+	const SpatialGDK::FBandwidthAccounting& GetBandwidthAccounting() const { return BandwidthAccounting; }
+
 	// The user can bind their own delegate to handle worker metrics.
 	typedef TMap<FString, double> WorkerGaugeMetric;
 	struct WorkerHistogramValues
@@ -106,6 +162,24 @@ private:
 
 	TMap<FString, UserSuppliedMetric> UserSuppliedMetrics;
 
+	void AddLatencyMetrics(SpatialGDK::SpatialMetrics& Metrics);
+
+	SpatialGDK::FLatencyHistogram LatencyHistograms[static_cast<uint8>(ESpatialLatencyMetric::Count)];
+
+	struct FReplicationLatencyHistograms
+	{
+		SpatialGDK::FLatencyHistogram SinceLastReport;
+		SpatialGDK::FLatencyHistogram Total;
+	};
+	TMap<FName, FReplicationLatencyHistograms> ReplicationLatencyByClass;
+
+	void AddFrameProfileMetrics(SpatialGDK::SpatialMetrics& Metrics) const;
+
+	SpatialGDK::FNetworkFrameProfiler FrameProfiler;
+
+	SpatialGDK::FBandwidthAccounting BandwidthAccounting;
+	bool bBandwidthAccountingEnabled = false;
+
 	// RPC tracking is activated with "SpatialStartRPCMetrics" and stopped with "SpatialStopRPCMetrics"
 	// console command. It will record every sent RPC as well as the size of its payload, and then display
 	// tracked data upon stopping. Calling these console commands on the client will also start/stop RPC
@@ -117,7 +191,26 @@ private:
 		int Calls;
 		int TotalPayload;
 	};
-	TMap<FString, RPCStat> RecentRPCs;
+	struct RPCMetricHandles
+	{
+		TWeakObjectPtr<UFunction> Function;
+		ERPCType Type;
+		SpatialGDK::FMetricHandle Calls;
+		SpatialGDK::FMetricHandle TotalPayload;
+		// Set when the registry was full, the RPC is then counted with the other untracked ones.
+		bool bUntracked = false;
+	};
+	const RPCMetricHandles& GetOrRegisterRPCMetric(UFunction* Function, ERPCType RPCType);
+	SpatialGDK::FMetricHandle RegisterRPCCounter(const UFunction& Function, const TCHAR* CounterName);
+
+	// Counters are registered the first time an RPC is sent, stat names are only built when the stats are displayed.
+	SpatialGDK::FMetricsRegistry RPCMetrics;
+	// Weak keys, so a function created where a destroyed one was doesn't take over its counters.
+	TMap<TWeakObjectPtr<const UFunction>, RPCMetricHandles> RPCMetricHandlesByFunction;
+	// Registered first, so RPCs past the registry's capacity are still reported as a total.
+	SpatialGDK::FMetricHandle UntrackedRPCCalls;
+	SpatialGDK::FMetricHandle UntrackedRPCTotalPayload;
+	int32 NumUntrackedRPCFunctions = 0;
 	bool bRPCTrackingEnabled;
 	float RPCTrackingStartTime;
 };
@@ -186,6 +186,13 @@ public:
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "SpatialOS")
 	static int64 GetMaxDynamicallyAttachedSubobjectsPerClass();
 
+	/**
+	 * Returns the flow-control state of the RPC ring buffer used to send client or server RPCs on this Actor.
+	 * Gameplay code can use it to throttle non-essential RPCs while the ring buffer is congested.
+	 */
+	UFUNCTION(BlueprintPure, Category = "SpatialOS|RPC")
+	static ERPCFlowControl GetRPCFlowControl(const AActor* Actor, bool bReliable = true);
+
 	UFUNCTION(BlueprintCallable, Category = "SpatialGDK|Spatial Debugger", meta = (WorldContext = "WorldContextObject"))
 	static void SpatialDebuggerSetOnConfigUIClosedCallback(const UObject* WorldContextObject, FOnConfigUIClosedDelegate Delegate);
 
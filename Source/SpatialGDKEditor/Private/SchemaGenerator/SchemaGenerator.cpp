@@ -9,11 +9,14 @@
 
 #include "Interop/SpatialClassInfoManager.h"
 #include "SpatialGDKEditorSchemaGenerator.h"
+#include "SpatialGDKEditorSettings.h"
 #include "SpatialGDKSettings.h"
+#include "StaticCodecGenerator.h"
 #include "Utils/CodeWriter.h"
 #include "Utils/ComponentIdGenerator.h"
 #include "Utils/DataTypeUtilities.h"
 #include "Utils/GDKPropertyMacros.h"
+#include "Utils/PropertyQuantization.h"
 #include "SpatialGDKServicesConstants.h"
 
 using namespace SpatialGDKEditor::Schema;
@@ -45,6 +48,156 @@ ESchemaComponentType PropertyGroupToSchemaComponentType(EReplicatedPropertyGroup
 	}
 }
 
+uint32 GenerateRepFieldsHashAndCodec(UClass* Class, const FUnrealFlatRepData& RepData)
+{
+	const uint32 RepFieldsHash = HashRepFields(RepData);
+
+	const USpatialGDKEditorSettings* EditorSettings = GetDefault<USpatialGDKEditorSettings>();
+	if (EditorSettings->IsGenerateStaticCodecsEnabled())
+	{
+		GenerateStaticCodec(Class, RepData, RepFieldsHash, EditorSettings->GetStaticCodecsOutputFolder());
+	}
+
+	return RepFieldsHash;
+}
+
+bool IsDeltaArray(const GDK_PROPERTY(Property) * Property)
+{
+	return Property->IsA<GDK_PROPERTY(ArrayProperty)>() && Property->HasMetaData(TEXT("SpatialArrayDelta"));
+}
+
+bool HasDeltaArrays(const TMap<uint16, TSharedPtr<FUnrealProperty>>& RepProps)
+{
+	for (const auto& RepProp : RepProps)
+	{
+		if (IsDeltaArray(RepProp.Value->Property))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+// Metadata is editor only, so the handles of arrays marked with it are stored in the schema database for the runtime.
+TArray<uint32> GetDeltaArrayHandles(const FUnrealFlatRepData& RepData)
+{
+	TArray<uint32> DeltaArrayHandles;
+	for (const auto& PropertyGroup : RepData)
+	{
+		for (const auto& RepProp : PropertyGroup.Value)
+		{
+			if (IsDeltaArray(RepProp.Value->Property))
+			{
+				DeltaArrayHandles.Add(RepProp.Value->ReplicationData->Handle);
+			}
+		}
+	}
+	DeltaArrayHandles.Sort();
+	return DeltaArrayHandles;
+}
+
+const TCHAR* const QuantizationModeKey = TEXT("SpatialQuantization");
+const TCHAR* const QuantizationBitsKey = TEXT("SpatialQuantizationBits");
+const TCHAR* const QuantizationBoundsKey = TEXT("SpatialQuantizationBounds");
+const TCHAR* const QuantizationVelocityBoundsKey = TEXT("SpatialQuantizationVelocityBounds");
+
+uint8 GetDefaultQuantizationBits(ESpatialQuantization Mode)
+{
+	switch (Mode)
+	{
+	case ESpatialQuantization::FixedPoint:
+		return 20;
+	case ESpatialQuantization::Angle:
+		return 16;
+	case ESpatialQuantization::SmallestThree:
+		return 12;
+	default:
+		return 0;
+	}
+}
+
+// Reads the quantization metadata of a property or a class.
+template <typename TMetaDataOwner>
+FQuantizedPropertySchemaData GetQuantizationMetaData(const TMetaDataOwner& Owner, uint16 Handle)
+{
+	FQuantizedPropertySchemaData Quantization;
+	Quantization.Handle = Handle;
+
+	const int64 Mode = StaticEnum<ESpatialQuantization>()->GetValueByNameString(Owner.GetMetaData(QuantizationModeKey));
+	Quantization.Mode = Mode != INDEX_NONE ? static_cast<ESpatialQuantization>(Mode) : ESpatialQuantization::None;
+
+	Quantization.Bits = Owner.HasMetaData(QuantizationBitsKey)
+							? static_cast<uint8>(FMath::Clamp(FCString::Atoi(*Owner.GetMetaData(QuantizationBitsKey)), 0, 255))
+							: GetDefaultQuantizationBits(Quantization.Mode);
+	Quantization.Bounds = Owner.HasMetaData(QuantizationBoundsKey) ? FCString::Atof(*Owner.GetMetaData(QuantizationBoundsKey)) : 0.f;
+	Quantization.VelocityBounds =
+		Owner.HasMetaData(QuantizationVelocityBoundsKey) ? FCString::Atof(*Owner.GetMetaData(QuantizationVelocityBoundsKey)) : 0.f;
+
+	return Quantization;
+}
+
+bool IsQuantizationSupported(const UScriptStruct* Struct, const FQuantizedPropertySchemaData& Quantization)
+{
+	SpatialGDK::FPropertyQuantization RuntimeQuantization;
+	RuntimeQuantization.Mode = Quantization.Mode;
+	RuntimeQuantization.Bits = Quantization.Bits;
+	RuntimeQuantization.Bounds = Quantization.Bounds;
+	RuntimeQuantization.VelocityBounds = Quantization.VelocityBounds;
+	return SpatialGDK::PropertyQuantization::IsSupported(Struct, RuntimeQuantization);
+}
+
+// Quantization set on a property takes precedence over the class's, which applies to every struct property its mode supports.
+TArray<FQuantizedPropertySchemaData> GetQuantizedProperties(UClass* Class, const FUnrealFlatRepData& RepData)
+{
+	const UClass* QuantizedClass = Class;
+	while (QuantizedClass != nullptr && !QuantizedClass->HasMetaData(QuantizationModeKey))
+	{
+		QuantizedClass = QuantizedClass->GetSuperClass();
+	}
+
+	TArray<FQuantizedPropertySchemaData> QuantizedProperties;
+	for (const auto& PropertyGroup : RepData)
+	{
+		for (const auto& RepProp : PropertyGroup.Value)
+		{
+			GDK_PROPERTY(StructProperty)* StructProperty = GDK_CASTFIELD<GDK_PROPERTY(StructProperty)>(RepProp.Value->Property);
+			if (StructProperty == nullptr)
+			{
+				continue;
+			}
+
+			const uint16 Handle = RepProp.Value->ReplicationData->Handle;
+			if (StructProperty->HasMetaData(QuantizationModeKey))
+			{
+				const FQuantizedPropertySchemaData Quantization = GetQuantizationMetaData(*StructProperty, Handle);
+				if (!IsQuantizationSupported(StructProperty->Struct, Quantization))
+				{
+					UE_LOG(LogSchemaGenerator, Warning,
+						   TEXT("%s::%s has unsupported quantization metadata, it will be replicated at full precision. FixedPoint "
+								"needs an FVector or FRepMovement and positive SpatialQuantizationBounds, Angle an FRotator, SmallestThree "
+								"an FQuat, and SpatialQuantizationBits has to be between 1 (2 for FixedPoint and SmallestThree) and %d."),
+						   *Class->GetName(), *StructProperty->GetName(), SpatialGDK::PropertyQuantization::MaxBits);
+					continue;
+				}
+				QuantizedProperties.Add(Quantization);
+			}
+			else if (QuantizedClass != nullptr)
+			{
+				const FQuantizedPropertySchemaData Quantization = GetQuantizationMetaData(*QuantizedClass, Handle);
+				if (IsQuantizationSupported(StructProperty->Struct, Quantization))
+				{
+					QuantizedProperties.Add(Quantization);
+				}
+			}
+		}
+	}
+
+	QuantizedProperties.Sort([](const FQuantizedPropertySchemaData& A, const FQuantizedPropertySchemaData& B) {
+		return A.Handle < B.Handle;
+	});
+	return QuantizedProperties;
+}
+
 // Given a RepLayout cmd type (a data type supported by the replication system). Generates the corresponding
 // type used in schema.
 FString PropertyToSchemaType(GDK_PROPERTY(Property) * Property,bool bPreFix = true)
@@ -134,6 +287,21 @@ void WriteSchemaRepField(FCodeWriter& Writer, const TSharedPtr<FUnrealProperty>
 	Writer.Printf(" {0} {1} = {2};", *PropertyToSchemaType(RepProp->Property), *SchemaFieldName(RepProp), FieldCounter);
 }
 
+// Updates to components with arrays sent as element deltas carry an ArrayDelta for each of those arrays in a reserved field.
+void WriteSchemaArrayDeltaField(FCodeWriter& Writer, const TMap<uint16, TSharedPtr<FUnrealProperty>>& RepProps)
+{
+	if (HasDeltaArrays(RepProps))
+	{
+		Writer.Printf(" repeated ArrayDelta array_delta = {0};", SpatialConstants::ARRAY_DELTA_ID);
+	}
+}
+
+// Sampled updates to any generated component carry a ReplicationLatencyStamp in a reserved field.
+void WriteSchemaReplicationLatencyStampField(FCodeWriter& Writer)
+{
+	Writer.Printf("optional ReplicationLatencyStamp replication_latency_stamp = {0};", SpatialConstants::REPLICATION_LATENCY_STAMP_ID);
+}
+
 // Generates schema for a statically attached subobject on an Actor.
 FActorSpecificSubobjectSchemaData GenerateSchemaForStaticallyAttachedSubobject(FCodeWriter& Writer, FComponentIdGenerator& IdGenerator,
 																			   FString PropertyName, TSharedPtr<FUnrealType>& TypeInfo,
@@ -173,6 +341,7 @@ FActorSpecificSubobjectSchemaData GenerateSchemaForStaticallyAttachedSubobject(F
 		//Writer.Printf("id = {0};", ComponentId);
 		Writer.Printf("optional uint32 msg_cid = 1[default = {0}];", ComponentId);
 		Writer.Printf("optional unreal.generated.{0} data = 2;", *SchemaReplicatedDataName(Group, ComponentClass));
+		WriteSchemaReplicationLatencyStampField(Writer);
 		Writer.Outdent().Print("}");
 
 		AddComponentId(ComponentId, SubobjectData.SchemaComponents, PropertyGroupToSchemaComponentType(Group));
@@ -355,35 +524,11 @@ void GenerateSubobjectSchema(FComponentIdGenerator& IdGenerator, UClass* Class,
 		// Note that this file has been generated automatically
 		package unreal.generated;)""");
 	Writer.PrintNewLine();
-	bool bShouldIncludeCoreTypes = false;
+	// Always included since the dynamic subobject components carry a ReplicationLatencyStamp
+	Writer.PrintNewLine();
+	Writer.Printf("import \"unreal/gdk/core_types.proto\";");
 
-	// Only include core types if the subobject has replicated references to other UObjects
 	FUnrealFlatRepData RepData = GetFlatRepData(TypeInfo);
-	for (auto& PropertyGroup : RepData)
-	{
-		for (auto& PropertyPair : PropertyGroup.Value)
-		{
-			GDK_PROPERTY(Property)* Property = PropertyPair.Value->Property;
-			if (Property->IsA<GDK_PROPERTY(ObjectPropertyBase)>())
-			{
-				bShouldIncludeCoreTypes = true;
-			}
-
-			if (Property->IsA<GDK_PROPERTY(ArrayProperty)>())
-			{
-				if (GDK_CASTFIELD<GDK_PROPERTY(ArrayProperty)>(Property)->Inner->IsA<GDK_PROPERTY(ObjectPropertyBase)>())
-				{
-					bShouldIncludeCoreTypes = true;
-				}
-			}
-		}
-	}
-
-	if (bShouldIncludeCoreTypes)
-	{
-		Writer.PrintNewLine();
-		Writer.Printf("import \"unreal/gdk/core_types.proto\";");
-	}
 
 	for (EReplicatedPropertyGroup Group : GetAllReplicatedPropertyGroups())
 	{
@@ -418,6 +563,7 @@ void GenerateSubobjectSchema(FComponentIdGenerator& IdGenerator, UClass* Class,
 		{
 			WriteSchemaRepField(Writer, RepProp.Value, RepProp.Value->ReplicationData->Handle);
 		}
+		WriteSchemaArrayDeltaField(Writer, RepData[Group]);
 
 		Writer.Outdent().Print("}");
 	}
@@ -427,6 +573,9 @@ void GenerateSubobjectSchema(FComponentIdGenerator& IdGenerator, UClass* Class,
 	const uint32 DynamicComponentsPerClass = GetDefault<USpatialGDKSettings>()->MaxDynamicallyAttachedSubobjectsPerClass;
 
 	FSubobjectSchemaData SubobjectSchemaData;
+	SubobjectSchemaData.RepFieldsHash = GenerateRepFieldsHashAndCodec(Class, RepData);
+	SubobjectSchemaData.DeltaArrayHandles = GetDeltaArrayHandles(RepData);
+	SubobjectSchemaData.QuantizedProperties = GetQuantizedProperties(Class, RepData);
 
 	// Use previously generated component IDs when possible.
 	const FSubobjectSchemaData* const ExistingSchemaData = SubobjectClassPathToSchema.Find(Class->GetPathName());
@@ -473,6 +622,7 @@ void GenerateSubobjectSchema(FComponentIdGenerator& IdGenerator, UClass* Class,
 			//Writer.Printf("id = {0};", ComponentId);
 			Writer.Printf("optional uint32 msg_cid = 1[default = {0}];", ComponentId);
 			Writer.Printf("optional {0} data = 2;", *SchemaReplicatedDataName(Group, Class));
+			WriteSchemaReplicationLatencyStampField(Writer);
 			Writer.Outdent().Print("}");
 
 			AddComponentId(ComponentId, DynamicSubobjectComponents.SchemaComponents, PropertyGroupToSchemaComponentType(Group));
@@ -536,6 +686,9 @@ void GenerateActorSchema(FComponentIdGenerator& IdGenerator, UClass* Class, TSha
 	ActorSchemaData.GeneratedSchemaName = ClassPathToSchemaName[Class->GetPathName()];
 
 	FUnrealFlatRepData RepData = GetFlatRepData(TypeInfo);
+	ActorSchemaData.RepFieldsHash = GenerateRepFieldsHashAndCodec(Class, RepData);
+	ActorSchemaData.DeltaArrayHandles = GetDeltaArrayHandles(RepData);
+	ActorSchemaData.QuantizedProperties = GetQuantizedProperties(Class, RepData);
 
 	// Client-server replicated properties.
 	for (EReplicatedPropertyGroup Group : GetAllReplicatedPropertyGroups())
@@ -613,6 +766,8 @@ void GenerateActorSchema(FComponentIdGenerator& IdGenerator, UClass* Class, TSha
 
 			WriteSchemaRepField(Writer, RepProp.Value, RepProp.Value->ReplicationData->Handle + 1);
 		}
+		WriteSchemaArrayDeltaField(Writer, RepData[Group]);
+		WriteSchemaReplicationLatencyStampField(Writer);
 
 		Writer.Outdent().Print("}");
 	}
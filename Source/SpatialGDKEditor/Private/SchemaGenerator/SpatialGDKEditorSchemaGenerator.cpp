@@ -18,6 +18,7 @@
 #include "Misc/FileHelper.h"
 #include "Misc/MessageDialog.h"
 #include "Misc/MonitoredProcess.h"
+#include "Misc/PackageName.h"
 #include "Runtime/Launch/Resources/Version.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
@@ -34,6 +35,7 @@
 #include "SpatialGDKServicesConstants.h"
 #include "SpatialGDKServicesModule.h"
 #include "SpatialGDKSettings.h"
+#include "StaticCodecGenerator.h"
 #include "TypeStructure.h"
 #include "UObject/StrongObjectPtr.h"
 #include "Utils/CodeWriter.h"
@@ -94,6 +96,9 @@ TMap<FString, TSet<FString>> PotentialSchemaNameCollisions;
 // QBI
 TMap<float, Worker_ComponentId> NetCullDistanceToComponentId;
 
+// Object reference paths, only ever appended to so their IDs stay the same across generations.
+TArray<FString> InternedObjectPaths;
+
 namespace
 {
 const FString& GetRelativeSchemaDatabaseFilePath()
@@ -519,6 +524,55 @@ TMap<Worker_ComponentId, FString> CreateComponentIdToClassPathMap()
 	return ComponentIdToClassPath;
 }
 
+// Object references name each object in their outer chain separately, so packages and object names are interned on their own.
+// New paths are appended after the ones from earlier generations, which may be in persisted component data and snapshots.
+void AppendInternedObjectPaths()
+{
+	TSet<FString> Paths;
+
+	const auto AddObjectPath = [&Paths](const FString& ObjectPath) {
+		FString PackageName;
+		FString ObjectName;
+		if (ObjectPath.Split(TEXT("."), &PackageName, &ObjectName))
+		{
+			Paths.Add(PackageName);
+			Paths.Add(ObjectName);
+		}
+	};
+
+	for (const auto& ActorSchemaData : ActorClassPathToSchema)
+	{
+		AddObjectPath(ActorSchemaData.Key);
+
+		for (const auto& SubobjectSchemaData : ActorSchemaData.Value.SubobjectData)
+		{
+			AddObjectPath(SubobjectSchemaData.Value.ClassPath);
+			Paths.Add(SubobjectSchemaData.Value.Name.ToString());
+		}
+	}
+
+	for (const auto& SubobjectSchemaData : SubobjectClassPathToSchema)
+	{
+		AddObjectPath(SubobjectSchemaData.Key);
+	}
+
+	for (const auto& LevelPath : LevelPathToComponentId)
+	{
+		Paths.Add(LevelPath.Key);
+		Paths.Add(FPackageName::GetShortName(LevelPath.Key));
+	}
+	Paths.Add(TEXT("PersistentLevel"));
+
+	for (const FString& ExistingPath : InternedObjectPaths)
+	{
+		Paths.Remove(ExistingPath);
+	}
+
+	TArray<FString> NewPaths = Paths.Array();
+	NewPaths.Sort();
+	InternedObjectPaths.Append(NewPaths);
+}
+
 FString GetComponentSetNameBySchemaType(ESchemaComponentType SchemaType)
 {
 	static_assert(SCHEMA_Count == 4, "Unexpected number of Schema type components, please check the enclosing function is still correct.");
@@ -917,6 +971,8 @@ USchemaDatabase* InitialiseSchemaDatabase(const FString& PackagePath)
 	SchemaDatabase->LevelPathToComponentId = LevelPathToComponentId;
 	SchemaDatabase->NetCullDistanceToComponentId = NetCullDistanceToComponentId;
 	SchemaDatabase->ComponentIdToClassPath = CreateComponentIdToClassPathMap();
+	AppendInternedObjectPaths();
+	SchemaDatabase->InternedObjectPaths = InternedObjectPaths;
 
 	SchemaDatabase->NetCullDistanceComponentIds.Reset();
 	TArray<Worker_ComponentId> NetCullDistanceComponentIds;
@@ -1165,6 +1221,7 @@ void ResetSchemaGeneratorState()
 	NextAvailableComponentId = SpatialConstants::STARTING_GENERATED_COMPONENT_ID;
 	SchemaGeneratedClasses.Empty();
 	NetCullDistanceToComponentId.Empty();
+	InternedObjectPaths.Empty();
 	// 清空json内容
 	FString BuildDir;
 	if (BuildDir == TEXT(""))
@@ -1181,6 +1238,7 @@ void ResetSchemaGeneratorStateAndCleanupFolders()
 {
 	ResetSchemaGeneratorState();
 	RefreshSchemaFiles(GetDefault<USpatialGDKEditorSettings>()->GetGeneratedSchemaOutputFolder());
+	DeleteStaticCodecs(GetDefault<USpatialGDKEditorSettings>()->GetStaticCodecsOutputFolder());
 }
 
 bool LoadGeneratorStateFromSchemaDatabase(const FString& FileName)
@@ -1216,6 +1274,7 @@ bool LoadGeneratorStateFromSchemaDatabase(const FString& FileName)
 		LevelPathToComponentId = SchemaDatabase->LevelPathToComponentId;
 		NextAvailableComponentId = SchemaDatabase->NextAvailableComponentId;
 		NetCullDistanceToComponentId = SchemaDatabase->NetCullDistanceToComponentId;
+		InternedObjectPaths = SchemaDatabase->InternedObjectPaths;
 
 		// Component Id generation was updated to be non-destructive, if we detect an old schema database, delete it.
 		if (ActorClassPathToSchema.Num() > 0 && NextAvailableComponentId == SpatialConstants::STARTING_GENERATED_COMPONENT_ID)
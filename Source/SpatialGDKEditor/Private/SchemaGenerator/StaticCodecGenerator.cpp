@@ -0,0 +1,166 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "StaticCodecGenerator.h"
+
+#include "HAL/FileManager.h"
+#include "Misc/Crc.h"
+
+#include "SchemaGenerator.h"
+#include "Utils/CodeWriter.h"
+#include "Utils/DataTypeUtilities.h"
+#include "Utils/GDKPropertyMacros.h"
+
+namespace
+{
+const TCHAR* const StaticCodecFileSuffix = TEXT(".SpatialCodec.cpp");
+
+// The C++ type a generated codec reads and writes the property as, or nullptr if it has to go through reflection.
+const TCHAR* GetStaticCodecValueType(GDK_PROPERTY(Property) * Property)
+{
+	if (Property->ArrayDim != 1)
+	{
+		return nullptr;
+	}
+
+	if (GDK_PROPERTY(BoolProperty)* BoolProperty = GDK_CASTFIELD<GDK_PROPERTY(BoolProperty)>(Property))
+	{
+		// Bitfield bools share their byte with other properties.
+		return BoolProperty->IsNativeBool() ? TEXT("bool") : nullptr;
+	}
+	if (Property->IsA<GDK_PROPERTY(ByteProperty)>())
+	{
+		return TEXT("uint8");
+	}
+	if (Property->IsA<GDK_PROPERTY(FloatProperty)>())
+	{
+		return TEXT("float");
+	}
+	if (Property->IsA<GDK_PROPERTY(DoubleProperty)>())
+	{
+		return TEXT("double");
+	}
+	if (Property->IsA<GDK_PROPERTY(Int8Property)>())
+	{
+		return TEXT("int8");
+	}
+	if (Property->IsA<GDK_PROPERTY(Int16Property)>())
+	{
+		return TEXT("int16");
+	}
+	if (Property->IsA<GDK_PROPERTY(IntProperty)>())
+	{
+		return TEXT("int32");
+	}
+	if (Property->IsA<GDK_PROPERTY(Int64Property)>())
+	{
+		return TEXT("int64");
+	}
+	if (Property->IsA<GDK_PROPERTY(UInt16Property)>())
+	{
+		return TEXT("uint16");
+	}
+	if (Property->IsA<GDK_PROPERTY(UInt32Property)>())
+	{
+		return TEXT("uint32");
+	}
+	if (Property->IsA<GDK_PROPERTY(UInt64Property)>())
+	{
+		return TEXT("uint64");
+	}
+	return nullptr;
+}
+
+// Handles are unique across property groups, sorting by them keeps the hash and the generated code stable between generations.
+TArray<TSharedPtr<FUnrealProperty>> GetSortedRepProperties(const FUnrealFlatRepData& RepData)
+{
+	TArray<TSharedPtr<FUnrealProperty>> RepProperties;
+	for (const auto& PropertyGroup : RepData)
+	{
+		for (const auto& RepProp : PropertyGroup.Value)
+		{
+			RepProperties.Add(RepProp.Value);
+		}
+	}
+
+	RepProperties.Sort([](const TSharedPtr<FUnrealProperty>& A, const TSharedPtr<FUnrealProperty>& B) {
+		return A->ReplicationData->Handle < B->ReplicationData->Handle;
+	});
+	return RepProperties;
+}
+} // anonymous namespace
+
+uint32 HashRepFields(const FUnrealFlatRepData& RepData)
+{
+	uint32 Hash = 0;
+	for (const TSharedPtr<FUnrealProperty>& RepProp : GetSortedRepProperties(RepData))
+	{
+		const FString FieldString = FString::Printf(TEXT("%u:%s:%s;"), RepProp->ReplicationData->Handle,
+													*RepProp->Property->GetClass()->GetName(), *RepProp->Property->GetName());
+		Hash = FCrc::StrCrc32(*FieldString, Hash);
+	}
+
+	return Hash != 0 ? Hash : 1;
+}
+
+void GenerateStaticCodec(UClass* Class, const FUnrealFlatRepData& RepData, uint32 RepFieldsHash, const FString& OutputFolder)
+{
+	TArray<TSharedPtr<FUnrealProperty>> CodecProperties = GetSortedRepProperties(RepData);
+	CodecProperties.RemoveAll([](const TSharedPtr<FUnrealProperty>& RepProp) {
+		return GetStaticCodecValueType(RepProp->Property) == nullptr;
+	});
+
+	if (CodecProperties.Num() == 0)
+	{
+		return;
+	}
+
+	const FString& SchemaName = ClassPathToSchemaName[Class->GetPathName()];
+
+	FCodeWriter Writer;
+	Writer.Print(TEXT("// Note that this file has been generated automatically"));
+	Writer.PrintNewLine();
+	Writer.Print(TEXT("#include \"Utils/GeneratedComponentCodec.h\""));
+	Writer.PrintNewLine();
+	Writer.Print(TEXT("namespace"));
+	Writer.BeginScope();
+
+	Writer.Print(FString::Printf(TEXT("const SpatialGDK::FGeneratedFieldCodec %s_CodecFields[] ="), *SchemaName));
+	Writer.BeginScope();
+	for (const TSharedPtr<FUnrealProperty>& RepProp : CodecProperties)
+	{
+		const TCHAR* ValueType = GetStaticCodecValueType(RepProp->Property);
+		Writer.Print(FString::Printf(TEXT("{ %u, TEXT(\"%s\"), sizeof(%s), &SpatialGDK::GeneratedCodecs::Encode<%s>, "
+										  "&SpatialGDK::GeneratedCodecs::Decode<%s> },"),
+									 RepProp->ReplicationData->Handle, *RepProp->Property->GetName(), ValueType, ValueType, ValueType));
+	}
+	Writer.RemoveTrailingComma();
+	Writer.Outdent();
+	Writer.Print(TEXT("};"));
+	Writer.PrintNewLine();
+
+	Writer.Print(FString::Printf(TEXT("const SpatialGDK::FGeneratedClassCodec %s_Codec = { TEXT(\"%s\"), %uu, MakeArrayView(%s_CodecFields) };"),
+								 *SchemaName, *Class->GetPathName(), RepFieldsHash, *SchemaName));
+	Writer.Print(FString::Printf(TEXT("const SpatialGDK::FGeneratedCodecRegistrar %s_CodecRegistrar(%s_Codec);"), *SchemaName, *SchemaName));
+
+	Writer.Outdent();
+	Writer.Print(TEXT("} // anonymous namespace"));
+
+	Writer.WriteToFile(FPaths::Combine(OutputFolder, SchemaName + StaticCodecFileSuffix));
+}
+
+bool DeleteStaticCodecs(const FString& OutputFolder)
+{
+	TArray<FString> CodecFiles;
+	IFileManager::Get().FindFiles(CodecFiles, *FPaths::Combine(OutputFolder, FString(TEXT("*")) + StaticCodecFileSuffix), true, false);
+
+	bool bSuccess = true;
+	for (const FString& CodecFile : CodecFiles)
+	{
+		if (!IFileManager::Get().Delete(*FPaths::Combine(OutputFolder, CodecFile)))
+		{
+			UE_LOG(LogSchemaGenerator, Error, TEXT("Could not delete static codec '%s'."), *CodecFile);
+			bSuccess = false;
+		}
+	}
+	return bSuccess;
+}
@@ -0,0 +1,16 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "TypeStructure.h"
+
+// Hash of the replicated fields a class's schema is generated from, stored in the schema database and baked into its static codec.
+// Never 0, which the schema database uses for classes generated before hashes were stored.
+uint32 HashRepFields(const FUnrealFlatRepData& RepData);
+
+// Writes a .cpp into OutputFolder with encode and decode functions for the scalar replicated properties of Class, which registers
+// them with SpatialGDK::FGeneratedCodecRegistry when the module it is compiled into is loaded. Other properties are left to reflection.
+void GenerateStaticCodec(UClass* Class, const FUnrealFlatRepData& RepData, uint32 RepFieldsHash, const FString& OutputFolder);
+
+// Removes the codecs written by earlier generations, so codecs of classes that are gone aren't compiled in anymore.
+bool DeleteStaticCodecs(const FString& OutputFolder);
@@ -5,6 +5,7 @@
 #include "ISettingsModule.h"
 #include "Interfaces/ITargetPlatformManagerModule.h"
 #include "Internationalization/Regex.h"
+#include "Misc/App.h"
 #include "Misc/FileHelper.h"
 #include "Misc/MessageDialog.h"
 #include "Modules/ModuleManager.h"
@@ -52,6 +53,7 @@ USpatialGDKEditorSettings::USpatialGDKEditorSettings(const FObjectInitializer& O
 	, bStopPIEOnTestingCompleted(true)
 	, CookAndGeneratePlatform("")
 	, CookAndGenerateAdditionalArguments("-cookall -unversioned")
+	, bGenerateStaticCodecs(false)
 	, PrimaryDeploymentRegionCode(ERegionCode::US)
 	, bIsAutoGenerateCloudConfigEnabled(true)
 	, SimulatedPlayerLaunchConfigPath(FSpatialGDKServicesModule::GetSpatialGDKPluginDirectory(TEXT(
@@ -528,6 +530,16 @@ void USpatialGDKEditorSettings::SetSpatialOSNetFlowType(ESpatialOSNetFlow::Type
 	SaveConfig();
 }
 
+FString USpatialGDKEditorSettings::GetStaticCodecsOutputFolder() const
+{
+	if (!StaticCodecsOutputFolder.Path.IsEmpty())
+	{
+		return FPaths::ConvertRelativePathToFull(FPaths::ProjectDir(), StaticCodecsOutputFolder.Path);
+	}
+
+	return FPaths::Combine(FPaths::GameSourceDir(), FApp::GetProjectName(), TEXT("SpatialGeneratedCodecs"));
+}
+
 FString USpatialGDKEditorSettings::GetCookAndGenerateSchemaTargetPlatform() const
 {
 	if (!CookAndGeneratePlatform.IsEmpty())
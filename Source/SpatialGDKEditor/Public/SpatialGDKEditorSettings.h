@@ -369,6 +369,16 @@ private:
 			  meta = (Tooltip = "Additional arguments passed to Cook And Generate Schema"))
 	FString CookAndGenerateAdditionalArguments;
 
+	/** Generate C++ encode and decode functions for the replicated properties of each class along with schema. They have to be
+	 * compiled into a game module, properties of classes without an up to date codec are replicated through reflection. */
+	UPROPERTY(EditAnywhere, config, Category = "Schema Generation", meta = (DisplayName = "Generate static codecs"))
+	bool bGenerateStaticCodecs;
+
+	/** Folder the static codecs are written to. Defaults to SpatialGeneratedCodecs in the project's primary game module. */
+	UPROPERTY(EditAnywhere, config, Category = "Schema Generation",
+			  meta = (EditCondition = "bGenerateStaticCodecs", DisplayName = "Static codecs output folder"))
+	FDirectoryPath StaticCodecsOutputFolder;
+
 	/** Add flags to the local runtime deployment; they alter the deployment’s behavior. Select the trash icon to remove all the
 	 * flags.*/
 	UPROPERTY(EditAnywhere, config, Category = "Launch", meta = (DisplayName = "Command line flags for local runtime"))
@@ -541,6 +551,9 @@ public:
 
 	FORCEINLINE FString GetCookAndGenerateSchemaAdditionalArgs() const { return CookAndGenerateAdditionalArguments; }
 
+	FORCEINLINE bool IsGenerateStaticCodecsEnabled() const { return bGenerateStaticCodecs; }
+	FString GetStaticCodecsOutputFolder() const;
+
 	FORCEINLINE FString GetSpatialOSSnapshotToLoadPath() const
 	{
 		return FPaths::Combine(SpatialGDKServicesConstants::SpatialOSSnapshotFolderPath, GetSpatialOSSnapshotToLoad());
@@ -0,0 +1,261 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "AnalyzeEventTracesCommandlet.h"
+#include "SpatialGDKEditorCommandletPrivate.h"
+
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonWriter.h"
+
+using namespace SpatialGDK;
+
+namespace
+{
+const FString TracePathsParamName = TEXT("TracePaths");
+const FString OutputPathParamName = TEXT("OutputPath");
+const FString TopSlowChainsParamName = TEXT("TopSlowChains");
+constexpr int32 DefaultTopSlowChains = 20;
+
+void AppendLatencyCsvRows(FString& Csv, const TArray<FSpatialEventTraceAnalyzer::FLatencyStats>& AllStats)
+{
+	Csv += TEXT("name,count,p50_us,p90_us,p99_us,max_us\n");
+	for (const FSpatialEventTraceAnalyzer::FLatencyStats& Stats : AllStats)
+	{
+		Csv += FString::Printf(TEXT("\"%s\",%d,%.1f,%.1f,%.1f,%.1f\n"), *Stats.Name, Stats.Count, Stats.P50Microseconds,
+							   Stats.P90Microseconds, Stats.P99Microseconds, Stats.MaxMicroseconds);
+	}
+}
+
+void WriteLatencyJsonArray(TSharedRef<TJsonWriter<>> Writer, const TCHAR* Identifier,
+						   const TArray<FSpatialEventTraceAnalyzer::FLatencyStats>& AllStats)
+{
+	Writer->WriteArrayStart(Identifier);
+	for (const FSpatialEventTraceAnalyzer::FLatencyStats& Stats : AllStats)
+	{
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("name"), Stats.Name);
+		Writer->WriteValue(TEXT("count"), Stats.Count);
+		Writer->WriteValue(TEXT("p50_us"), Stats.P50Microseconds);
+		Writer->WriteValue(TEXT("p90_us"), Stats.P90Microseconds);
+		Writer->WriteValue(TEXT("p99_us"), Stats.P99Microseconds);
+		Writer->WriteValue(TEXT("max_us"), Stats.MaxMicroseconds);
+		Writer->WriteObjectEnd();
+	}
+	Writer->WriteArrayEnd();
+}
+
+bool SaveOutputFile(const FString& Contents, const FString& OutputPath, const TCHAR* FileName)
+{
+	const FString FilePath = FPaths::Combine(OutputPath, FileName);
+	if (!FFileHelper::SaveStringToFile(Contents, *FilePath))
+	{
+		UE_LOG(LogSpatialGDKEditorCommandlet, Error, TEXT("Failed to write %s"), *FilePath);
+		return false;
+	}
+
+	UE_LOG(LogSpatialGDKEditorCommandlet, Display, TEXT("Wrote %s"), *FilePath);
+	return true;
+}
+} // anonymous namespace
+
+UAnalyzeEventTracesCommandlet::UAnalyzeEventTracesCommandlet()
+{
+	IsClient = false;
+	IsEditor = false;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UAnalyzeEventTracesCommandlet::Main(const FString& Args)
+{
+	UE_LOG(LogSpatialGDKEditorCommandlet, Display, TEXT("Event trace analysis commandlet started"));
+
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> Params;
+	ParseCommandLine(*Args, Tokens, Switches, Params);
+
+	const FString* TracePaths = Params.Find(TracePathsParamName);
+	if (TracePaths == nullptr)
+	{
+		UE_LOG(LogSpatialGDKEditorCommandlet, Error, TEXT("%s argument is required."), *TracePathsParamName);
+		return 1;
+	}
+
+	const FString* OutputPathParam = Params.Find(OutputPathParamName);
+	const FString OutputPath = OutputPathParam != nullptr ? *OutputPathParam
+														  : FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("EventTraceAnalysis"));
+
+	const FString* TopSlowChainsParam = Params.Find(TopSlowChainsParamName);
+	const int32 TopSlowChains = TopSlowChainsParam != nullptr ? FCString::Atoi(**TopSlowChainsParam) : DefaultTopSlowChains;
+
+	const TArray<FString> TraceFiles = FindTraceFiles(*TracePaths);
+	if (TraceFiles.Num() == 0)
+	{
+		UE_LOG(LogSpatialGDKEditorCommandlet, Error, TEXT("No event trace files found in %s"), **TracePaths);
+		return 1;
+	}
+
+	TArray<FSpatialEventTraceAnalyzer::FTraceFile> Files;
+	for (const FString& TraceFile : TraceFiles)
+	{
+		const FName Worker(*FPaths::GetCleanFilename(FPaths::GetPath(TraceFile)));
+		Files.Add({ TraceFile, Worker });
+	}
+
+	FSpatialEventTraceAnalyzer Analyzer(FSpatialEventTraceAnalyzer::GetDefaultChainDefinitions(), TopSlowChains);
+	const TArray<FString> UnreadFiles = Analyzer.AddFiles(Files);
+	for (const FString& UnreadFile : UnreadFiles)
+	{
+		UE_LOG(LogSpatialGDKEditorCommandlet, Warning, TEXT("Skipped %s, it is not an event trace file."), *UnreadFile);
+	}
+	UE_LOG(LogSpatialGDKEditorCommandlet, Display, TEXT("Read %d files, %d spans still held"), Files.Num() - UnreadFiles.Num(),
+		   Analyzer.GetNumSpans());
+
+	const FSpatialEventTraceAnalyzer::FResults Results = Analyzer.Analyze(TopSlowChains);
+	for (const FSpatialEventTraceAnalyzer::FLatencyStats& Stats : Results.ChainLatencies)
+	{
+		UE_LOG(LogSpatialGDKEditorCommandlet, Display, TEXT("%s: %d chains, p50 %.1fus, p99 %.1fus, max %.1fus"), *Stats.Name, Stats.Count,
+			   Stats.P50Microseconds, Stats.P99Microseconds, Stats.MaxMicroseconds);
+	}
+	if (Results.NumIncompleteChains > 0)
+	{
+		UE_LOG(LogSpatialGDKEditorCommandlet, Display, TEXT("%d chains were incomplete and have been left out."), Results.NumIncompleteChains);
+	}
+
+	IFileManager::Get().MakeDirectory(*OutputPath, /* Tree */ true);
+	if (!WriteCsvFiles(Results, OutputPath) || !WriteJsonFile(Results, OutputPath))
+	{
+		return 1;
+	}
+
+	UE_LOG(LogSpatialGDKEditorCommandlet, Display, TEXT("Event trace analysis commandlet complete"));
+	return 0;
+}
+
+TArray<FString> UAnalyzeEventTracesCommandlet::FindTraceFiles(const FString& TracePaths)
+{
+	TArray<FString> Paths;
+	TracePaths.ParseIntoArray(Paths, TEXT(";"));
+
+	TArray<FString> TraceFiles;
+	for (const FString& Path : Paths)
+	{
+		if (IFileManager::Get().DirectoryExists(*Path))
+		{
+			TArray<FString> FolderFiles;
+			const FString Wildcard = FString::Printf(TEXT("*%s"), SpatialEventTraceFormat::FileExtension);
+			IFileManager::Get().FindFilesRecursive(FolderFiles, *Path, *Wildcard, /* Files */ true, /* Directories */ false);
+			FolderFiles.Sort();
+			TraceFiles.Append(FolderFiles);
+		}
+		else if (IFileManager::Get().FileExists(*Path))
+		{
+			TraceFiles.Add(Path);
+		}
+		else
+		{
+			UE_LOG(LogSpatialGDKEditorCommandlet, Warning, TEXT("%s does not exist."), *Path);
+		}
+	}
+	return TraceFiles;
+}
+
+bool UAnalyzeEventTracesCommandlet::WriteCsvFiles(const FSpatialEventTraceAnalyzer::FResults& Results, const FString& OutputPath)
+{
+	FString ChainLatencyCsv;
+	AppendLatencyCsvRows(ChainLatencyCsv, Results.ChainLatencies);
+
+	FString HopLatencyCsv;
+	AppendLatencyCsvRows(HopLatencyCsv, Results.HopLatencies);
+
+	FString ThroughputCsv = TEXT("worker,event_type,count,duration_s,events_per_s\n");
+	for (const FSpatialEventTraceAnalyzer::FWorkerThroughput& Worker : Results.Workers)
+	{
+		ThroughputCsv += FString::Printf(TEXT("\"%s\",\"*\",%llu,%.3f,%.1f\n"), *Worker.Worker.ToString(), Worker.NumEvents,
+										 Worker.DurationSeconds, Worker.EventsPerSecond);
+		for (const auto& Pair : Worker.EventCounts)
+		{
+			const double EventsPerSecond = Worker.DurationSeconds > 0.0 ? Pair.Value / Worker.DurationSeconds : 0.0;
+			ThroughputCsv += FString::Printf(TEXT("\"%s\",\"%s\",%llu,%.3f,%.1f\n"), *Worker.Worker.ToString(), *Pair.Key.ToString(),
+											 Pair.Value, Worker.DurationSeconds, EventsPerSecond);
+		}
+	}
+
+	FString SlowChainsCsv = TEXT("rank,chain,latency_us,step,worker,event_type,timestamp_utc\n");
+	for (int32 ChainIndex = 0; ChainIndex < Results.SlowestChains.Num(); ++ChainIndex)
+	{
+		const FSpatialEventTraceAnalyzer::FChain& Chain = Results.SlowestChains[ChainIndex];
+		for (int32 StepIndex = 0; StepIndex < Chain.Steps.Num(); ++StepIndex)
+		{
+			const FSpatialEventTraceAnalyzer::FChainStep& Step = Chain.Steps[StepIndex];
+			SlowChainsCsv += FString::Printf(TEXT("%d,\"%s\",%.1f,%d,\"%s\",\"%s\",%s\n"), ChainIndex + 1, *Chain.ChainName.ToString(),
+											 Chain.LatencyMicroseconds, StepIndex, *Step.Worker.ToString(), *Step.EventType.ToString(),
+											 *Step.Timestamp.ToIso8601());
+		}
+	}
+
+	return SaveOutputFile(ChainLatencyCsv, OutputPath, TEXT("chain_latency.csv"))
+		   && SaveOutputFile(HopLatencyCsv, OutputPath, TEXT("hop_latency.csv"))
+		   && SaveOutputFile(ThroughputCsv, OutputPath, TEXT("worker_throughput.csv"))
+		   && SaveOutputFile(SlowChainsCsv, OutputPath, TEXT("slow_chains.csv"));
+}
+
+bool UAnalyzeEventTracesCommandlet::WriteJsonFile(const FSpatialEventTraceAnalyzer::FResults& Results, const FString& OutputPath)
+{
+	FString Json;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+
+	Writer->WriteObjectStart();
+	Writer->WriteValue(TEXT("incomplete_chains"), Results.NumIncompleteChains);
+	WriteLatencyJsonArray(Writer, TEXT("chain_latency"), Results.ChainLatencies);
+	WriteLatencyJsonArray(Writer, TEXT("hop_latency"), Results.HopLatencies);
+
+	Writer->WriteArrayStart(TEXT("workers"));
+	for (const FSpatialEventTraceAnalyzer::FWorkerThroughput& Worker : Results.Workers)
+	{
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("worker"), Worker.Worker.ToString());
+		Writer->WriteValue(TEXT("events"), static_cast<int64>(Worker.NumEvents));
+		Writer->WriteValue(TEXT("duration_s"), Worker.DurationSeconds);
+		Writer->WriteValue(TEXT("events_per_s"), Worker.EventsPerSecond);
+		Writer->WriteObjectStart(TEXT("event_counts"));
+		for (const auto& Pair : Worker.EventCounts)
+		{
+			Writer->WriteValue(Pair.Key.ToString(), static_cast<int64>(Pair.Value));
+		}
+		Writer->WriteObjectEnd();
+		Writer->WriteObjectEnd();
+	}
+	Writer->WriteArrayEnd();
+
+	Writer->WriteArrayStart(TEXT("slowest_chains"));
+	for (const FSpatialEventTraceAnalyzer::FChain& Chain : Results.SlowestChains)
+	{
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("chain"), Chain.ChainName.ToString());
+		Writer->WriteValue(TEXT("latency_us"), Chain.LatencyMicroseconds);
+		Writer->WriteArrayStart(TEXT("steps"));
+		for (const FSpatialEventTraceAnalyzer::FChainStep& Step : Chain.Steps)
+		{
+			Writer->WriteObjectStart();
+			Writer->WriteValue(TEXT("worker"), Step.Worker.ToString());
+			Writer->WriteValue(TEXT("event_type"), Step.EventType.ToString());
+			Writer->WriteValue(TEXT("timestamp_utc"), Step.Timestamp.ToIso8601());
+			Writer->WriteObjectEnd();
+		}
+		Writer->WriteArrayEnd();
+		Writer->WriteObjectEnd();
+	}
+	Writer->WriteArrayEnd();
+	Writer->WriteObjectEnd();
+
+	if (!Writer->Close())
+	{
+		UE_LOG(LogSpatialGDKEditorCommandlet, Error, TEXT("Failed to build the analysis JSON."));
+		return false;
+	}
+
+	return SaveOutputFile(Json, OutputPath, TEXT("analysis.json"));
+}
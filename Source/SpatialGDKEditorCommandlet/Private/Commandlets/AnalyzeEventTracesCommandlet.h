@@ -0,0 +1,33 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+
+#include "Interop/Connection/SpatialEventTraceAnalyzer.h"
+
+#include "AnalyzeEventTracesCommandlet.generated.h"
+
+/**
+ * Reads event trace files written by SpatialEventTracer and writes chain latency percentiles, per-worker throughput
+ * and the slowest chains as CSV and JSON. Doesn't load any maps, so it can run headless on build agents:
+ *   -run=AnalyzeEventTraces -TracePaths=<file or folder>[;<file or folder>...] [-OutputPath=<folder>] [-TopSlowChains=<N>]
+ * Folders are searched recursively for .gdktrace files, and each file is attributed to the worker named by its folder.
+ */
+UCLASS()
+class UAnalyzeEventTracesCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UAnalyzeEventTracesCommandlet();
+
+public:
+	virtual int32 Main(const FString& Params) override;
+
+private:
+	static TArray<FString> FindTraceFiles(const FString& TracePaths);
+
+	static bool WriteCsvFiles(const SpatialGDK::FSpatialEventTraceAnalyzer::FResults& Results, const FString& OutputPath);
+	static bool WriteJsonFile(const SpatialGDK::FSpatialEventTraceAnalyzer::FResults& Results, const FString& OutputPath);
+};
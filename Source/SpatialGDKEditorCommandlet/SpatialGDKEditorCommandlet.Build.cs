@@ -16,6 +16,7 @@ public class SpatialGDKEditorCommandlet : ModuleRules
 				"CoreUObject",
 				"Engine",
 				"EngineSettings",
+				"Json",
 				"SpatialGDK",
 				"SpatialGDKEditor",
 				"SpatialGDKServices",
@@ -8,7 +8,6 @@
 #include "Interop/Connection/SpatialWorkerConnection.h"
 #include "SpatialCommonTypes.h"
 
-#include <WorkerSDK/improbable/c_io.h>
 #include <WorkerSDK/improbable/c_trace.h>
 
 DEFINE_LOG_CATEGORY(LogEventTracingTest);
@@ -118,12 +117,14 @@ void AEventTracingTest::GatherData()
 		return;
 	}
 
+	EventTracer->Flush();
 	FString EventsFolderPath = EventTracer->GetFolderPath();
 
 	IFileManager& FileManager = IFileManager::Get();
 
 	TArray<FString> Files;
-	FileManager.FindFilesRecursive(Files, *EventsFolderPath, *FString("*.etlog"), true, false);
+	const FString Wildcard = FString::Printf(TEXT("*%s"), SpatialEventTraceFormat::FileExtension);
+	FileManager.FindFilesRecursive(Files, *EventsFolderPath, *Wildcard, true, false);
 
 	if (Files.Num() < 2)
 	{
@@ -182,64 +183,41 @@ void AEventTracingTest::GatherData()
 
 void AEventTracingTest::GatherDataFromFile(const FString& FilePath)
 {
-	struct StreamDeleter
+	FSpatialEventTraceReader Reader;
+	if (!Reader.Open(FilePath))
 	{
-		void operator()(Io_Stream* StreamToDestroy) const { Io_Stream_Destroy(StreamToDestroy); };
-	};
-
-	TUniquePtr<Io_Stream, StreamDeleter> Stream;
-	Stream.Reset(Io_CreateFileStream(TCHAR_TO_ANSI(*FilePath), Io_OpenMode::IO_OPEN_MODE_READ));
+		UE_LOG(LogEventTracingTest, Error, TEXT("Could not read event tracing file %s"), *FilePath);
+		return;
+	}
 
-	uint32_t BytesToRead = 1;
-	int8_t ReturnCode = 1;
-	while (BytesToRead != 0 && ReturnCode == 1)
+	FSpatialEventTraceReader::FItem Item;
+	while (Reader.ReadNextItem(Item))
 	{
-		BytesToRead = Trace_GetNextSerializedItemSize(Stream.Get());
-		if (BytesToRead == 0)
+		if (Item.Type == ESpatialTraceItemType::Event)
 		{
-			break;
-		}
-
-		Trace_Item* Item = Trace_Item_GetThreadLocal();
-		if (BytesToRead != 0)
-		{
-			ReturnCode = Trace_DeserializeItemFromStream(Stream.Get(), Item, BytesToRead);
-		}
+			FName EventName = FName(*Item.EventType);
 
-		if (Item != nullptr)
-		{
-			if (Item->item_type == TRACE_ITEM_TYPE_EVENT)
+			if (FilterEventNames.Num() == 0 || FilterEventNames.Contains(EventName))
 			{
-				const Trace_Event& Event = Item->item.event;
-				FName EventName = FName(*FString(Event.type));
-
-				if (FilterEventNames.Num() == 0 || FilterEventNames.Contains(EventName))
-				{
-					FString SpanIdString = FSpatialGDKSpanId::ToString(Event.span_id);
-					FName& CachedEventName = TraceEvents.FindOrAdd(SpanIdString);
-					CachedEventName = EventName;
-				}
+				FString SpanIdString = FSpatialGDKSpanId::ToString(Item.SpanId.GetData());
+				FName& CachedEventName = TraceEvents.FindOrAdd(SpanIdString);
+				CachedEventName = EventName;
 			}
-			else if (Item->item_type == TRACE_ITEM_TYPE_SPAN)
+		}
+		else if (Item.Type == ESpatialTraceItemType::Span)
+		{
+			FString SpanIdString = FSpatialGDKSpanId::ToString(Item.SpanId.GetData());
+			TArray<FString>& Causes = TraceSpans.FindOrAdd(SpanIdString);
+			for (const TArray<uint8>& Cause : Item.Causes)
 			{
-				const Trace_Span& Span = Item->item.span;
-
-				FString SpanIdString = FSpatialGDKSpanId::ToString(Span.id);
-				TArray<FString>& Causes = TraceSpans.FindOrAdd(SpanIdString);
-				for (uint64 i = 0; i < Span.cause_count; ++i)
+				FSpatialGDKSpanId SpanId(Cause.GetData());
+				if (!SpanId.IsNull())
 				{
-					const int32 ByteOffset = i * TRACE_SPAN_ID_SIZE_BYTES;
-					FSpatialGDKSpanId SpanId(Span.causes + ByteOffset);
-					if (!SpanId.IsNull())
-					{
-						Causes.Add(FSpatialGDKSpanId::ToString(SpanId.GetId()));
-					}
+					Causes.Add(FSpatialGDKSpanId::ToString(SpanId.GetId()));
 				}
 			}
 		}
 	}
-
-	Stream = nullptr;
 }
 
 bool AEventTracingTest::CheckEventTraceCause(const FString& SpanIdString, const TArray<FName>& CauseEventNames,
@@ -0,0 +1,51 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "EngineClasses/SpatialNetBitWriter.h"
+
+#include "CoreMinimal.h"
+
+#define NETBITWRITERPOOL_TEST(TestName) GDK_AUTOMATION_TEST(Core, FSpatialNetBitWriterPool, TestName)
+
+NETBITWRITERPOOL_TEST(GIVEN_a_released_writer_WHEN_acquiring_a_writer_of_the_same_size_THEN_it_is_reused_and_empty)
+{
+	const FSpatialNetBitWriterPool::FStats InitialStats = FSpatialNetBitWriterPool::GetStats();
+
+	{
+		FSpatialNetBitWriterPool::FScopedWriter Writer = FSpatialNetBitWriterPool::Acquire(nullptr, 32);
+		uint32 Value = 0xDEADBEEF;
+		*Writer << Value;
+		TestEqual("Writer holds the written bytes", Writer->GetNumBytes(), static_cast<int64>(sizeof(Value)));
+	}
+
+	{
+		FSpatialNetBitWriterPool::FScopedWriter Writer = FSpatialNetBitWriterPool::Acquire(nullptr, 32);
+		TestEqual("Reused writer is empty", Writer->GetNumBits(), static_cast<int64>(0));
+	}
+
+	const FSpatialNetBitWriterPool::FStats Stats = FSpatialNetBitWriterPool::GetStats();
+	TestEqual("Both writers were acquired", Stats.NumAcquired - InitialStats.NumAcquired, static_cast<uint64>(2));
+	TestTrue("The second writer was reused", Stats.NumReused > InitialStats.NumReused);
+	TestEqual("No writers are in use", Stats.NumInUse, InitialStats.NumInUse);
+
+	return true;
+}
+
+NETBITWRITERPOOL_TEST(GIVEN_a_writer_grown_past_the_largest_size_class_WHEN_released_THEN_it_is_discarded)
+{
+	const FSpatialNetBitWriterPool::FStats InitialStats = FSpatialNetBitWriterPool::GetStats();
+
+	{
+		FSpatialNetBitWriterPool::FScopedWriter Writer = FSpatialNetBitWriterPool::Acquire(nullptr);
+		TArray<uint8> LargePayload;
+		LargePayload.AddZeroed(64 * 1024);
+		Writer->Serialize(LargePayload.GetData(), LargePayload.Num());
+	}
+
+	const FSpatialNetBitWriterPool::FStats Stats = FSpatialNetBitWriterPool::GetStats();
+	TestEqual("Oversized writer was discarded", Stats.NumDiscarded - InitialStats.NumDiscarded, static_cast<uint64>(1));
+	TestTrue("High water mark tracks the oversized buffer", Stats.HighWaterBytes >= 64 * 1024);
+
+	return true;
+}
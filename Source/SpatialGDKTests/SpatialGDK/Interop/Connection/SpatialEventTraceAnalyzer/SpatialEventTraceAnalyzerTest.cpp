@@ -0,0 +1,164 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Interop/Connection/SpatialEventTraceAnalyzer.h"
+#include "Interop/Connection/SpatialTraceEventDataBuilder.h"
+
+#include "CoreMinimal.h"
+
+#define EVENTTRACEANALYZER_TEST(TestName) GDK_AUTOMATION_TEST(Core, FSpatialEventTraceAnalyzer, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+const FDateTime StartTime(2021, 1, 1);
+const FName ServerWorker = TEXT("UnrealWorker");
+const FName ClientWorker = TEXT("UnrealClient");
+
+TArray<uint8> MakeSpanId(uint8 Id)
+{
+	TArray<uint8> SpanId;
+	SpanId.SetNumZeroed(TRACE_SPAN_ID_SIZE_BYTES);
+	SpanId[0] = Id;
+	return SpanId;
+}
+
+// Adds a span caused by the given span (0 for none) and an event on it, at the given number of microseconds after the start.
+void AddSpanWithEvent(FSpatialEventTraceAnalyzer& Analyzer, uint8 Id, uint8 CauseId, const char* EventType, int64 Microseconds,
+					  FName Worker)
+{
+	FSpatialEventTraceReader::FItem Span;
+	Span.Type = ESpatialTraceItemType::Span;
+	Span.SpanId = MakeSpanId(Id);
+	if (CauseId != 0)
+	{
+		Span.Causes.Add(MakeSpanId(CauseId));
+	}
+	Analyzer.AddItem(Span, Worker);
+
+	FSpatialEventTraceReader::FItem Event;
+	Event.Type = ESpatialTraceItemType::Event;
+	Event.SpanId = MakeSpanId(Id);
+	Event.EventType = EventType;
+	Event.Timestamp = StartTime + FTimespan::FromMicroseconds(Microseconds);
+	Analyzer.AddItem(Event, Worker);
+}
+
+// push_rpc -> send_rpc on the server, receive_rpc -> apply_rpc on the client.
+void AddRPCChain(FSpatialEventTraceAnalyzer& Analyzer, uint8 FirstId, int64 StartMicroseconds, int64 ReceiveDelayMicroseconds)
+{
+	AddSpanWithEvent(Analyzer, FirstId, 0, PUSH_RPC_EVENT_NAME, StartMicroseconds, ServerWorker);
+	AddSpanWithEvent(Analyzer, FirstId + 1, FirstId, SEND_RPC_EVENT_NAME, StartMicroseconds + 100, ServerWorker);
+	AddSpanWithEvent(Analyzer, FirstId + 2, FirstId + 1, RECEIVE_RPC_EVENT_NAME, StartMicroseconds + 100 + ReceiveDelayMicroseconds,
+					 ClientWorker);
+	AddSpanWithEvent(Analyzer, FirstId + 3, FirstId + 2, APPLY_RPC_EVENT_NAME, StartMicroseconds + 200 + ReceiveDelayMicroseconds,
+					 ClientWorker);
+}
+} // anonymous namespace
+
+EVENTTRACEANALYZER_TEST(GIVEN_rpc_chains_across_workers_WHEN_analyzed_THEN_chain_and_hop_latencies_are_reported)
+{
+	FSpatialEventTraceAnalyzer Analyzer;
+	AddRPCChain(Analyzer, 10, 0, 1000);
+	AddRPCChain(Analyzer, 20, 5000, 3000);
+
+	const FSpatialEventTraceAnalyzer::FResults Results = Analyzer.Analyze(1);
+
+	if (TestEqual("One chain type", Results.ChainLatencies.Num(), 1))
+	{
+		const FSpatialEventTraceAnalyzer::FLatencyStats& Stats = Results.ChainLatencies[0];
+		TestEqual("Chain name", Stats.Name, FString(TEXT("rpc")));
+		TestEqual("Chain count", Stats.Count, 2);
+		TestEqual("Max latency", Stats.MaxMicroseconds, 3200.0);
+	}
+
+	TestEqual("Three hops", Results.HopLatencies.Num(), 3);
+	const FSpatialEventTraceAnalyzer::FLatencyStats* SendToReceive = Results.HopLatencies.FindByPredicate([](const auto& Stats) {
+		return Stats.Name == FString(SEND_RPC_EVENT_NAME) + TEXT(" -> ") + FString(RECEIVE_RPC_EVENT_NAME);
+	});
+	if (TestNotNull("Send to receive hop", SendToReceive))
+	{
+		TestEqual("Send to receive max", SendToReceive->MaxMicroseconds, 3000.0);
+	}
+
+	if (TestEqual("One slow chain", Results.SlowestChains.Num(), 1))
+	{
+		const FSpatialEventTraceAnalyzer::FChain& Chain = Results.SlowestChains[0];
+		TestEqual("Slowest latency", Chain.LatencyMicroseconds, 3200.0);
+		if (TestEqual("All steps", Chain.Steps.Num(), 4))
+		{
+			TestTrue("Starts with push", Chain.Steps[0].EventType == PUSH_RPC_EVENT_NAME);
+			TestTrue("Starts on server", Chain.Steps[0].Worker == ServerWorker);
+			TestTrue("Ends with apply", Chain.Steps[3].EventType == APPLY_RPC_EVENT_NAME);
+			TestTrue("Ends on client", Chain.Steps[3].Worker == ClientWorker);
+		}
+	}
+
+	TestEqual("No incomplete chains", Results.NumIncompleteChains, 0);
+	return true;
+}
+
+EVENTTRACEANALYZER_TEST(GIVEN_a_terminal_event_without_its_root_WHEN_analyzed_THEN_it_is_counted_as_incomplete)
+{
+	FSpatialEventTraceAnalyzer Analyzer;
+	AddSpanWithEvent(Analyzer, 1, 0, RECEIVE_RPC_EVENT_NAME, 0, ClientWorker);
+	AddSpanWithEvent(Analyzer, 2, 1, APPLY_RPC_EVENT_NAME, 100, ClientWorker);
+
+	const FSpatialEventTraceAnalyzer::FResults Results = Analyzer.Analyze(10);
+
+	TestEqual("No chain latencies", Results.ChainLatencies.Num(), 0);
+	TestEqual("No slow chains", Results.SlowestChains.Num(), 0);
+	TestEqual("One incomplete chain", Results.NumIncompleteChains, 1);
+	return true;
+}
+
+EVENTTRACEANALYZER_TEST(GIVEN_events_from_several_workers_WHEN_analyzed_THEN_throughput_is_reported_per_worker)
+{
+	FSpatialEventTraceAnalyzer Analyzer;
+	for (uint8 Id = 1; Id <= 11; ++Id)
+	{
+		AddSpanWithEvent(Analyzer, Id, 0, PROPERTY_CHANGED_EVENT_NAME, (Id - 1) * 100000, ServerWorker);
+	}
+	AddSpanWithEvent(Analyzer, 100, 0, RECEIVE_PROPERTY_UPDATE_EVENT_NAME, 0, ClientWorker);
+
+	const FSpatialEventTraceAnalyzer::FResults Results = Analyzer.Analyze(0);
+
+	if (TestEqual("Two workers", Results.Workers.Num(), 2))
+	{
+		const FSpatialEventTraceAnalyzer::FWorkerThroughput& Server = Results.Workers[1];
+		TestTrue("Sorted by name", Server.Worker == ServerWorker);
+		TestEqual("Server events", Server.NumEvents, static_cast<uint64>(11));
+		TestEqual("Server duration", Server.DurationSeconds, 1.0);
+		TestEqual("Server rate", Server.EventsPerSecond, 11.0);
+		TestEqual("Per event type count", Server.EventCounts.FindRef(PROPERTY_CHANGED_EVENT_NAME), static_cast<uint64>(11));
+
+		TestEqual("Client rate with a single event", Results.Workers[0].EventsPerSecond, 0.0);
+	}
+	return true;
+}
+
+EVENTTRACEANALYZER_TEST(GIVEN_chains_older_than_the_timeout_WHEN_a_later_event_is_added_THEN_their_spans_are_dropped_and_results_kept)
+{
+	FSpatialEventTraceAnalyzer Analyzer(FSpatialEventTraceAnalyzer::GetDefaultChainDefinitions(), 10, FTimespan::FromSeconds(1.0));
+	AddRPCChain(Analyzer, 10, 0, 1000);
+	AddSpanWithEvent(Analyzer, 1, 0, APPLY_RPC_EVENT_NAME, 0, ClientWorker);
+	TestEqual("Spans held while within the timeout", Analyzer.GetNumSpans(), 5);
+
+	AddSpanWithEvent(Analyzer, 50, 0, PROPERTY_CHANGED_EVENT_NAME, 5000000, ServerWorker);
+	TestEqual("Only the latest span is held", Analyzer.GetNumSpans(), 1);
+
+	const FSpatialEventTraceAnalyzer::FResults Results = Analyzer.Analyze(10);
+	if (TestEqual("One chain type", Results.ChainLatencies.Num(), 1))
+	{
+		TestEqual("Chain count", Results.ChainLatencies[0].Count, 1);
+		TestEqual("Chain latency", Results.ChainLatencies[0].MaxMicroseconds, 1200.0);
+	}
+	if (TestEqual("Slow chain kept", Results.SlowestChains.Num(), 1))
+	{
+		TestEqual("Steps kept", Results.SlowestChains[0].Steps.Num(), 4);
+	}
+	TestEqual("Timed out chain is incomplete", Results.NumIncompleteChains, 1);
+	return true;
+}
@@ -0,0 +1,138 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Interop/Connection/SpatialEventTraceWriter.h"
+
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+
+#include "CoreMinimal.h"
+
+#define EVENTTRACEWRITER_TEST(TestName) GDK_AUTOMATION_TEST(Core, FSpatialEventTraceWriter, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+FString GetTestFolderPath()
+{
+	return FPaths::Combine(FPaths::ConvertRelativePathToFull(FPaths::ProjectIntermediateDir()), TEXT("EventTraceWriterTest"));
+}
+} // anonymous namespace
+
+EVENTTRACEWRITER_TEST(GIVEN_records_written_past_the_end_of_a_ring_buffer_WHEN_consumed_THEN_they_are_returned_in_order)
+{
+	FEventTraceRingBuffer RingBuffer(0);
+	const uint32 RecordSize = static_cast<uint32>(RingBuffer.GetCapacity() / 3);
+
+	TArray<uint8> Consumed;
+	for (uint8 RecordIndex = 0; RecordIndex < 8; ++RecordIndex)
+	{
+		uint64 Position;
+		uint8* Record = RingBuffer.BeginWrite(RecordSize, Position);
+		if (!TestNotNull("Record was reserved", Record))
+		{
+			return true;
+		}
+		FMemory::Memset(Record, RecordIndex, RecordSize);
+		RingBuffer.EndWrite(Position, RecordSize);
+
+		RingBuffer.ConsumePublished([&Consumed, RecordSize](const uint8* Data, uint32 Size) {
+			if (Size == RecordSize)
+			{
+				Consumed.Add(Data[0]);
+			}
+		});
+	}
+
+	TestEqual("All records consumed", Consumed.Num(), 8);
+	for (int32 RecordIndex = 0; RecordIndex < Consumed.Num(); ++RecordIndex)
+	{
+		TestEqual("Record order", static_cast<int32>(Consumed[RecordIndex]), RecordIndex);
+	}
+
+	return true;
+}
+
+EVENTTRACEWRITER_TEST(GIVEN_a_full_ring_buffer_WHEN_writing_THEN_the_write_fails_until_records_are_consumed)
+{
+	FEventTraceRingBuffer RingBuffer(0);
+	const uint32 RecordSize = static_cast<uint32>(RingBuffer.GetCapacity() / 4);
+
+	uint64 Position;
+	for (int32 RecordIndex = 0; RecordIndex < 3; ++RecordIndex)
+	{
+		uint8* Record = RingBuffer.BeginWrite(RecordSize, Position);
+		TestNotNull("Record was reserved", Record);
+		RingBuffer.EndWrite(Position, RecordSize);
+	}
+
+	TestNull("Record does not fit", RingBuffer.BeginWrite(RecordSize, Position));
+
+	RingBuffer.ConsumePublished([](const uint8*, uint32) {});
+	uint8* Record = RingBuffer.BeginWrite(RecordSize, Position);
+	TestNotNull("Record fits after consuming", Record);
+
+	return true;
+}
+
+EVENTTRACEWRITER_TEST(GIVEN_trace_items_written_WHEN_the_file_is_read_THEN_the_items_match)
+{
+	const FString FolderPath = GetTestFolderPath();
+	IFileManager::Get().DeleteDirectory(*FolderPath, /* RequireExists */ false, /* Tree */ true);
+
+	Trace_SpanIdType SpanId[TRACE_SPAN_ID_SIZE_BYTES] = { 1, 2, 3, 4 };
+	Trace_SpanIdType Causes[TRACE_SPAN_ID_SIZE_BYTES * 2] = { 5, 6, 7, 8, 9, 10, 11, 12 };
+
+	{
+		FSpatialEventTraceWriter::FParameters Parameters;
+		Parameters.FolderPath = FolderPath;
+		Parameters.FileName = TEXT("test");
+		Parameters.FileExtension = SpatialEventTraceFormat::FileExtension;
+		FSpatialEventTraceWriter Writer(MoveTemp(Parameters));
+		TestTrue("Writer is valid", Writer.IsValid());
+
+		Trace_Item SpanItem = {};
+		SpanItem.item_type = TRACE_ITEM_TYPE_SPAN;
+		SpanItem.item.span = { SpanId, 2, Causes };
+		Writer.WriteItem(SpanItem, nullptr);
+
+		Trace_Item EventItem = {};
+		EventItem.item_type = TRACE_ITEM_TYPE_EVENT;
+		EventItem.item.event = { SpanId, 0, "message", "test_event", nullptr };
+		Writer.WriteItem(EventItem, nullptr);
+
+		Writer.Flush();
+
+		const FSpatialEventTraceWriter::FStats Stats = Writer.GetStats();
+		TestEqual("Items written", Stats.ItemsWritten, static_cast<uint64>(2));
+		TestEqual("Items dropped", Stats.ItemsDropped, static_cast<uint64>(0));
+	}
+
+	FSpatialEventTraceReader Reader;
+	if (!TestTrue("File opened", Reader.Open(FPaths::Combine(FolderPath, FString(TEXT("test")) + SpatialEventTraceFormat::FileExtension))))
+	{
+		return true;
+	}
+
+	FSpatialEventTraceReader::FItem Item;
+	TestTrue("Read span", Reader.ReadNextItem(Item));
+	TestTrue("Span type", Item.Type == ESpatialTraceItemType::Span);
+	TestTrue("Span id", Item.SpanId == TArray<uint8>(SpanId, TRACE_SPAN_ID_SIZE_BYTES));
+	TestEqual("Num causes", Item.Causes.Num(), 2);
+	if (Item.Causes.Num() == 2)
+	{
+		TestTrue("Second cause", Item.Causes[1] == TArray<uint8>(Causes + TRACE_SPAN_ID_SIZE_BYTES, TRACE_SPAN_ID_SIZE_BYTES));
+	}
+
+	TestTrue("Read event", Reader.ReadNextItem(Item));
+	TestTrue("Event type", Item.Type == ESpatialTraceItemType::Event);
+	TestEqual("Event name", Item.EventType, FString(TEXT("test_event")));
+	TestEqual("Event message", Item.Message, FString(TEXT("message")));
+
+	TestFalse("End of file", Reader.ReadNextItem(Item));
+
+	IFileManager::Get().DeleteDirectory(*FolderPath, /* RequireExists */ false, /* Tree */ true);
+	return true;
+}
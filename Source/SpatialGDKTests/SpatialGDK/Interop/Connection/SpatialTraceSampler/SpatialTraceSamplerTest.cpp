@@ -0,0 +1,123 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Interop/Connection/SpatialTraceSampler.h"
+
+#include "CoreMinimal.h"
+
+#define TRACESAMPLER_TEST(TestName) GDK_AUTOMATION_TEST(Core, FSpatialTraceSampler, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+const char* const BurstyEvent = "test.bursty_event";
+const char* const RareEvent = "test.rare_event";
+} // anonymous namespace
+
+TRACESAMPLER_TEST(GIVEN_a_rate_limited_event_type_WHEN_it_bursts_THEN_only_the_burst_size_is_sampled)
+{
+	FSpatialTraceSampler Sampler;
+	Sampler.SetCategoryBudget(BurstyEvent, { /* TokensPerSecond */ 10.0, /* BurstSize */ 5.0 });
+
+	const double Now = FPlatformTime::Seconds();
+	int32 NumSampled = 0;
+	for (int32 EventIndex = 0; EventIndex < 100; ++EventIndex)
+	{
+		NumSampled += Sampler.ShouldSample(BurstyEvent, nullptr, 0, Now) ? 1 : 0;
+	}
+	TestEqual("Burst sampled", NumSampled, 5);
+
+	NumSampled = 0;
+	for (int32 EventIndex = 0; EventIndex < 100; ++EventIndex)
+	{
+		NumSampled += Sampler.ShouldSample(BurstyEvent, nullptr, 0, Now + 1.0) ? 1 : 0;
+	}
+	TestEqual("Refilled after a second", NumSampled, 5);
+
+	TestTrue("Other event types are not limited", Sampler.ShouldSample(RareEvent, nullptr, 0, Now));
+
+	return true;
+}
+
+TRACESAMPLER_TEST(GIVEN_an_exhausted_budget_WHEN_an_event_has_a_sampled_cause_THEN_it_is_sampled)
+{
+	FSpatialTraceSampler Sampler({ /* TokensPerSecond */ 1.0, /* BurstSize */ 1.0 }, {});
+
+	const double Now = FPlatformTime::Seconds();
+	TestTrue("Root event sampled", Sampler.ShouldSample(BurstyEvent, nullptr, 0, Now));
+	TestFalse("Second root event rate limited", Sampler.ShouldSample(BurstyEvent, nullptr, 0, Now));
+
+	Trace_SpanIdType Causes[TRACE_SPAN_ID_SIZE_BYTES * 2] = { 0, 0, 0, 0, 1, 2, 3, 4 };
+	TestTrue("Chain continued", Sampler.ShouldSample(BurstyEvent, Causes, 2, Now));
+
+	Trace_SpanIdType NullCauses[TRACE_SPAN_ID_SIZE_BYTES] = { 0, 0, 0, 0 };
+	TestFalse("Null causes start a new chain", Sampler.ShouldSample(BurstyEvent, NullCauses, 1, Now));
+
+	return true;
+}
+
+TRACESAMPLER_TEST(GIVEN_a_category_budget_WHEN_it_is_cleared_THEN_the_default_budget_applies)
+{
+	FSpatialTraceSampler Sampler;
+	Sampler.SetCategoryBudget(BurstyEvent, { /* TokensPerSecond */ 1.0, /* BurstSize */ 1.0 });
+	Sampler.ClearCategoryBudget(BurstyEvent);
+
+	const double Now = FPlatformTime::Seconds();
+	for (int32 EventIndex = 0; EventIndex < 10; ++EventIndex)
+	{
+		TestTrue("Unlimited by default", Sampler.ShouldSample(BurstyEvent, nullptr, 0, Now));
+	}
+
+	const TArray<FSpatialTraceSampler::FCategoryStats> Stats = Sampler.GetStats();
+	TestEqual("One category", Stats.Num(), 1);
+	if (Stats.Num() == 1)
+	{
+		TestEqual("Sampled count", Stats[0].NumSampled, static_cast<uint64>(10));
+	}
+
+	return true;
+}
+
+TRACESAMPLER_TEST(GIVEN_a_rate_limited_head_WHEN_events_are_caused_by_it_THEN_they_are_dropped_too)
+{
+	FSpatialTraceSampler Sampler({ /* TokensPerSecond */ 1.0, /* BurstSize */ 1.0 }, {});
+
+	const double Now = FPlatformTime::Seconds();
+	TestTrue("Root event sampled", Sampler.ShouldSample(BurstyEvent, nullptr, 0, Now));
+	TestFalse("Second root event rate limited", Sampler.ShouldSample(BurstyEvent, nullptr, 0, Now));
+
+	const Trace_SpanIdType* UnsampledCause = FSpatialTraceSampler::GetUnsampledSpanId();
+	TestFalse("Child of a dropped head is dropped even with budget left", Sampler.ShouldSample(RareEvent, UnsampledCause, 1, Now + 10.0));
+
+	Trace_SpanIdType MixedCauses[TRACE_SPAN_ID_SIZE_BYTES * 2] = { 1, 2, 3, 4 };
+	FMemory::Memcpy(MixedCauses + TRACE_SPAN_ID_SIZE_BYTES, UnsampledCause, TRACE_SPAN_ID_SIZE_BYTES);
+	TestTrue("A sampled cause keeps the chain", Sampler.ShouldSample(BurstyEvent, MixedCauses, 2, Now));
+
+	FSpatialTraceSampler::FCauseArray SampledCauses;
+	TestEqual("Unsampled causes are removed", FSpatialTraceSampler::CopySampledCauses(MixedCauses, 2, SampledCauses), 1);
+	TestTrue("Sampled cause is kept", FMemory::Memcmp(SampledCauses.GetData(), MixedCauses, TRACE_SPAN_ID_SIZE_BYTES) == 0);
+
+	return true;
+}
+
+TRACESAMPLER_TEST(GIVEN_an_event_type_buffer_WHEN_it_is_reused_for_another_type_THEN_each_type_has_its_own_budget)
+{
+	FSpatialTraceSampler Sampler;
+	Sampler.SetCategoryBudget(BurstyEvent, { /* TokensPerSecond */ 1.0, /* BurstSize */ 1.0 });
+
+	const double Now = FPlatformTime::Seconds();
+	char EventType[32];
+	FCStringAnsi::Strcpy(EventType, BurstyEvent);
+	TestTrue("First event sampled", Sampler.ShouldSample(EventType, nullptr, 0, Now));
+	TestFalse("Budget applies", Sampler.ShouldSample(EventType, nullptr, 0, Now));
+
+	FCStringAnsi::Strcpy(EventType, RareEvent);
+	for (int32 EventIndex = 0; EventIndex < 10; ++EventIndex)
+	{
+		TestTrue("Other type is unlimited", Sampler.ShouldSample(EventType, nullptr, 0, Now));
+	}
+
+	return true;
+}
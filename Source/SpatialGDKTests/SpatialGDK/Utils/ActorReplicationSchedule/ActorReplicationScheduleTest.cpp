@@ -0,0 +1,88 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Utils/ActorReplicationSchedule.h"
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+
+#define ACTORREPLICATIONSCHEDULE_TEST(TestName) GDK_AUTOMATION_TEST(Core, FActorReplicationSchedule, TestName)
+
+using namespace SpatialGDK;
+
+ACTORREPLICATIONSCHEDULE_TEST(GIVEN_scheduled_actors_WHEN_popping_due_actors_THEN_only_actors_due_are_returned_in_time_order)
+{
+	AActor* Early = NewObject<AActor>();
+	AActor* Late = NewObject<AActor>();
+	AActor* Future = NewObject<AActor>();
+
+	FActorReplicationSchedule Schedule;
+	Schedule.Schedule(Late, 2.0f);
+	Schedule.Schedule(Future, 10.0f);
+	Schedule.Schedule(Early, 1.0f);
+
+	TArray<AActor*> DueActors;
+	Schedule.PopDue(5.0f, DueActors);
+
+	TestEqual("Due actors", DueActors, TArray<AActor*>({ Early, Late }));
+	TestFalse("Popped actor is no longer tracked", Schedule.IsTracked(Early));
+	TestTrue("Actor that isn't due is still tracked", Schedule.IsTracked(Future));
+	TestEqual("Tracked actors", Schedule.Num(), 1);
+
+	return true;
+}
+
+ACTORREPLICATIONSCHEDULE_TEST(GIVEN_a_rescheduled_actor_WHEN_popping_due_actors_THEN_it_is_only_due_at_its_latest_time)
+{
+	AActor* Actor = NewObject<AActor>();
+
+	FActorReplicationSchedule Schedule;
+	Schedule.Schedule(Actor, 1.0f);
+	Schedule.Schedule(Actor, 3.0f);
+
+	TArray<AActor*> DueActors;
+	Schedule.PopDue(2.0f, DueActors);
+	TestEqual("Nothing is due before the latest time", DueActors.Num(), 0);
+
+	Schedule.PopDue(3.0f, DueActors);
+	TestEqual("Due actors", DueActors, TArray<AActor*>({ Actor }));
+
+	return true;
+}
+
+ACTORREPLICATIONSCHEDULE_TEST(GIVEN_an_actor_scheduled_in_the_future_WHEN_woken_THEN_it_is_due_on_the_next_pop)
+{
+	AActor* Actor = NewObject<AActor>();
+
+	FActorReplicationSchedule Schedule;
+	Schedule.Schedule(Actor, 100.0f);
+	Schedule.Wake(Actor);
+
+	TArray<AActor*> DueActors;
+	Schedule.PopDue(0.0f, DueActors);
+	TestEqual("Due actors", DueActors, TArray<AActor*>({ Actor }));
+
+	DueActors.Reset();
+	Schedule.PopDue(200.0f, DueActors);
+	TestEqual("The earlier schedule was replaced", DueActors.Num(), 0);
+
+	return true;
+}
+
+ACTORREPLICATIONSCHEDULE_TEST(GIVEN_a_removed_actor_WHEN_popping_due_actors_THEN_it_is_not_returned)
+{
+	AActor* Actor = NewObject<AActor>();
+
+	FActorReplicationSchedule Schedule;
+	Schedule.Schedule(Actor, 1.0f);
+	Schedule.Remove(Actor);
+
+	TArray<AActor*> DueActors;
+	Schedule.PopDue(2.0f, DueActors);
+
+	TestEqual("Due actors", DueActors.Num(), 0);
+	TestEqual("Tracked actors", Schedule.Num(), 0);
+
+	return true;
+}
@@ -0,0 +1,225 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "ArrayDeltaTestStub.h"
+#include "EngineClasses/SpatialActorChannel.h"
+#include "EngineClasses/SpatialNetDriver.h"
+#include "SpatialConstants.h"
+#include "Utils/ComponentFactory.h"
+#include "Utils/ComponentReader.h"
+#include "Utils/RepFieldDispatchTable.h"
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "Net/RepLayout.h"
+
+#include <WorkerSDK/improbable/c_schema.h>
+
+#define ARRAYDELTA_TEST(TestName) GDK_AUTOMATION_TEST(Core, ArrayDelta, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+const Worker_ComponentId TestComponentId = 1234;
+const Schema_FieldId TestArrayFieldId = 1;
+
+TArray<uint32> ReadArray(const Schema_Object* Object)
+{
+	TArray<uint32> Values;
+	const uint32 Count = Schema_GetUint32Count(Object, TestArrayFieldId);
+	for (uint32 Index = 0; Index < Count; ++Index)
+	{
+		Values.Add(Schema_IndexUint32(Object, TestArrayFieldId, Index));
+	}
+	return Values;
+}
+
+const FRepFieldDispatchEntry* FindEntryByName(const FRepFieldDispatchTable& Table, FName PropertyName)
+{
+	for (int32 Handle = 1; Handle <= Table.Num(); ++Handle)
+	{
+		const FRepFieldDispatchEntry* Entry = Table.FindByHandle(Handle);
+		if (Entry->Property->GetFName() == PropertyName)
+		{
+			return Entry;
+		}
+	}
+	return nullptr;
+}
+
+// Encodes the sender's array as a delta of the given element handles and applies it to the receiver's array.
+// Returns the element indices the delta was sent with.
+TArray<uint32> SendArrayDelta(ComponentFactory& Factory, ComponentReader& Reader, const FRepFieldDispatchEntry& Entry,
+							  const UArrayDeltaObjectStub& Sender, UArrayDeltaObjectStub& Receiver,
+							  TArrayView<const uint16> ElementChangelist, FObjectReferencesMap& ObjectReferences,
+							  bool& bOutReferencesChanged)
+{
+	GDK_PROPERTY(ArrayProperty)* Property = GDK_CASTFIELD<GDK_PROPERTY(ArrayProperty)>(Entry.Property);
+
+	Schema_ComponentUpdate* Update = Schema_CreateComponentUpdate(TestComponentId);
+	Schema_Object* Fields = Schema_GetComponentUpdateFields(Update);
+	Factory.AddArrayDeltaForTesting(Fields, TestArrayFieldId, Entry, Property, reinterpret_cast<const uint8*>(&Sender.Values),
+									ElementChangelist);
+
+	Schema_Object* ArrayDelta = Schema_GetObject(Fields, SpatialConstants::ARRAY_DELTA_ID);
+	TArray<uint32> SentIndices;
+	const uint32 SentCount = Schema_GetUint32Count(ArrayDelta, SpatialConstants::ARRAY_DELTA_INDICES_ID);
+	for (uint32 Index = 0; Index < SentCount; ++Index)
+	{
+		SentIndices.Add(Schema_IndexUint32(ArrayDelta, SpatialConstants::ARRAY_DELTA_INDICES_ID, Index));
+	}
+
+	Reader.ApplyArrayForTesting(Fields, TestArrayFieldId, ObjectReferences, Property, reinterpret_cast<uint8*>(&Receiver.Values),
+								Entry.Offset, bOutReferencesChanged, ArrayDelta);
+
+	Schema_DestroyComponentUpdate(Update);
+	return SentIndices;
+}
+} // anonymous namespace
+
+ARRAYDELTA_TEST(GIVEN_an_array_not_sent_before_WHEN_recording_its_length_THEN_it_is_sent_whole)
+{
+	USpatialActorChannel* Channel = NewObject<USpatialActorChannel>();
+	AActor* Object = NewObject<AActor>();
+
+	TestFalse("First send is whole", Channel->RecordSentDeltaArrayLength(Object, TestArrayFieldId, 3));
+	TestTrue("Same length is a delta", Channel->RecordSentDeltaArrayLength(Object, TestArrayFieldId, 3));
+	TestTrue("Longer array is a delta", Channel->RecordSentDeltaArrayLength(Object, TestArrayFieldId, 5));
+	TestFalse("Other field is sent whole", Channel->RecordSentDeltaArrayLength(Object, TestArrayFieldId + 1, 5));
+
+	return true;
+}
+
+ARRAYDELTA_TEST(GIVEN_an_array_that_got_shorter_WHEN_recording_its_length_THEN_it_is_sent_whole_and_later_growth_is_a_delta)
+{
+	USpatialActorChannel* Channel = NewObject<USpatialActorChannel>();
+	AActor* Object = NewObject<AActor>();
+
+	Channel->RecordSentDeltaArrayLength(Object, TestArrayFieldId, 3);
+
+	TestFalse("Shorter array is sent whole", Channel->RecordSentDeltaArrayLength(Object, TestArrayFieldId, 1));
+	TestTrue("Growth from the shorter length is a delta", Channel->RecordSentDeltaArrayLength(Object, TestArrayFieldId, 2));
+
+	return true;
+}
+
+ARRAYDELTA_TEST(GIVEN_component_data_with_an_array_WHEN_the_update_for_a_shorter_array_is_applied_THEN_initial_data_holds_only_its_elements)
+{
+	Schema_ComponentData* Data = Schema_CreateComponentData(TestComponentId);
+	Schema_Object* DataFields = Schema_GetComponentDataFields(Data);
+	for (uint32 Value : { 10, 20, 30 })
+	{
+		Schema_AddUint32(DataFields, TestArrayFieldId, Value);
+	}
+
+	// An array that got shorter is written whole, along with the deltas of any other arrays in the component.
+	Schema_ComponentUpdate* Update = Schema_CreateComponentUpdate(TestComponentId);
+	Schema_Object* UpdateFields = Schema_GetComponentUpdateFields(Update);
+	Schema_AddUint32(UpdateFields, TestArrayFieldId, 10);
+	Schema_Object* OtherArrayDelta = Schema_AddObject(UpdateFields, SpatialConstants::ARRAY_DELTA_ID);
+	Schema_AddUint32(OtherArrayDelta, SpatialConstants::ARRAY_DELTA_FIELD_ID, TestArrayFieldId + 1);
+	Schema_AddUint32(OtherArrayDelta, SpatialConstants::ARRAY_DELTA_LENGTH_ID, 0);
+
+	TestTrue("Update applied", Schema_ApplyComponentUpdateToData(Update, Data, "ArrayDeltaTest") != 0);
+
+	// Checkout, late joiners and snapshots read the array from the stored data.
+	TestEqual("Stored array", ReadArray(Schema_GetComponentDataFields(Data)), TArray<uint32>({ 10 }));
+
+	Schema_DestroyComponentUpdate(Update);
+	Schema_DestroyComponentData(Data);
+	return true;
+}
+
+ARRAYDELTA_TEST(GIVEN_component_data_with_an_array_WHEN_the_update_for_an_emptied_array_is_applied_THEN_initial_data_has_no_elements)
+{
+	Schema_ComponentData* Data = Schema_CreateComponentData(TestComponentId);
+	Schema_Object* DataFields = Schema_GetComponentDataFields(Data);
+	for (uint32 Value : { 10, 20 })
+	{
+		Schema_AddUint32(DataFields, TestArrayFieldId, Value);
+	}
+
+	// An emptied array is cleared instead of written.
+	Schema_ComponentUpdate* Update = Schema_CreateComponentUpdate(TestComponentId);
+	Schema_AddComponentUpdateClearedField(Update, TestArrayFieldId);
+
+	TestTrue("Update applied", Schema_ApplyComponentUpdateToData(Update, Data, "ArrayDeltaTest") != 0);
+
+	TestEqual("Stored array", ReadArray(Schema_GetComponentDataFields(Data)).Num(), 0);
+
+	Schema_DestroyComponentUpdate(Update);
+	Schema_DestroyComponentData(Data);
+	return true;
+}
+
+ARRAYDELTA_TEST(GIVEN_a_replicated_array_WHEN_deltas_are_sent_and_applied_THEN_the_arrays_match_and_dropped_references_are_removed)
+{
+	USpatialNetDriver* NetDriver = NewObject<USpatialNetDriver>();
+	FObjectReferencesMap ObjectReferences;
+	ComponentFactory Factory(/* bInterestDirty */ false, NetDriver);
+	ComponentReader Reader(NetDriver, ObjectReferences, /* InEventTracer */ nullptr);
+
+	const TSharedPtr<FRepLayout> RepLayout =
+		FRepLayout::CreateFromClass(UArrayDeltaObjectStub::StaticClass(), nullptr, ECreateRepLayoutFlags::None);
+	const TSharedRef<const FRepFieldDispatchTable> Table = FRepFieldDispatchTable::Create(*RepLayout);
+	const FRepFieldDispatchEntry* Entry = FindEntryByName(*Table, GET_MEMBER_NAME_CHECKED(UArrayDeltaObjectStub, Values));
+	if (!TestNotNull("Values entry", Entry))
+	{
+		return false;
+	}
+	GDK_PROPERTY(ArrayProperty)* Property = GDK_CASTFIELD<GDK_PROPERTY(ArrayProperty)>(Entry->Property);
+
+	UArrayDeltaObjectStub* Sender = NewObject<UArrayDeltaObjectStub>();
+	UArrayDeltaObjectStub* Receiver = NewObject<UArrayDeltaObjectStub>();
+	Sender->Values = { 10, 20, 30, 40 };
+	Receiver->Values = Sender->Values;
+	bool bReferencesChanged = false;
+
+	// Change an element and append two. Element handles are one based, one per element of an int32 array.
+	Sender->Values[1] = 21;
+	Sender->Values.Append({ 50, 60 });
+	const uint16 GrowChangelist[] = { 2, 5, 6 };
+	TestEqual("Indices sent for the changed and appended elements",
+			  SendArrayDelta(Factory, Reader, *Entry, *Sender, *Receiver, GrowChangelist, ObjectReferences, bReferencesChanged),
+			  TArray<uint32>({ 1, 4, 5 }));
+	TestEqual("Grown array", Receiver->Values, TArray<int32>({ 10, 21, 30, 40, 50, 60 }));
+
+	// References held by the first element and the two last ones.
+	const int32 ElementSize = Property->Inner->ElementSize;
+	FObjectReferencesMap* ElementReferences = new FObjectReferencesMap();
+	for (int32 ElementIndex : { 0, 4, 5 })
+	{
+		ElementReferences->Add(ElementIndex * ElementSize, FObjectReferences(FUnrealObjectRef(1, ElementIndex), /* bUnresolved */ true,
+																			 ElementIndex * ElementSize, INDEX_NONE, Property->Inner));
+	}
+	ObjectReferences.Add(Entry->Offset, FObjectReferences(ElementReferences, Entry->Offset, INDEX_NONE, Property));
+
+	// Truncate and change an element, with a handle left past the new length.
+	Sender->Values.SetNum(3);
+	Sender->Values[1] = 22;
+	const uint16 TruncateChangelist[] = { 2, 6 };
+	TestEqual("Indices sent for the changed element only",
+			  SendArrayDelta(Factory, Reader, *Entry, *Sender, *Receiver, TruncateChangelist, ObjectReferences, bReferencesChanged),
+			  TArray<uint32>({ 1 }));
+	TestEqual("Truncated array", Receiver->Values, TArray<int32>({ 10, 22, 30 }));
+	TestTrue("References changed", bReferencesChanged);
+	const FObjectReferences* ArrayReferences = ObjectReferences.Find(Entry->Offset);
+	if (TestNotNull("Array references kept", ArrayReferences))
+	{
+		TArray<int32> ReferencedOffsets;
+		ArrayReferences->Array->GenerateKeyArray(ReferencedOffsets);
+		TestEqual("References of dropped elements removed", ReferencedOffsets, TArray<int32>({ 0 }));
+	}
+
+	// Empty the array, which drops the last reference.
+	Sender->Values.Empty();
+	const TArray<uint32> EmptySentIndices =
+		SendArrayDelta(Factory, Reader, *Entry, *Sender, *Receiver, {}, ObjectReferences, bReferencesChanged);
+	TestEqual("No indices sent", EmptySentIndices.Num(), 0);
+	TestEqual("Emptied array", Receiver->Values.Num(), 0);
+	TestFalse("Array references removed", ObjectReferences.Contains(Entry->Offset));
+
+	return true;
+}
@@ -0,0 +1,12 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "ArrayDeltaTestStub.h"
+
+#include "Net/UnrealNetwork.h"
+
+void UArrayDeltaObjectStub::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(UArrayDeltaObjectStub, Values);
+}
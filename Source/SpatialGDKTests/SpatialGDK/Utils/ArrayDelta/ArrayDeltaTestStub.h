@@ -0,0 +1,16 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "ArrayDeltaTestStub.generated.h"
+
+UCLASS()
+class UArrayDeltaObjectStub : public UObject
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY(Replicated)
+	TArray<int32> Values;
+};
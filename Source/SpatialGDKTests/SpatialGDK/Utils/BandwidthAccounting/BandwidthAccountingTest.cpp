@@ -0,0 +1,110 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Utils/BandwidthAccounting.h"
+
+#include "CoreMinimal.h"
+
+#define BANDWIDTHACCOUNTING_TEST(TestName) GDK_AUTOMATION_TEST(Core, FBandwidthAccounting, TestName)
+
+using namespace SpatialGDK;
+
+BANDWIDTHACCOUNTING_TEST(GIVEN_recorded_components_WHEN_getting_top_entries_THEN_they_are_sorted_by_bytes_and_truncated)
+{
+	FBandwidthAccounting Accounting;
+	Accounting.RecordComponent(EBandwidthDirection::Sent, 1000, 10, 0.0);
+	Accounting.RecordComponent(EBandwidthDirection::Sent, 1001, 50, 0.1);
+	Accounting.RecordComponent(EBandwidthDirection::Sent, 1002, 30, 0.2);
+	Accounting.RecordComponent(EBandwidthDirection::Sent, 1000, 45, 0.3);
+	Accounting.RecordComponent(EBandwidthDirection::Received, 1003, 500, 0.4);
+
+	const TArray<FBandwidthAccounting::FEntry> Entries =
+		Accounting.GetTopEntries(EBandwidthCategory::Component, EBandwidthDirection::Sent, 2, 0.5);
+
+	if (!TestEqual("Num entries", Entries.Num(), 2))
+	{
+		return true;
+	}
+
+	TestEqual("First component", Entries[0].ComponentId, static_cast<Worker_ComponentId>(1000));
+	TestEqual("First bytes", Entries[0].Bytes[static_cast<uint8>(EBandwidthDirection::Sent)], static_cast<uint64>(55));
+	TestEqual("First messages", Entries[0].Messages[static_cast<uint8>(EBandwidthDirection::Sent)], static_cast<uint64>(2));
+	TestEqual("Second component", Entries[1].ComponentId, static_cast<Worker_ComponentId>(1001));
+
+	return true;
+}
+
+BANDWIDTHACCOUNTING_TEST(GIVEN_records_in_different_categories_WHEN_getting_top_entries_THEN_only_the_category_is_returned)
+{
+	FBandwidthAccounting Accounting;
+	Accounting.RecordActorClass(EBandwidthDirection::Received, FName(TEXT("MyCharacter")), 100, 0.0);
+	Accounting.RecordRPC(EBandwidthDirection::Received, FName(TEXT("MyCharacter")), FName(TEXT("ServerMove")), 200, 0.0);
+	Accounting.RecordComponent(EBandwidthDirection::Received, 1000, 300, 0.0);
+
+	const TArray<FBandwidthAccounting::FEntry> Entries =
+		Accounting.GetTopEntries(EBandwidthCategory::RPC, EBandwidthDirection::Received, 10, 0.0);
+
+	if (TestEqual("Num entries", Entries.Num(), 1))
+	{
+		TestEqual("RPC name", Entries[0].GetDisplayName(), FString(TEXT("MyCharacter::ServerMove")));
+	}
+
+	return true;
+}
+
+BANDWIDTHACCOUNTING_TEST(GIVEN_RPCs_with_the_same_name_on_different_classes_WHEN_getting_top_entries_THEN_they_are_counted_apart)
+{
+	FBandwidthAccounting Accounting;
+	Accounting.RecordRPC(EBandwidthDirection::Sent, FName(TEXT("MyCharacter")), FName(TEXT("ServerFire")), 100, 0.0);
+	Accounting.RecordRPC(EBandwidthDirection::Sent, FName(TEXT("MyCharacter")), FName(TEXT("ServerFire")), 50, 0.0);
+	Accounting.RecordRPC(EBandwidthDirection::Sent, FName(TEXT("MyTurret")), FName(TEXT("ServerFire")), 20, 0.0);
+
+	const TArray<FBandwidthAccounting::FEntry> Entries =
+		Accounting.GetTopEntries(EBandwidthCategory::RPC, EBandwidthDirection::Sent, 10, 0.0);
+
+	if (TestEqual("Num entries", Entries.Num(), 2))
+	{
+		TestEqual("First RPC", Entries[0].GetDisplayName(), FString(TEXT("MyCharacter::ServerFire")));
+		TestEqual("First bytes", Entries[0].Bytes[static_cast<uint8>(EBandwidthDirection::Sent)], static_cast<uint64>(150));
+		TestEqual("Second RPC", Entries[1].GetDisplayName(), FString(TEXT("MyTurret::ServerFire")));
+		TestEqual("Second bytes", Entries[1].Bytes[static_cast<uint8>(EBandwidthDirection::Sent)], static_cast<uint64>(20));
+	}
+
+	return true;
+}
+
+BANDWIDTHACCOUNTING_TEST(GIVEN_records_older_than_the_window_WHEN_getting_top_entries_THEN_they_are_excluded)
+{
+	FBandwidthAccounting Accounting(/* NumIntervals */ 4, /* IntervalSeconds */ 1.0);
+	Accounting.RecordComponent(EBandwidthDirection::Sent, 1000, 100, 0.5);
+	Accounting.RecordComponent(EBandwidthDirection::Sent, 1001, 10, 2.5);
+	Accounting.RecordComponent(EBandwidthDirection::Sent, 1001, 10, 5.5);
+
+	TArray<FBandwidthAccounting::FEntry> Entries =
+		Accounting.GetTopEntries(EBandwidthCategory::Component, EBandwidthDirection::Sent, 10, 5.5);
+
+	if (TestEqual("Num entries", Entries.Num(), 1))
+	{
+		TestEqual("Component in window", Entries[0].ComponentId, static_cast<Worker_ComponentId>(1001));
+		TestEqual("Bytes in window", Entries[0].Bytes[static_cast<uint8>(EBandwidthDirection::Sent)], static_cast<uint64>(20));
+	}
+
+	TestEqual("Window seconds", Accounting.GetWindowSeconds(5.5), 3.5);
+
+	Entries = Accounting.GetTopEntries(EBandwidthCategory::Component, EBandwidthDirection::Sent, 10, 100.0);
+	TestEqual("Everything aged out", Entries.Num(), 0);
+
+	return true;
+}
+
+BANDWIDTHACCOUNTING_TEST(GIVEN_records_WHEN_reset_THEN_there_are_no_entries)
+{
+	FBandwidthAccounting Accounting;
+	Accounting.RecordComponent(EBandwidthDirection::Sent, 1000, 100, 0.0);
+	Accounting.Reset();
+
+	TestEqual("No entries", Accounting.GetTopEntries(EBandwidthCategory::Component, EBandwidthDirection::Sent, 10, 0.0).Num(), 0);
+
+	return true;
+}
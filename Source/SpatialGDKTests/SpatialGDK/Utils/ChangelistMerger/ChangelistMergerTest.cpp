@@ -0,0 +1,98 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Utils/ChangelistMerger.h"
+
+#include "CoreMinimal.h"
+
+#define CHANGELISTMERGER_TEST(TestName) GDK_AUTOMATION_TEST(Core, FChangelistMerger, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+bool NoDynamicArrays(uint16 Handle)
+{
+	return false;
+}
+} // anonymous namespace
+
+CHANGELISTMERGER_TEST(GIVEN_overlapping_flat_changelists_WHEN_merged_THEN_handles_are_sorted_unique_and_terminated)
+{
+	FChangelistMerger Merger;
+	const TArray<uint16> First = { 3, 40, 0 };
+	const TArray<uint16> Second = { 1, 3, 70, 0 };
+	const TArray<const TArray<uint16>*> Changelists = { &First, &Second };
+
+	TArray<uint16> Merged;
+	const bool bMerged = Merger.TryMergeFlat(80, Changelists, &NoDynamicArrays, Merged);
+
+	TestTrue("Flat changelists were merged", bMerged);
+	TestEqual("Merged changelist", Merged, TArray<uint16>({ 1, 3, 40, 70, 0 }));
+
+	return true;
+}
+
+CHANGELISTMERGER_TEST(GIVEN_handles_already_in_the_output_WHEN_merged_THEN_they_are_kept)
+{
+	FChangelistMerger Merger;
+	const TArray<uint16> Changelist = { 2, 0 };
+	const TArray<const TArray<uint16>*> Changelists = { &Changelist };
+
+	TArray<uint16> Merged = { 5, 0 };
+	Merger.TryMergeFlat(8, Changelists, &NoDynamicArrays, Merged);
+
+	TestEqual("Merged changelist", Merged, TArray<uint16>({ 2, 5, 0 }));
+
+	return true;
+}
+
+CHANGELISTMERGER_TEST(GIVEN_a_changelist_with_a_dynamic_array_WHEN_merged_THEN_it_is_left_to_the_rep_layout)
+{
+	FChangelistMerger Merger;
+	// Handle 2 is an array with a sub-list of two entries.
+	const TArray<uint16> First = { 1, 0 };
+	const TArray<uint16> Second = { 2, 2, 1, 0, 0 };
+	const TArray<const TArray<uint16>*> Changelists = { &First, &Second };
+
+	TArray<uint16> Merged = { 4, 0 };
+	const bool bMerged = Merger.TryMergeFlat(8, Changelists,
+											 [](uint16 Handle) {
+												 return Handle == 2;
+											 },
+											 Merged);
+
+	TestFalse("Changelists with arrays are not merged", bMerged);
+	TestEqual("Output is untouched", Merged, TArray<uint16>({ 4, 0 }));
+
+	return true;
+}
+
+CHANGELISTMERGER_TEST(GIVEN_a_handle_past_the_layout_WHEN_merged_THEN_it_is_left_to_the_rep_layout)
+{
+	FChangelistMerger Merger;
+	const TArray<uint16> Changelist = { 9, 0 };
+	const TArray<const TArray<uint16>*> Changelists = { &Changelist };
+
+	TArray<uint16> Merged;
+	TestFalse("Out of range handles are not merged", Merger.TryMergeFlat(8, Changelists, &NoDynamicArrays, Merged));
+
+	return true;
+}
+
+CHANGELISTMERGER_TEST(GIVEN_a_larger_layout_was_merged_WHEN_a_smaller_one_is_merged_THEN_no_stale_handles_are_returned)
+{
+	FChangelistMerger Merger;
+	const TArray<uint16> Large = { 100, 0 };
+	TArray<uint16> Merged;
+	Merger.TryMergeFlat(128, TArray<const TArray<uint16>*>({ &Large }), &NoDynamicArrays, Merged);
+
+	const TArray<uint16> Small = { 4, 0 };
+	Merged.Reset();
+	Merger.TryMergeFlat(8, TArray<const TArray<uint16>*>({ &Small }), &NoDynamicArrays, Merged);
+
+	TestEqual("Merged changelist", Merged, TArray<uint16>({ 4, 0 }));
+
+	return true;
+}
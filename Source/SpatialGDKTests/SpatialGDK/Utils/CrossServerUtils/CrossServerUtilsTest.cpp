@@ -0,0 +1,142 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Utils/CrossServerUtils.h"
+
+#include "CoreMinimal.h"
+
+#define CROSSSERVERUTILS_TEST(TestName) GDK_AUTOMATION_TEST(Core, CrossServerUtils, TestName)
+
+using namespace SpatialGDK;
+using namespace SpatialGDK::CrossServer;
+
+namespace
+{
+int32 GetNumSlots()
+{
+	return static_cast<int32>(RPCRingBufferUtils::GetRingBufferSize(ERPCType::CrossServer));
+}
+
+TArray<uint32> GetClearedSlots(SlotAlloc& Alloc)
+{
+	TArray<uint32> ClearedSlots;
+	Alloc.ForeachClearedSlot([&ClearedSlots](uint32 Slot) { ClearedSlots.Add(Slot); });
+	return ClearedSlots;
+}
+
+uint32 ReserveSlotOrInvalid(SlotAlloc& Alloc)
+{
+	const TOptional<uint32_t> Slot = Alloc.ReserveSlot();
+	return Slot.IsSet() ? Slot.GetValue() : MAX_uint32;
+}
+} // anonymous namespace
+
+CROSSSERVERUTILS_TEST(GIVEN_reserved_slots_WHEN_freed_THEN_they_are_cleared_once_and_reused_first)
+{
+	if (!TestTrue("The ring buffer has room for the test", GetNumSlots() > 5))
+	{
+		return false;
+	}
+
+	SlotAlloc Alloc;
+	for (uint32 Slot = 0; Slot < 5; ++Slot)
+	{
+		TestEqual("Slots are reserved in order", ReserveSlotOrInvalid(Alloc), Slot);
+	}
+
+	Alloc.FreeSlot(1);
+	Alloc.FreeSlot(3);
+
+	TestFalse("Freed slot is free", Alloc.Occupied[1]);
+	TestFalse("Freed slot is free", Alloc.Occupied[3]);
+	TestTrue("Other slots are still occupied", Alloc.Occupied[0] && Alloc.Occupied[2] && Alloc.Occupied[4]);
+	TestEqual("Freed slots are cleared", GetClearedSlots(Alloc), TArray<uint32>({ 1, 3 }));
+	TestEqual("Slots are only cleared once", GetClearedSlots(Alloc).Num(), 0);
+
+	TestEqual("The first freed slot is reused", ReserveSlotOrInvalid(Alloc), 1u);
+	TestEqual("The second freed slot is reused", ReserveSlotOrInvalid(Alloc), 3u);
+	TestEqual("Then the next unused slot", ReserveSlotOrInvalid(Alloc), 5u);
+
+	return true;
+}
+
+CROSSSERVERUTILS_TEST(GIVEN_a_freed_slot_reserved_again_WHEN_clearing_slots_THEN_it_is_not_cleared)
+{
+	SlotAlloc Alloc;
+	const uint32 Slot = ReserveSlotOrInvalid(Alloc);
+
+	Alloc.FreeSlot(Slot);
+	TestEqual("The freed slot is reused", ReserveSlotOrInvalid(Alloc), Slot);
+
+	TestEqual("The reused slot isn't cleared", GetClearedSlots(Alloc).Num(), 0);
+
+	return true;
+}
+
+CROSSSERVERUTILS_TEST(GIVEN_every_slot_reserved_WHEN_reserving_another_THEN_there_is_none_until_one_is_freed)
+{
+	SlotAlloc Alloc;
+	for (int32 Slot = 0; Slot < GetNumSlots(); ++Slot)
+	{
+		Alloc.ReserveSlot();
+	}
+
+	TestFalse("No free slot to peek", Alloc.PeekFreeSlot().IsSet());
+	TestFalse("No free slot to reserve", Alloc.ReserveSlot().IsSet());
+
+	const uint32 LastSlot = static_cast<uint32>(GetNumSlots() - 1);
+	Alloc.FreeSlot(LastSlot);
+
+	TestEqual("The freed slot is reserved", ReserveSlotOrInvalid(Alloc), LastSlot);
+	TestFalse("The buffer is full again", Alloc.ReserveSlot().IsSet());
+
+	return true;
+}
+
+CROSSSERVERUTILS_TEST(GIVEN_a_mailbox_WHEN_finding_an_RPC_THEN_only_occupied_slots_match)
+{
+	SlotAlloc Alloc;
+	SlotMailbox Mailbox;
+
+	const uint32 FirstSlot = ReserveSlotOrInvalid(Alloc);
+	Mailbox.Add(FirstSlot, 7);
+	const uint32 SecondSlot = ReserveSlotOrInvalid(Alloc);
+	Mailbox.Add(SecondSlot, 9);
+
+	const TOptional<uint32> Found = Mailbox.FindSlot(Alloc.Occupied, 9);
+	TestTrue("Sent RPC is found in its slot", Found.IsSet() && Found.GetValue() == SecondSlot);
+	TestFalse("Unknown RPC is not found", Mailbox.FindSlot(Alloc.Occupied, 8).IsSet());
+
+	Alloc.FreeSlot(SecondSlot);
+	Mailbox.Remove(SecondSlot);
+	TestFalse("RPC in a freed slot is not found", Mailbox.FindSlot(Alloc.Occupied, 9).IsSet());
+	const TOptional<uint32> Remaining = Mailbox.FindSlot(Alloc.Occupied, 7);
+	TestTrue("RPC in another slot is still found", Remaining.IsSet() && Remaining.GetValue() == FirstSlot);
+
+	TestEqual("The freed slot is reused", ReserveSlotOrInvalid(Alloc), SecondSlot);
+	Mailbox.Add(SecondSlot, 11);
+	const TOptional<uint32> Reused = Mailbox.FindSlot(Alloc.Occupied, 11);
+	TestTrue("RPC in the reused slot is found", Reused.IsSet() && Reused.GetValue() == SecondSlot);
+	TestFalse("The RPC it replaced is not found", Mailbox.FindSlot(Alloc.Occupied, 9).IsSet());
+
+	return true;
+}
+
+CROSSSERVERUTILS_TEST(GIVEN_an_occupied_slot_restored_WHEN_it_is_overwritten_THEN_only_the_new_RPC_is_found)
+{
+	SlotAlloc Alloc;
+	SlotMailbox Mailbox;
+
+	// Slots restored on authority gain are added again without being removed first.
+	const uint32 Slot = ReserveSlotOrInvalid(Alloc);
+	Mailbox.Add(Slot, 3);
+	Mailbox.Add(Slot, 5);
+
+	const TOptional<uint32> Found = Mailbox.FindSlot(Alloc.Occupied, 5);
+	TestTrue("New RPC is found in the slot", Found.IsSet() && Found.GetValue() == Slot);
+	TestFalse("The overwritten RPC is not found", Mailbox.FindSlot(Alloc.Occupied, 3).IsSet());
+	TestEqual("Only one RPC is tracked for the slot", Mailbox.SlotsByRPCId.Num(), 1);
+
+	return true;
+}
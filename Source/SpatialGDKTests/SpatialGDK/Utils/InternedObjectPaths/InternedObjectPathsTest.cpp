@@ -0,0 +1,114 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "SpatialConstants.h"
+#include "Utils/InternedObjectPaths.h"
+#include "Utils/SchemaUtils.h"
+
+#include "CoreMinimal.h"
+
+#define INTERNEDOBJECTPATHS_TEST(TestName) GDK_AUTOMATION_TEST(Core, FInternedObjectPaths, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+const Worker_ComponentId TestComponentId = 1234;
+const Schema_FieldId TestFieldId = 1;
+
+FInternedObjectPaths MakeInternedPaths()
+{
+	const TArray<FString> Paths = { TEXT("/Game/Blueprints/BP_Pawn"), TEXT("BP_Pawn_C"), TEXT("PersistentLevel") };
+
+	FInternedObjectPaths InternedPaths;
+	InternedPaths.Init(Paths);
+	return InternedPaths;
+}
+} // anonymous namespace
+
+INTERNEDOBJECTPATHS_TEST(GIVEN_interned_paths_WHEN_looked_up_THEN_ids_map_back_to_the_exact_path)
+{
+	const FInternedObjectPaths InternedPaths = MakeInternedPaths();
+
+	const uint32 Id = InternedPaths.FindId(TEXT("BP_Pawn_C"));
+	TestNotEqual("Interned path has an ID", Id, 0u);
+
+	const FString* Path = InternedPaths.FindPath(Id);
+	if (TestNotNull("ID has a path", Path))
+	{
+		TestEqual("Path", *Path, FString(TEXT("BP_Pawn_C")));
+	}
+
+	TestEqual("Path differing in case isn't interned", InternedPaths.FindId(TEXT("bp_pawn_c")), 0u);
+	TestEqual("Unknown path isn't interned", InternedPaths.FindId(TEXT("BP_Other_C")), 0u);
+	return true;
+}
+
+INTERNEDOBJECTPATHS_TEST(GIVEN_an_object_ref_with_interned_and_unknown_paths_WHEN_round_tripped_THEN_only_interned_paths_are_sent_as_ids)
+{
+	const FInternedObjectPaths InternedPaths = MakeInternedPaths();
+
+	const FUnrealObjectRef PackageRef(0, 0, TEXT("/Game/Blueprints/BP_Pawn"), FUnrealObjectRef(), false);
+	const FUnrealObjectRef ObjectRef(0, 0, TEXT("BP_Pawn_C_Unknown"), PackageRef, false);
+
+	Schema_ComponentData* Data = Schema_CreateComponentData(TestComponentId);
+	Schema_Object* Fields = Schema_GetComponentDataFields(Data);
+	AddObjectRefToSchema(Fields, TestFieldId, ObjectRef, false, &InternedPaths);
+
+	Schema_Object* ObjectRefObject = Schema_GetObject(Fields, TestFieldId);
+	Schema_Object* OuterObject = Schema_GetObject(ObjectRefObject, SpatialConstants::UNREAL_OBJECT_REF_OUTER_ID);
+	TestEqual("Unknown path is sent as a string", Schema_GetObjectCount(ObjectRefObject, SpatialConstants::UNREAL_OBJECT_REF_PATH_ID), 1u);
+	TestEqual("Interned path isn't sent as a string", Schema_GetObjectCount(OuterObject, SpatialConstants::UNREAL_OBJECT_REF_PATH_ID), 0u);
+	TestEqual("Interned path is sent as an ID", Schema_GetUint32Count(OuterObject, SpatialConstants::UNREAL_OBJECT_REF_INTERNED_PATH_ID),
+			  1u);
+
+	const FUnrealObjectRef ReadRef = IndexObjectRefFromSchema(Fields, TestFieldId, 0, &InternedPaths);
+	TestTrue("Object ref round trips", ReadRef == ObjectRef);
+
+	Schema_DestroyComponentData(Data);
+	return true;
+}
+
+INTERNEDOBJECTPATHS_TEST(GIVEN_interned_paths_not_being_sent_as_ids_WHEN_an_object_ref_is_round_tripped_THEN_its_full_path_is_sent)
+{
+	FInternedObjectPaths InternedPaths = MakeInternedPaths();
+	InternedPaths.SetSendIds(false);
+
+	const FUnrealObjectRef ObjectRef(0, 0, TEXT("BP_Pawn_C"), FUnrealObjectRef(), false);
+
+	Schema_ComponentData* Data = Schema_CreateComponentData(TestComponentId);
+	Schema_Object* Fields = Schema_GetComponentDataFields(Data);
+	AddObjectRefToSchema(Fields, TestFieldId, ObjectRef, false, &InternedPaths);
+
+	Schema_Object* ObjectRefObject = Schema_GetObject(Fields, TestFieldId);
+	TestEqual("Path is sent as a string", Schema_GetObjectCount(ObjectRefObject, SpatialConstants::UNREAL_OBJECT_REF_PATH_ID), 1u);
+	TestEqual("Path isn't sent as an ID", Schema_GetUint32Count(ObjectRefObject, SpatialConstants::UNREAL_OBJECT_REF_INTERNED_PATH_ID),
+			  0u);
+
+	const FUnrealObjectRef ReadRef = IndexObjectRefFromSchema(Fields, TestFieldId, 0, &InternedPaths);
+	TestTrue("Object ref round trips", ReadRef == ObjectRef);
+
+	Schema_DestroyComponentData(Data);
+	return true;
+}
+
+INTERNEDOBJECTPATHS_TEST(GIVEN_paths_appended_by_a_later_generation_WHEN_looked_up_THEN_earlier_ids_are_unchanged_and_the_hash_differs)
+{
+	const FInternedObjectPaths InternedPaths = MakeInternedPaths();
+
+	const TArray<FString> AppendedPaths = { TEXT("/Game/Blueprints/BP_Pawn"), TEXT("BP_Pawn_C"), TEXT("PersistentLevel"),
+											TEXT("/Game/Blueprints/BP_Ball") };
+	FInternedObjectPaths AppendedInternedPaths;
+	AppendedInternedPaths.Init(AppendedPaths);
+
+	for (const TCHAR* Path : { TEXT("/Game/Blueprints/BP_Pawn"), TEXT("BP_Pawn_C"), TEXT("PersistentLevel") })
+	{
+		TestEqual(FString::Printf(TEXT("ID of %s"), Path), AppendedInternedPaths.FindId(Path), InternedPaths.FindId(Path));
+	}
+	TestNotEqual("Hash", AppendedInternedPaths.GetHash(), InternedPaths.GetHash());
+
+	FInternedObjectPaths SameInternedPaths = MakeInternedPaths();
+	TestEqual("Hash of the same paths", SameInternedPaths.GetHash(), InternedPaths.GetHash());
+	return true;
+}
@@ -0,0 +1,71 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Utils/LatencyHistogram.h"
+
+#include "CoreMinimal.h"
+
+#define LATENCYHISTOGRAM_TEST(TestName) GDK_AUTOMATION_TEST(Core, FLatencyHistogram, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+bool IsWithinPrecision(uint64 Actual, uint64 Expected)
+{
+	// Sub-buckets split each power of two range 16 ways, so values are within 1/16 of the recorded value.
+	return Actual >= Expected && Actual <= Expected + Expected / FLatencyHistogram::SubBucketCount + 1;
+}
+} // anonymous namespace
+
+LATENCYHISTOGRAM_TEST(GIVEN_an_empty_histogram_WHEN_queried_THEN_zero_is_returned)
+{
+	const FLatencyHistogram Histogram;
+
+	TestEqual("Total count", Histogram.GetTotalCount(), static_cast<uint64>(0));
+	TestEqual("Min", Histogram.GetMin(), static_cast<uint64>(0));
+	TestEqual("Max", Histogram.GetMax(), static_cast<uint64>(0));
+	TestEqual("p99", Histogram.GetValueAtPercentile(99.0), static_cast<uint64>(0));
+
+	return true;
+}
+
+LATENCYHISTOGRAM_TEST(GIVEN_uniformly_recorded_values_WHEN_percentiles_are_queried_THEN_they_are_within_bucket_precision)
+{
+	FLatencyHistogram Histogram;
+	for (uint64 Value = 1; Value <= 10000; ++Value)
+	{
+		Histogram.RecordValue(Value);
+	}
+
+	TestEqual("Total count", Histogram.GetTotalCount(), static_cast<uint64>(10000));
+	TestEqual("Min", Histogram.GetMin(), static_cast<uint64>(1));
+	TestEqual("Max", Histogram.GetMax(), static_cast<uint64>(10000));
+	TestTrue("p50", IsWithinPrecision(Histogram.GetValueAtPercentile(50.0), 5000));
+	TestTrue("p99", IsWithinPrecision(Histogram.GetValueAtPercentile(99.0), 9900));
+	TestEqual("p100 is the max", Histogram.GetValueAtPercentile(100.0), static_cast<uint64>(10000));
+
+	return true;
+}
+
+LATENCYHISTOGRAM_TEST(GIVEN_two_histograms_WHEN_merged_THEN_counts_and_extremes_are_combined)
+{
+	FLatencyHistogram First;
+	FLatencyHistogram Second;
+	First.RecordValue(10);
+	First.RecordValue(20);
+	Second.RecordValue(1000);
+
+	First.Merge(Second);
+
+	TestEqual("Total count", First.GetTotalCount(), static_cast<uint64>(3));
+	TestEqual("Min", First.GetMin(), static_cast<uint64>(10));
+	TestEqual("Max", First.GetMax(), static_cast<uint64>(1000));
+	TestTrue("p99 comes from the merged histogram", IsWithinPrecision(First.GetValueAtPercentile(99.0), 1000));
+
+	First.Reset();
+	TestEqual("Total count after reset", First.GetTotalCount(), static_cast<uint64>(0));
+
+	return true;
+}
@@ -0,0 +1,123 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Utils/MetricsRegistry.h"
+
+#include "Async/Async.h"
+
+#include "CoreMinimal.h"
+
+#define METRICSREGISTRY_TEST(TestName) GDK_AUTOMATION_TEST(Core, FMetricsRegistry, TestName)
+
+using namespace SpatialGDK;
+
+METRICSREGISTRY_TEST(GIVEN_a_registered_counter_WHEN_incremented_THEN_the_value_is_reported)
+{
+	FMetricsRegistry Registry;
+	const FMetricHandle Handle = Registry.RegisterCounter(TEXT("Counter"));
+
+	Registry.Increment(Handle);
+	Registry.Increment(Handle, 41);
+
+	TestTrue("Handle is valid", Handle.IsValid());
+	TestEqual("Counter value", Registry.GetValue(Handle), static_cast<int64>(42));
+	TestEqual("Counter name", Registry.GetName(Handle), FName(TEXT("Counter")));
+
+	return true;
+}
+
+METRICSREGISTRY_TEST(GIVEN_a_counter_incremented_on_several_threads_WHEN_read_THEN_the_values_are_merged)
+{
+	FMetricsRegistry Registry;
+	const FMetricHandle Handle = Registry.RegisterCounter(TEXT("Counter"));
+
+	Registry.Increment(Handle, 10);
+	TFuture<void> Task = Async(EAsyncExecution::Thread, [&Registry, Handle]() {
+		Registry.Increment(Handle, 5);
+	});
+	Task.Wait();
+
+	TestEqual("Counter value", Registry.GetValue(Handle), static_cast<int64>(15));
+
+	return true;
+}
+
+METRICSREGISTRY_TEST(GIVEN_a_counter_WHEN_the_registry_is_reset_THEN_it_counts_from_zero)
+{
+	FMetricsRegistry Registry;
+	const FMetricHandle Handle = Registry.RegisterCounter(TEXT("Counter"));
+
+	Registry.Increment(Handle, 3);
+	Registry.Reset();
+	Registry.Increment(Handle, 2);
+
+	TestEqual("Counter value", Registry.GetValue(Handle), static_cast<int64>(2));
+
+	return true;
+}
+
+METRICSREGISTRY_TEST(GIVEN_a_registered_name_WHEN_registered_again_THEN_the_same_counter_is_returned)
+{
+	FMetricsRegistry Registry;
+	const FMetricHandle First = Registry.RegisterCounter(TEXT("Counter"));
+	const FMetricHandle Second = Registry.RegisterCounter(TEXT("Counter"));
+	const FMetricHandle Other = Registry.RegisterCounter(TEXT("Other"));
+
+	TestEqual("Same counter", Second.Index, First.Index);
+	TestNotEqual("Other names get their own counter", Other.Index, First.Index);
+	TestEqual("Number of counters", Registry.GetNumCounters(), 2);
+
+	return true;
+}
+
+METRICSREGISTRY_TEST(GIVEN_more_registries_than_a_thread_caches_WHEN_incremented_in_turn_THEN_each_keeps_its_own_value)
+{
+	constexpr int32 NumRegistries = 8;
+	TArray<TUniquePtr<FMetricsRegistry>> Registries;
+	TArray<FMetricHandle> Handles;
+	for (int32 Index = 0; Index < NumRegistries; ++Index)
+	{
+		Registries.Add(MakeUnique<FMetricsRegistry>());
+		Handles.Add(Registries[Index]->RegisterCounter(TEXT("Counter")));
+	}
+
+	// Every round evicts each registry from this thread's cache before it is incremented again.
+	for (int32 Round = 0; Round < 3; ++Round)
+	{
+		for (int32 Index = 0; Index < NumRegistries; ++Index)
+		{
+			Registries[Index]->Increment(Handles[Index], Index + 1);
+		}
+	}
+
+	for (int32 Index = 0; Index < NumRegistries; ++Index)
+	{
+		TestEqual(FString::Printf(TEXT("Value of registry %d"), Index), Registries[Index]->GetValue(Handles[Index]),
+				  static_cast<int64>(3 * (Index + 1)));
+	}
+
+	return true;
+}
+
+METRICSREGISTRY_TEST(GIVEN_a_full_registry_WHEN_registering_THEN_new_names_get_invalid_handles_and_registered_ones_keep_counting)
+{
+	FMetricsRegistry Registry;
+	const FMetricHandle First = Registry.RegisterCounter(TEXT("Counter0"));
+	for (int32 Index = 1; Index < FMetricsRegistry::MaxCounters; ++Index)
+	{
+		Registry.RegisterCounter(FName(*FString::Printf(TEXT("Counter%d"), Index)));
+	}
+
+	AddExpectedError(TEXT("the registry is full"), EAutomationExpectedErrorFlags::Contains, 1);
+	const FMetricHandle Rejected = Registry.RegisterCounter(TEXT("OneTooMany"));
+	Registry.Increment(Rejected, 5);
+	Registry.Increment(Registry.RegisterCounter(TEXT("Counter0")), 3);
+
+	TestFalse("Handle past the capacity is invalid", Rejected.IsValid());
+	TestEqual("Rejected counter reads zero", Registry.GetValue(Rejected), static_cast<int64>(0));
+	TestEqual("Counter registered before the registry filled up", Registry.GetValue(First), static_cast<int64>(3));
+	TestEqual("Number of counters", Registry.GetNumCounters(), FMetricsRegistry::MaxCounters);
+
+	return true;
+}
@@ -0,0 +1,78 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Utils/NetworkFrameProfiler.h"
+
+#include "CoreMinimal.h"
+
+#define NETWORKFRAMEPROFILER_TEST(TestName) GDK_AUTOMATION_TEST(Core, FNetworkFrameProfiler, TestName)
+
+using namespace SpatialGDK;
+
+NETWORKFRAMEPROFILER_TEST(GIVEN_no_frames_WHEN_getting_percentiles_THEN_they_are_zero)
+{
+	FNetworkFrameProfiler Profiler;
+	Profiler.AddCounter(ENetworkFrameCounter::OpsReceived, 10);
+
+	TestEqual("No frames", Profiler.GetNumFrames(), 0);
+	TestEqual("Counter percentile", Profiler.GetCounterPercentile(ENetworkFrameCounter::OpsReceived, 50.0), static_cast<uint64>(0));
+	TestEqual("Stage percentile", Profiler.GetStagePercentileMicroseconds(ENetworkFrameStage::Flush, 50.0), 0.0);
+
+	return true;
+}
+
+NETWORKFRAMEPROFILER_TEST(GIVEN_values_added_over_several_frames_WHEN_getting_percentiles_THEN_they_are_over_per_frame_totals)
+{
+	FNetworkFrameProfiler Profiler;
+	for (uint64 FrameIndex = 1; FrameIndex <= 100; ++FrameIndex)
+	{
+		// Two additions per frame to check they are summed within a frame.
+		Profiler.AddCounter(ENetworkFrameCounter::OpsReceived, FrameIndex);
+		Profiler.AddCounter(ENetworkFrameCounter::OpsReceived, FrameIndex);
+		Profiler.EndFrame();
+	}
+
+	TestEqual("Num frames", Profiler.GetNumFrames(), 100);
+	TestEqual("Min", Profiler.GetCounterPercentile(ENetworkFrameCounter::OpsReceived, 0.0), static_cast<uint64>(2));
+	TestEqual("Max", Profiler.GetCounterPercentile(ENetworkFrameCounter::OpsReceived, 100.0), static_cast<uint64>(200));
+	const uint64 Median = Profiler.GetCounterPercentile(ENetworkFrameCounter::OpsReceived, 50.0);
+	TestTrue("Median", Median == 100 || Median == 102);
+	TestEqual("Other counters untouched", Profiler.GetCounterPercentile(ENetworkFrameCounter::ActorsReplicated, 100.0),
+			  static_cast<uint64>(0));
+
+	return true;
+}
+
+NETWORKFRAMEPROFILER_TEST(GIVEN_more_frames_than_the_window_WHEN_getting_percentiles_THEN_only_the_latest_frames_are_used)
+{
+	FNetworkFrameProfiler Profiler(4);
+	for (uint64 FrameIndex = 1; FrameIndex <= 10; ++FrameIndex)
+	{
+		Profiler.AddCounter(ENetworkFrameCounter::EntityDeltas, FrameIndex);
+		Profiler.EndFrame();
+	}
+
+	TestEqual("Num frames", Profiler.GetNumFrames(), 4);
+	TestEqual("Min", Profiler.GetCounterPercentile(ENetworkFrameCounter::EntityDeltas, 0.0), static_cast<uint64>(7));
+	TestEqual("Max", Profiler.GetCounterPercentile(ENetworkFrameCounter::EntityDeltas, 100.0), static_cast<uint64>(10));
+
+	return true;
+}
+
+NETWORKFRAMEPROFILER_TEST(GIVEN_a_stage_scope_with_no_profiler_WHEN_it_ends_THEN_nothing_happens)
+{
+	{
+		FNetworkFrameStageScope StageScope(nullptr, ENetworkFrameStage::Flush);
+	}
+
+	FNetworkFrameProfiler Profiler;
+	{
+		FNetworkFrameStageScope StageScope(&Profiler, ENetworkFrameStage::Flush);
+	}
+	Profiler.EndFrame();
+
+	TestTrue("Stage time recorded", Profiler.GetStagePercentileMicroseconds(ENetworkFrameStage::Flush, 100.0) >= 0.0);
+
+	return true;
+}
@@ -0,0 +1,80 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Utils/PartialSort.h"
+
+#include "CoreMinimal.h"
+
+#define PARTIALSORT_TEST(TestName) GDK_AUTOMATION_TEST(Core, PartialSort, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+struct FGreater
+{
+	bool operator()(const int32 A, const int32 B) const { return B < A; }
+};
+
+TArray<int32*> MakePointers(TArray<int32>& Values)
+{
+	TArray<int32*> Pointers;
+	for (int32& Value : Values)
+	{
+		Pointers.Add(&Value);
+	}
+	return Pointers;
+}
+
+TArray<int32> Dereference(const TArray<int32*>& Pointers, int32 Num)
+{
+	TArray<int32> Values;
+	for (int32 Index = 0; Index < Num; ++Index)
+	{
+		Values.Add(*Pointers[Index]);
+	}
+	return Values;
+}
+} // anonymous namespace
+
+PARTIALSORT_TEST(GIVEN_more_items_than_K_WHEN_partially_sorted_THEN_the_first_K_are_the_best_in_order)
+{
+	TArray<int32> Values = { 5, 1, 9, 3, 7, 2, 8, 6, 4, 0 };
+	TArray<int32*> Pointers = MakePointers(Values);
+
+	PartialSort(Pointers.GetData(), Pointers.Num(), 3, FGreater());
+
+	TestEqual("First K items", Dereference(Pointers, 3), TArray<int32>({ 9, 8, 7 }));
+
+	TArray<int32> Rest = Dereference(Pointers, Pointers.Num());
+	Rest.RemoveAt(0, 3);
+	Rest.Sort();
+	TestEqual("The other items are kept", Rest, TArray<int32>({ 0, 1, 2, 3, 4, 5, 6 }));
+
+	return true;
+}
+
+PARTIALSORT_TEST(GIVEN_K_of_at_least_the_item_count_WHEN_partially_sorted_THEN_all_items_are_sorted)
+{
+	TArray<int32> Values = { 2, 4, 1, 3 };
+	TArray<int32*> Pointers = MakePointers(Values);
+
+	PartialSort(Pointers.GetData(), Pointers.Num(), 10, FGreater());
+
+	TestEqual("Sorted items", Dereference(Pointers, Pointers.Num()), TArray<int32>({ 4, 3, 2, 1 }));
+
+	return true;
+}
+
+PARTIALSORT_TEST(GIVEN_K_of_zero_WHEN_partially_sorted_THEN_items_are_unchanged)
+{
+	TArray<int32> Values = { 2, 4, 1 };
+	TArray<int32*> Pointers = MakePointers(Values);
+
+	PartialSort(Pointers.GetData(), Pointers.Num(), 0, FGreater());
+
+	TestEqual("Items", Dereference(Pointers, Pointers.Num()), TArray<int32>({ 2, 4, 1 }));
+
+	return true;
+}
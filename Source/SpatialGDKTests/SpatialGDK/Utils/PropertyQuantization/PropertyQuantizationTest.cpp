@@ -0,0 +1,177 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Utils/PropertyQuantization.h"
+
+#include "CoreMinimal.h"
+#include "Engine/EngineTypes.h"
+
+#define PROPERTYQUANTIZATION_TEST(TestName) GDK_AUTOMATION_TEST(Core, FPropertyQuantization, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+FPropertyQuantization MakeQuantization(ESpatialQuantization Mode, uint8 Bits, float Bounds = 0.f)
+{
+	FPropertyQuantization Quantization;
+	Quantization.Mode = Mode;
+	Quantization.Bits = Bits;
+	Quantization.Bounds = Bounds;
+	return Quantization;
+}
+
+template <typename T>
+T RoundTrip(const UScriptStruct* Struct, const FPropertyQuantization& Quantization, const T& Value, int64& OutNumBits)
+{
+	FBitWriter Writer(0, /* AllowResize */ true);
+	PropertyQuantization::Write(Writer, Struct, Quantization, reinterpret_cast<const uint8*>(&Value));
+	OutNumBits = Writer.GetNumBits();
+
+	T Result;
+	FBitReader Reader(Writer.GetData(), Writer.GetNumBits());
+	PropertyQuantization::Read(Reader, Struct, Quantization, reinterpret_cast<uint8*>(&Result));
+	return Result;
+}
+
+float GetFixedPointStep(float Bounds, uint8 Bits)
+{
+	return Bounds / ((1 << (Bits - 1)) - 1);
+}
+} // anonymous namespace
+
+PROPERTYQUANTIZATION_TEST(GIVEN_a_fixed_point_vector_WHEN_round_tripped_THEN_it_is_within_one_step_and_uses_the_bit_budget)
+{
+	const FPropertyQuantization Quantization = MakeQuantization(ESpatialQuantization::FixedPoint, 20, 1048576.f);
+	const FVector Value(1234.56f, -98765.4f, 0.5f);
+
+	int64 NumBits = 0;
+	const FVector Result = RoundTrip(TBaseStructure<FVector>::Get(), Quantization, Value, NumBits);
+
+	const float Step = GetFixedPointStep(Quantization.Bounds, Quantization.Bits);
+	TestTrue("Vector is within one quantization step", Result.Equals(Value, Step));
+	TestEqual("Bits written", NumBits, static_cast<int64>(3 * Quantization.Bits));
+
+	return true;
+}
+
+PROPERTYQUANTIZATION_TEST(GIVEN_a_fixed_point_vector_at_zero_or_its_bounds_WHEN_round_tripped_THEN_it_is_exact)
+{
+	const FPropertyQuantization Quantization = MakeQuantization(ESpatialQuantization::FixedPoint, 20, 1000.f);
+	const FVector Value(0.f, Quantization.Bounds, -Quantization.Bounds);
+
+	int64 NumBits = 0;
+	const FVector Result = RoundTrip(TBaseStructure<FVector>::Get(), Quantization, Value, NumBits);
+
+	TestEqual("Zero", Result.X, 0.f);
+	TestEqual("Upper bound", Result.Y, Quantization.Bounds);
+	TestEqual("Lower bound", Result.Z, -Quantization.Bounds);
+
+	return true;
+}
+
+PROPERTYQUANTIZATION_TEST(GIVEN_a_fixed_point_vector_outside_its_bounds_WHEN_round_tripped_THEN_it_is_clamped)
+{
+	const FPropertyQuantization Quantization = MakeQuantization(ESpatialQuantization::FixedPoint, 16, 100.f);
+
+	int64 NumBits = 0;
+	const FVector Result = RoundTrip(TBaseStructure<FVector>::Get(), Quantization, FVector(500.f, -500.f, 0.f), NumBits);
+
+	TestTrue("Vector is clamped to the bounds", Result.Equals(FVector(100.f, -100.f, 0.f), 0.01f));
+
+	return true;
+}
+
+PROPERTYQUANTIZATION_TEST(GIVEN_an_angle_quantized_rotator_WHEN_round_tripped_THEN_it_is_the_same_rotation)
+{
+	const FPropertyQuantization Quantization = MakeQuantization(ESpatialQuantization::Angle, 16);
+	const FRotator Value(45.f, -90.f, 359.99f);
+
+	int64 NumBits = 0;
+	const FRotator Result = RoundTrip(TBaseStructure<FRotator>::Get(), Quantization, Value, NumBits);
+
+	TestTrue("Rotator is within one step", Result.Equals(Value, 360.f / (1 << Quantization.Bits)));
+	TestEqual("Bits written", NumBits, static_cast<int64>(3 * Quantization.Bits));
+
+	return true;
+}
+
+PROPERTYQUANTIZATION_TEST(GIVEN_a_smallest_three_quaternion_WHEN_round_tripped_THEN_it_is_the_same_rotation)
+{
+	const FPropertyQuantization Quantization = MakeQuantization(ESpatialQuantization::SmallestThree, 12);
+	const FQuat Value = FRotator(30.f, 120.f, -60.f).Quaternion();
+
+	int64 NumBits = 0;
+	const FQuat Result = RoundTrip(TBaseStructure<FQuat>::Get(), Quantization, Value, NumBits);
+
+	TestTrue("Result is normalized", Result.IsNormalized());
+	TestTrue("Quaternion is the same rotation", Result.AngularDistance(Value) < 0.01f);
+	TestEqual("Bits written", NumBits, static_cast<int64>(2 + 3 * Quantization.Bits));
+
+	return true;
+}
+
+PROPERTYQUANTIZATION_TEST(GIVEN_quantized_movement_WHEN_round_tripped_THEN_angular_velocity_is_only_sent_with_physics)
+{
+	const FPropertyQuantization Quantization = MakeQuantization(ESpatialQuantization::FixedPoint, 20, 1048576.f);
+
+	FRepMovement Value;
+	Value.Location = FVector(100.f, 200.f, 300.f);
+	Value.Rotation = FRotator(0.f, 90.f, 0.f);
+	Value.LinearVelocity = FVector(10.f, 0.f, 0.f);
+	Value.AngularVelocity = FVector(0.f, 0.f, 5.f);
+	Value.bRepPhysics = false;
+
+	int64 NumBits = 0;
+	FRepMovement Result = RoundTrip(FRepMovement::StaticStruct(), Quantization, Value, NumBits);
+
+	const float Step = GetFixedPointStep(Quantization.Bounds, Quantization.Bits);
+	const float VelocityStep = GetFixedPointStep(PropertyQuantization::DefaultVelocityBounds, Quantization.Bits);
+	TestTrue("Location", Result.Location.Equals(Value.Location, Step));
+	TestTrue("Rotation", Result.Rotation.Equals(Value.Rotation, 0.01f));
+	TestTrue("Linear velocity", Result.LinearVelocity.Equals(Value.LinearVelocity, VelocityStep));
+	TestTrue("Angular velocity isn't sent without physics", Result.AngularVelocity.IsZero());
+
+	Value.bRepPhysics = true;
+	Result = RoundTrip(FRepMovement::StaticStruct(), Quantization, Value, NumBits);
+	TestTrue("Angular velocity is sent with physics", Result.AngularVelocity.Equals(Value.AngularVelocity, VelocityStep));
+
+	return true;
+}
+
+PROPERTYQUANTIZATION_TEST(GIVEN_quantized_movement_with_velocity_bounds_WHEN_round_tripped_THEN_velocities_use_their_own_bounds)
+{
+	FPropertyQuantization Quantization = MakeQuantization(ESpatialQuantization::FixedPoint, 16, 1048576.f);
+	Quantization.VelocityBounds = 1000.f;
+
+	FRepMovement Value;
+	Value.Location = FVector(0.f, 500000.f, -1048576.f);
+	Value.LinearVelocity = FVector(0.f, 1000.f, 2000.f);
+
+	int64 NumBits = 0;
+	const FRepMovement Result = RoundTrip(FRepMovement::StaticStruct(), Quantization, Value, NumBits);
+
+	TestTrue("Location uses the location bounds", Result.Location.Equals(Value.Location, GetFixedPointStep(Quantization.Bounds, 16)));
+	TestEqual("Zero velocity is exact", Result.LinearVelocity.X, 0.f);
+	TestEqual("Velocity at its bounds is exact", Result.LinearVelocity.Y, Quantization.VelocityBounds);
+	TestEqual("Velocity is clamped to the velocity bounds", Result.LinearVelocity.Z, Quantization.VelocityBounds);
+
+	return true;
+}
+
+PROPERTYQUANTIZATION_TEST(GIVEN_a_mode_that_does_not_match_the_struct_WHEN_checked_THEN_it_is_not_supported)
+{
+	TestFalse("Angle on a vector", PropertyQuantization::IsSupported(TBaseStructure<FVector>::Get(),
+																	  MakeQuantization(ESpatialQuantization::Angle, 16)));
+	TestFalse("Fixed point without bounds", PropertyQuantization::IsSupported(TBaseStructure<FVector>::Get(),
+																			   MakeQuantization(ESpatialQuantization::FixedPoint, 16)));
+	TestFalse("Fixed point with a single bit", PropertyQuantization::IsSupported(TBaseStructure<FVector>::Get(),
+																				  MakeQuantization(ESpatialQuantization::FixedPoint, 1, 100.f)));
+	TestFalse("Too many bits", PropertyQuantization::IsSupported(TBaseStructure<FQuat>::Get(),
+																  MakeQuantization(ESpatialQuantization::SmallestThree, 31)));
+	TestTrue("Smallest three on a quaternion", PropertyQuantization::IsSupported(TBaseStructure<FQuat>::Get(),
+																				  MakeQuantization(ESpatialQuantization::SmallestThree, 12)));
+
+	return true;
+}
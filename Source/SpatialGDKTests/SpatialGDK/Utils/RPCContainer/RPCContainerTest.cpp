@@ -220,3 +220,45 @@ RPCCONTAINER_TEST(GIVEN_a_container_with_one_value_WHEN_processing_after_RPCQueu
 
 	return true;
 }
+
+RPCCONTAINER_TEST(GIVEN_a_container_with_a_retry_deadline_WHEN_a_blocking_reference_resolves_THEN_only_the_waiting_queue_is_processed)
+{
+	UObjectDummy* TargetObject = NewObject<UObjectDummy>();
+	UObjectDummy* OtherTargetObject = NewObject<UObjectDummy>();
+	FPendingRPCParams Params = CreateMockParameters(TargetObject, AnySchemaComponentType);
+	FPendingRPCParams OtherParams = CreateMockParameters(OtherTargetObject, AnySchemaComponentType);
+
+	const FUnrealObjectRef BlockingRef = GenerateObjectRef(NewObject<UObjectDummy>());
+	const FUnrealObjectRef OtherBlockingRef = GenerateObjectRef(NewObject<UObjectDummy>());
+
+	TSet<FUnrealObjectRef> ResolvedRefs;
+	TMap<Worker_EntityId, int32> ProcessCounts;
+	FRPCContainer RPCs(ERPCQueueType::Receive);
+	RPCs.SetRetryDeadline(AnySchemaComponentType, 1000.0f);
+	RPCs.BindProcessingFunction(FProcessRPCDelegate::CreateLambda([&](const FPendingRPCParams& InParams) {
+		ProcessCounts.FindOrAdd(InParams.ObjectRef.Entity)++;
+		const FUnrealObjectRef& WaitingOn = InParams.ObjectRef.Entity == Params.ObjectRef.Entity ? BlockingRef : OtherBlockingRef;
+		if (ResolvedRefs.Contains(WaitingOn))
+		{
+			return FRPCErrorInfo{ nullptr, nullptr, ERPCResult::Success };
+		}
+		return FRPCErrorInfo{ nullptr, nullptr, ERPCResult::UnresolvedParameters, ERPCQueueProcessResult::StopProcessing, { WaitingOn } };
+	}));
+
+	RPCs.ProcessOrQueueRPC(Params.ObjectRef, Params.SenderRPCInfo, Params.Type, MoveTemp(Params.Payload), FSpatialGDKSpanId{});
+	RPCs.ProcessOrQueueRPC(OtherParams.ObjectRef, OtherParams.SenderRPCInfo, OtherParams.Type, MoveTemp(OtherParams.Payload),
+						   FSpatialGDKSpanId{});
+
+	// Blocked queues aren't retried before their deadline.
+	RPCs.ProcessRPCs();
+	TestEqual("Blocked queue was not retried", ProcessCounts.FindRef(Params.ObjectRef.Entity), 1);
+
+	ResolvedRefs.Add(BlockingRef);
+	RPCs.OnObjectRefResolved(BlockingRef);
+
+	TestFalse("Waiting queue was processed", RPCs.ObjectHasRPCsQueuedOfType(Params.ObjectRef.Entity, AnySchemaComponentType));
+	TestTrue("Unrelated queue is still queued", RPCs.ObjectHasRPCsQueuedOfType(OtherParams.ObjectRef.Entity, AnySchemaComponentType));
+	TestEqual("Unrelated queue was not retried", ProcessCounts.FindRef(OtherParams.ObjectRef.Entity), 1);
+
+	return true;
+}
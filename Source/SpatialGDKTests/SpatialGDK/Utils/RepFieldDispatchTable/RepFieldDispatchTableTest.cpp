@@ -0,0 +1,236 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "EngineClasses/SpatialActorChannel.h"
+#include "RepFieldDispatchTableTestStub.h"
+#include "Utils/RepFieldDispatchTable.h"
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "HAL/IConsoleManager.h"
+
+#define REPFIELDDISPATCHTABLE_TEST(TestName) GDK_AUTOMATION_TEST(Core, FRepFieldDispatchTable, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+const FRepFieldDispatchEntry* FindEntryByName(const FRepFieldDispatchTable& Table, FName PropertyName)
+{
+	for (int32 Handle = 1; Handle <= Table.Num(); ++Handle)
+	{
+		const FRepFieldDispatchEntry* Entry = Table.FindByHandle(Handle);
+		if (Entry->Property->GetFName() == PropertyName)
+		{
+			return Entry;
+		}
+	}
+	return nullptr;
+}
+
+int32 FindHandleByName(const FRepFieldDispatchTable& Table, FName PropertyName)
+{
+	const FRepFieldDispatchEntry* Entry = FindEntryByName(Table, PropertyName);
+	for (int32 Handle = 1; Handle <= Table.Num(); ++Handle)
+	{
+		if (Table.FindByHandle(Handle) == Entry)
+		{
+			return Handle;
+		}
+	}
+	return 0;
+}
+
+TSharedRef<const FRepFieldDispatchTable> CreateTable(UClass* Class)
+{
+	const TSharedPtr<FRepLayout> RepLayout = FRepLayout::CreateFromClass(Class, nullptr, ECreateRepLayoutFlags::None);
+	return FRepFieldDispatchTable::Create(*RepLayout);
+}
+
+// Rep layouts only flag push based properties while push model is enabled.
+struct FScopedPushModel
+{
+	explicit FScopedPushModel(bool bEnabled = true)
+		: CVar(IConsoleManager::Get().FindConsoleVariable(TEXT("Net.IsPushModelEnabled")))
+		, bWasEnabled(CVar != nullptr && CVar->GetBool())
+	{
+		if (CVar != nullptr)
+		{
+			CVar->Set(bEnabled, ECVF_SetByCode);
+		}
+	}
+
+	~FScopedPushModel()
+	{
+		if (CVar != nullptr)
+		{
+			CVar->Set(bWasEnabled, ECVF_SetByCode);
+		}
+	}
+
+	IConsoleVariable* CVar;
+	bool bWasEnabled;
+};
+} // anonymous namespace
+
+REPFIELDDISPATCHTABLE_TEST(GIVEN_an_actor_rep_layout_WHEN_a_table_is_created_THEN_there_is_one_entry_per_handle)
+{
+	const TSharedPtr<FRepLayout> RepLayout = FRepLayout::CreateFromClass(AActor::StaticClass(), nullptr, ECreateRepLayoutFlags::None);
+	const TSharedRef<const FRepFieldDispatchTable> Table = FRepFieldDispatchTable::Create(*RepLayout);
+
+	TestEqual("Number of entries", Table->Num(), RepLayout->BaseHandleToCmdIndex.Num());
+	TestNull("Handle 0 is the changelist terminator", Table->FindByHandle(0));
+	TestNull("Handles past the layout have no entry", Table->FindByHandle(Table->Num() + 1));
+
+	for (int32 Handle = 1; Handle <= Table->Num(); ++Handle)
+	{
+		const FRepFieldDispatchEntry* Entry = Table->FindByHandle(Handle);
+		const FRepLayoutCmd& Cmd = RepLayout->Cmds[RepLayout->BaseHandleToCmdIndex[Handle - 1].CmdIndex];
+		TestEqual(FString::Printf(TEXT("Command of handle %d"), Handle), Entry->CmdIndex, RepLayout->BaseHandleToCmdIndex[Handle - 1].CmdIndex);
+		TestEqual(FString::Printf(TEXT("Offset of handle %d"), Handle), Entry->Offset, static_cast<int32>(Cmd.Offset));
+	}
+
+	return true;
+}
+
+REPFIELDDISPATCHTABLE_TEST(GIVEN_an_actor_rep_layout_WHEN_a_table_is_created_THEN_role_and_remote_role_are_swapped)
+{
+	const TSharedPtr<FRepLayout> RepLayout = FRepLayout::CreateFromClass(AActor::StaticClass(), nullptr, ECreateRepLayoutFlags::None);
+	const TSharedRef<const FRepFieldDispatchTable> Table = FRepFieldDispatchTable::Create(*RepLayout);
+
+	const FRepFieldDispatchEntry* Role = FindEntryByName(*Table, NAME_Role);
+	const FRepFieldDispatchEntry* RemoteRole = FindEntryByName(*Table, NAME_RemoteRole);
+	if (!TestNotNull("Role entry", Role) || !TestNotNull("RemoteRole entry", RemoteRole))
+	{
+		return false;
+	}
+
+	TestTrue("RemoteRole is flagged", RemoteRole->bIsRemoteRole);
+	TestEqual("RemoteRole is written to Role", RemoteRole->GetOffset(/* bSkipRoleSwap */ false), Role->Offset);
+	TestEqual("Role is written to RemoteRole", Role->GetOffset(/* bSkipRoleSwap */ false), RemoteRole->Offset);
+	TestEqual("RemoteRole is kept when the swap is skipped", RemoteRole->GetOffset(/* bSkipRoleSwap */ true), RemoteRole->Offset);
+
+	const FRepFieldDispatchEntry* ReplicateMovement = FindEntryByName(*Table, TEXT("bReplicateMovement"));
+	if (TestNotNull("bReplicateMovement entry", ReplicateMovement))
+	{
+		TestFalse("Other properties aren't swapped", ReplicateMovement->bSwapsRole);
+		TestEqual("Other properties are written in place", ReplicateMovement->GetOffset(/* bSkipRoleSwap */ false),
+				  ReplicateMovement->Offset);
+	}
+
+	return true;
+}
+
+REPFIELDDISPATCHTABLE_TEST(GIVEN_a_generated_codec_WHEN_a_table_is_created_THEN_matching_fields_are_bound)
+{
+	const TSharedPtr<FRepLayout> RepLayout = FRepLayout::CreateFromClass(AActor::StaticClass(), nullptr, ECreateRepLayoutFlags::None);
+	const uint16 RoleHandle = static_cast<uint16>(FindHandleByName(*FRepFieldDispatchTable::Create(*RepLayout), NAME_Role));
+	if (!TestNotEqual("Role handle", RoleHandle, static_cast<uint16>(0)))
+	{
+		return false;
+	}
+
+	const FGeneratedFieldCodec Fields[] = {
+		{ RoleHandle, TEXT("Role"), sizeof(uint8), &GeneratedCodecs::Encode<uint8>, &GeneratedCodecs::Decode<uint8> },
+	};
+	const FGeneratedClassCodec Codec = { TEXT("/Script/Engine.Actor"), 1u, MakeArrayView(Fields) };
+	const TSharedRef<const FRepFieldDispatchTable> Table = FRepFieldDispatchTable::Create(*RepLayout, &Codec);
+
+	const FRepFieldDispatchEntry* Role = Table->FindByHandle(RoleHandle);
+	TestTrue("Role encoder is bound", Role->GeneratedEncode == &GeneratedCodecs::Encode<uint8>);
+	TestTrue("Role decoder is bound", Role->GeneratedDecode == &GeneratedCodecs::Decode<uint8>);
+
+	const FRepFieldDispatchEntry* RemoteRole = FindEntryByName(*Table, NAME_RemoteRole);
+	TestTrue("Fields without a codec stay on reflection", RemoteRole->GeneratedEncode == nullptr && RemoteRole->GeneratedDecode == nullptr);
+
+	return true;
+}
+
+REPFIELDDISPATCHTABLE_TEST(GIVEN_a_stale_generated_codec_WHEN_a_table_is_created_THEN_mismatched_fields_are_not_bound)
+{
+	const TSharedPtr<FRepLayout> RepLayout = FRepLayout::CreateFromClass(AActor::StaticClass(), nullptr, ECreateRepLayoutFlags::None);
+	const uint16 RoleHandle = static_cast<uint16>(FindHandleByName(*FRepFieldDispatchTable::Create(*RepLayout), NAME_Role));
+	if (!TestNotEqual("Role handle", RoleHandle, static_cast<uint16>(0)))
+	{
+		return false;
+	}
+
+	const FGeneratedFieldCodec Fields[] = {
+		{ RoleHandle, TEXT("RenamedRole"), sizeof(uint8), &GeneratedCodecs::Encode<uint8>, &GeneratedCodecs::Decode<uint8> },
+		{ RoleHandle, TEXT("Role"), sizeof(int32), &GeneratedCodecs::Encode<int32>, &GeneratedCodecs::Decode<int32> },
+	};
+	const FGeneratedClassCodec Codec = { TEXT("/Script/Engine.Actor"), 1u, MakeArrayView(Fields) };
+
+	AddExpectedError(TEXT("it will be replicated through reflection"), EAutomationExpectedErrorFlags::Contains, 2);
+	const TSharedRef<const FRepFieldDispatchTable> Table = FRepFieldDispatchTable::Create(*RepLayout, &Codec);
+
+	const FRepFieldDispatchEntry* Role = Table->FindByHandle(RoleHandle);
+	TestTrue("Role stays on reflection", Role->GeneratedEncode == nullptr && Role->GeneratedDecode == nullptr);
+
+	return true;
+}
+
+REPFIELDDISPATCHTABLE_TEST(GIVEN_a_delta_array_handle_of_a_property_that_is_not_an_array_WHEN_a_table_is_created_THEN_it_is_not_flagged)
+{
+	const TSharedPtr<FRepLayout> RepLayout = FRepLayout::CreateFromClass(AActor::StaticClass(), nullptr, ECreateRepLayoutFlags::None);
+	const uint32 RoleHandle = static_cast<uint32>(FindHandleByName(*FRepFieldDispatchTable::Create(*RepLayout), NAME_Role));
+	const uint32 DeltaArrayHandles[] = { RoleHandle, static_cast<uint32>(RepLayout->BaseHandleToCmdIndex.Num() + 1) };
+
+	AddExpectedError(TEXT("can't be replicated as element deltas"), EAutomationExpectedErrorFlags::Contains, 2);
+	const TSharedRef<const FRepFieldDispatchTable> Table = FRepFieldDispatchTable::Create(*RepLayout, nullptr, DeltaArrayHandles);
+
+	for (int32 Handle = 1; Handle <= Table->Num(); ++Handle)
+	{
+		TestFalse(FString::Printf(TEXT("Handle %d sends array deltas"), Handle), Table->FindByHandle(Handle)->bSendsArrayDeltas);
+	}
+
+	return true;
+}
+
+#if WITH_PUSH_MODEL
+REPFIELDDISPATCHTABLE_TEST(GIVEN_a_class_with_only_push_model_properties_WHEN_a_table_is_created_THEN_it_is_push_based)
+{
+	FScopedPushModel PushModel;
+	const TSharedRef<const FRepFieldDispatchTable> Table = CreateTable(UPushModelObjectStub::StaticClass());
+
+	TestTrue("Push based", Table->AreAllPropertiesPushBased());
+	return true;
+}
+
+REPFIELDDISPATCHTABLE_TEST(GIVEN_a_class_with_a_property_outside_push_model_WHEN_a_table_is_created_THEN_it_is_not_push_based)
+{
+	FScopedPushModel PushModel;
+	const TSharedRef<const FRepFieldDispatchTable> Table = CreateTable(UMixedPushModelObjectStub::StaticClass());
+
+	TestFalse("Push based", Table->AreAllPropertiesPushBased());
+	return true;
+}
+
+REPFIELDDISPATCHTABLE_TEST(GIVEN_push_model_and_mixed_objects_WHEN_checking_comparison_THEN_only_clean_push_model_objects_skip_it)
+{
+	FScopedPushModel PushModel;
+	const TSharedRef<const FRepFieldDispatchTable> PushModelTable = CreateTable(UPushModelObjectStub::StaticClass());
+	const TSharedRef<const FRepFieldDispatchTable> MixedTable = CreateTable(UMixedPushModelObjectStub::StaticClass());
+
+	TestTrue("Clean push model object is skipped",
+			 USpatialActorChannel::CanSkipPropertyComparison(&PushModelTable.Get(), /* bHasDirtyProperties */ false));
+	TestFalse("Dirty push model object is compared",
+			  USpatialActorChannel::CanSkipPropertyComparison(&PushModelTable.Get(), /* bHasDirtyProperties */ true));
+	TestFalse("Clean object with a property outside push model is compared",
+			  USpatialActorChannel::CanSkipPropertyComparison(&MixedTable.Get(), /* bHasDirtyProperties */ false));
+	TestFalse("Object without a table is compared",
+			  USpatialActorChannel::CanSkipPropertyComparison(nullptr, /* bHasDirtyProperties */ false));
+
+	return true;
+}
+#endif // WITH_PUSH_MODEL
+
+REPFIELDDISPATCHTABLE_TEST(GIVEN_push_model_disabled_WHEN_a_table_is_created_THEN_it_is_not_push_based)
+{
+	FScopedPushModel PushModel(/* bEnabled */ false);
+	const TSharedRef<const FRepFieldDispatchTable> Table = CreateTable(UPushModelObjectStub::StaticClass());
+
+	TestFalse("Push based", Table->AreAllPropertiesPushBased());
+	return true;
+}
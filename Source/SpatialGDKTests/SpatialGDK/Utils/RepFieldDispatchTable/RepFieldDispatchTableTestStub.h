@@ -0,0 +1,27 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "RepFieldDispatchTableTestStub.generated.h"
+
+// Replicates only push model properties.
+UCLASS()
+class UPushModelObjectStub : public UObject
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY(Replicated)
+	int32 PushValue;
+};
+
+// Adds a property outside push model, which can change without being marked dirty.
+UCLASS()
+class UMixedPushModelObjectStub : public UPushModelObjectStub
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY(Replicated)
+	int32 ComparedValue;
+};
@@ -0,0 +1,107 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "SpatialConstants.h"
+#include "Utils/ReplicationLatencyStamp.h"
+
+#include "CoreMinimal.h"
+
+#define REPLICATIONLATENCYSTAMP_TEST(TestName) GDK_AUTOMATION_TEST(Core, FReplicationLatencyStamp, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+const Worker_ComponentId TestComponentId = 1234;
+} // anonymous namespace
+
+REPLICATIONLATENCYSTAMP_TEST(GIVEN_a_sample_rate_WHEN_asked_to_stamp_updates_THEN_that_fraction_is_stamped)
+{
+	FReplicationLatencySampler Sampler(0.25f);
+	TestTrue("Sampler is enabled", Sampler.IsEnabled());
+
+	int32 NumStamped = 0;
+	for (int32 UpdateIndex = 0; UpdateIndex < 100; ++UpdateIndex)
+	{
+		NumStamped += Sampler.ShouldStamp() ? 1 : 0;
+	}
+
+	TestEqual("Quarter of updates stamped", NumStamped, 25);
+	return true;
+}
+
+REPLICATIONLATENCYSTAMP_TEST(GIVEN_a_zero_sample_rate_WHEN_asked_to_stamp_updates_THEN_none_are_stamped)
+{
+	FReplicationLatencySampler Sampler(0.0f);
+	TestFalse("Sampler is disabled", Sampler.IsEnabled());
+
+	bool bAnyStamped = false;
+	for (int32 UpdateIndex = 0; UpdateIndex < 100; ++UpdateIndex)
+	{
+		bAnyStamped |= Sampler.ShouldStamp();
+	}
+
+	TestFalse("No updates stamped", bAnyStamped);
+	return true;
+}
+
+REPLICATIONLATENCYSTAMP_TEST(GIVEN_a_stamped_update_WHEN_read_THEN_the_stamp_matches)
+{
+	FReplicationLatencyStamp Stamp;
+	Stamp.SendTimeTicks = 637000000000000000;
+	Stamp.FrameNumber = 42;
+
+	Schema_ComponentUpdate* Update = Schema_CreateComponentUpdate(TestComponentId);
+	Stamp.WriteToUpdate(Update);
+
+	const TOptional<FReplicationLatencyStamp> ReadStamp = FReplicationLatencyStamp::ReadFromUpdate(Update);
+	if (TestTrue("Stamp was read", ReadStamp.IsSet()))
+	{
+		TestEqual("Send time", ReadStamp->SendTimeTicks, Stamp.SendTimeTicks);
+		TestEqual("Frame number", ReadStamp->FrameNumber, Stamp.FrameNumber);
+	}
+
+	Schema_DestroyComponentUpdate(Update);
+	return true;
+}
+
+REPLICATIONLATENCYSTAMP_TEST(GIVEN_an_unstamped_update_WHEN_read_THEN_there_is_no_stamp)
+{
+	Schema_ComponentUpdate* Update = Schema_CreateComponentUpdate(TestComponentId);
+	Schema_AddUint32(Schema_GetComponentUpdateFields(Update), 1, 5);
+
+	TestFalse("No stamp", FReplicationLatencyStamp::ReadFromUpdate(Update).IsSet());
+
+	Schema_DestroyComponentUpdate(Update);
+	return true;
+}
+
+REPLICATIONLATENCYSTAMP_TEST(GIVEN_a_stamp_WHEN_getting_the_time_since_sent_THEN_it_is_in_microseconds_and_never_negative)
+{
+	FReplicationLatencyStamp Stamp;
+	Stamp.SendTimeTicks = 1000 * ETimespan::TicksPerMicrosecond;
+
+	TestEqual("Latency", Stamp.GetMicrosecondsSinceSent(1250 * ETimespan::TicksPerMicrosecond), static_cast<uint64>(250));
+	TestEqual("Clock behind sender", Stamp.GetMicrosecondsSinceSent(500 * ETimespan::TicksPerMicrosecond), static_cast<uint64>(0));
+	return true;
+}
+
+REPLICATIONLATENCYSTAMP_TEST(GIVEN_a_stamped_update_WHEN_applied_to_component_data_THEN_the_data_keeps_the_fields_but_not_the_stamp)
+{
+	Schema_ComponentData* Data = Schema_CreateComponentData(TestComponentId);
+	Schema_ComponentUpdate* Update = Schema_CreateComponentUpdate(TestComponentId);
+	Schema_AddUint32(Schema_GetComponentUpdateFields(Update), 1, 5);
+	FReplicationLatencyStamp::Now().WriteToUpdate(Update);
+
+	Schema_ApplyComponentUpdateToData(Update, Data, "ReplicationLatencyStampTest");
+	FReplicationLatencyStamp::ClearFromData(Data);
+
+	Schema_Object* Fields = Schema_GetComponentDataFields(Data);
+	TestEqual("Field kept", Schema_GetUint32(Fields, 1), static_cast<uint32>(5));
+	TestEqual("Stamp cleared", Schema_GetObjectCount(Fields, SpatialConstants::REPLICATION_LATENCY_STAMP_ID), static_cast<uint32>(0));
+
+	Schema_DestroyComponentUpdate(Update);
+	Schema_DestroyComponentData(Data);
+	return true;
+}
@@ -0,0 +1,114 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Utils/SpatialDebuggerActorGrid.h"
+
+#include "ConvexVolume.h"
+#include "CoreMinimal.h"
+
+#define SPATIALDEBUGGERACTORGRID_TEST(TestName) GDK_AUTOMATION_TEST(Core, FSpatialDebuggerActorGrid, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+constexpr float TestCellSize = 1000.0f;
+constexpr float TestRadius = 50.0f;
+
+TArray<Worker_EntityId> GetEntitiesInRange(const FSpatialDebuggerActorGrid& Grid, const FVector& Origin, float Range,
+										   const FConvexVolume* Frustum = nullptr)
+{
+	TArray<Worker_EntityId> EntityIds;
+	Grid.ForEachInRange(Origin, Range, Frustum, FVector::ZeroVector, [&EntityIds](Worker_EntityId EntityId, const FVector&) {
+		EntityIds.Add(EntityId);
+	});
+	EntityIds.Sort();
+	return EntityIds;
+}
+} // anonymous namespace
+
+SPATIALDEBUGGERACTORGRID_TEST(GIVEN_entities_in_several_cells_WHEN_queried_by_range_THEN_only_those_in_range_are_visited)
+{
+	FSpatialDebuggerActorGrid Grid(TestCellSize);
+	Grid.AddOrUpdate(1, FVector(100.0f, 0.0f, 0.0f), TestRadius);
+	Grid.AddOrUpdate(2, FVector(1500.0f, 0.0f, 0.0f), TestRadius);
+	Grid.AddOrUpdate(3, FVector(-20000.0f, 0.0f, 0.0f), TestRadius);
+
+	TestEqual("Three cells", Grid.GetNumCells(), 3);
+
+	const TArray<Worker_EntityId> InRange = GetEntitiesInRange(Grid, FVector::ZeroVector, 2000.0f);
+	TestTrue("Near entities visited", InRange == TArray<Worker_EntityId>({ 1, 2 }));
+
+	const TArray<Worker_EntityId> InSmallRange = GetEntitiesInRange(Grid, FVector::ZeroVector, 1000.0f);
+	TestTrue("Entity in a cell that is partly in range but itself out of range is skipped", InSmallRange == TArray<Worker_EntityId>({ 1 }));
+
+	return true;
+}
+
+SPATIALDEBUGGERACTORGRID_TEST(GIVEN_a_frustum_WHEN_queried_THEN_entities_outside_it_are_skipped)
+{
+	FSpatialDebuggerActorGrid Grid(TestCellSize);
+	Grid.AddOrUpdate(1, FVector(-500.0f, 0.0f, 0.0f), TestRadius);
+	Grid.AddOrUpdate(2, FVector(500.0f, 0.0f, 0.0f), TestRadius);
+	Grid.AddOrUpdate(3, FVector(-1500.0f, 0.0f, 0.0f), TestRadius);
+
+	// Everything with a positive X is outside.
+	const FConvexVolume Frustum(TArray<FPlane>({ FPlane(FVector(1.0f, 0.0f, 0.0f), 0.0f) }));
+
+	const TArray<Worker_EntityId> Visible = GetEntitiesInRange(Grid, FVector::ZeroVector, 5000.0f, &Frustum);
+	TestTrue("Only entities inside the frustum", Visible == TArray<Worker_EntityId>({ 1, 3 }));
+
+	return true;
+}
+
+SPATIALDEBUGGERACTORGRID_TEST(GIVEN_entities_in_a_cell_WHEN_one_moves_away_and_another_is_removed_THEN_the_grid_follows)
+{
+	FSpatialDebuggerActorGrid Grid(TestCellSize);
+	Grid.AddOrUpdate(1, FVector(100.0f, 0.0f, 0.0f), TestRadius);
+	Grid.AddOrUpdate(2, FVector(200.0f, 0.0f, 0.0f), TestRadius);
+	Grid.AddOrUpdate(3, FVector(300.0f, 0.0f, 0.0f), TestRadius);
+
+	// Moving the first entry out of the cell moves the last one into its place.
+	Grid.AddOrUpdate(1, FVector(5100.0f, 0.0f, 0.0f), TestRadius);
+	Grid.AddOrUpdate(3, FVector(350.0f, 0.0f, 0.0f), TestRadius);
+	Grid.Remove(2);
+
+	TestEqual("Two entities left", Grid.Num(), 2);
+	TestEqual("Two cells", Grid.GetNumCells(), 2);
+
+	TArray<TPair<Worker_EntityId, FVector>> NearOrigin;
+	Grid.ForEachInRange(FVector::ZeroVector, 500.0f, nullptr, FVector::ZeroVector,
+						[&NearOrigin](Worker_EntityId EntityId, const FVector& Location) {
+							NearOrigin.Emplace(EntityId, Location);
+						});
+	TestEqual("One entity near the origin", NearOrigin.Num(), 1);
+	if (NearOrigin.Num() == 1)
+	{
+		TestEqual("Moved entry kept its entity", NearOrigin[0].Key, 3);
+		TestEqual("Moved entry was updated in place", NearOrigin[0].Value, FVector(350.0f, 0.0f, 0.0f));
+	}
+	TestTrue("At new location", GetEntitiesInRange(Grid, FVector(5000.0f, 0.0f, 0.0f), 500.0f) == TArray<Worker_EntityId>({ 1 }));
+
+	Grid.Remove(3);
+	TestEqual("Emptied cell dropped", Grid.GetNumCells(), 1);
+
+	return true;
+}
+
+SPATIALDEBUGGERACTORGRID_TEST(GIVEN_entities_along_a_ray_WHEN_raycast_THEN_those_it_crosses_are_returned_nearest_first)
+{
+	FSpatialDebuggerActorGrid Grid(TestCellSize);
+	Grid.AddOrUpdate(1, FVector(3000.0f, 0.0f, 0.0f), TestRadius);
+	Grid.AddOrUpdate(2, FVector(1000.0f, 30.0f, 0.0f), TestRadius);
+	Grid.AddOrUpdate(3, FVector(2000.0f, 500.0f, 0.0f), TestRadius);
+	// Its cell is far from the ray, but its bounds reach it.
+	Grid.AddOrUpdate(4, FVector(4000.0f, 1500.0f, 0.0f), 1600.0f);
+
+	TArray<Worker_EntityId> Hits;
+	Grid.Raycast(FVector::ZeroVector, FVector(10000.0f, 0.0f, 0.0f), Hits);
+
+	TestTrue("Hits ordered by distance along the ray", Hits == TArray<Worker_EntityId>({ 2, 1, 4 }));
+
+	return true;
+}
@@ -0,0 +1,66 @@
+// Copyright (c) Improbable Worlds Ltd, All Rights Reserved
+
+#include "Tests/TestDefinitions.h"
+
+#include "Utils/SpatialMemoryReport.h"
+
+#include "CoreMinimal.h"
+
+#define SPATIALMEMORYREPORT_TEST(TestName) GDK_AUTOMATION_TEST(Core, FSpatialMemoryReport, TestName)
+
+using namespace SpatialGDK;
+
+namespace
+{
+constexpr Worker_ComponentId SmallComponentId = 1000;
+constexpr Worker_ComponentId LargeComponentId = 1001;
+
+ComponentData CreateComponentWithFields(Worker_ComponentId ComponentId, uint32 NumFields)
+{
+	ComponentData Data(ComponentId);
+	for (uint32 FieldId = 1; FieldId <= NumFields; ++FieldId)
+	{
+		Schema_AddUint64(Data.GetFields(), FieldId, FieldId);
+	}
+	return Data;
+}
+} // anonymous namespace
+
+SPATIALMEMORYREPORT_TEST(GIVEN_a_view_WHEN_added_to_a_report_THEN_components_are_counted_and_sorted_by_schema_bytes)
+{
+	EntityView View;
+	for (Worker_EntityId EntityId = 1; EntityId <= 3; ++EntityId)
+	{
+		EntityViewElement& Element = View.Add(EntityId);
+		Element.Components.Add(CreateComponentWithFields(SmallComponentId, 1));
+		Element.Components.Add(CreateComponentWithFields(LargeComponentId, 10));
+	}
+
+	FSpatialMemoryReport Report;
+	Report.AddEntityView(View);
+
+	TestEqual("Num entities", Report.NumEntities, 3);
+	if (!TestEqual("Num components", Report.Components.Num(), 2))
+	{
+		return true;
+	}
+
+	TestEqual("Largest first", Report.Components[0].ComponentId, LargeComponentId);
+	TestEqual("Instances", Report.Components[0].Count, static_cast<uint32>(3));
+	TestTrue("Larger component has more bytes", Report.Components[0].SchemaBytes > Report.Components[1].SchemaBytes);
+	TestTrue("Schema bytes counted in the total",
+			 Report.GetTotalBytes() >= Report.Components[0].SchemaBytes + Report.Components[1].SchemaBytes);
+
+	return true;
+}
+
+SPATIALMEMORYREPORT_TEST(GIVEN_subsystems_WHEN_getting_the_total_THEN_it_is_their_sum)
+{
+	FSpatialMemoryReport Report;
+	Report.AddSubsystem(TEXT("A"), 100);
+	Report.AddSubsystem(TEXT("B"), 23);
+
+	TestEqual("Total", Report.GetTotalBytes(), static_cast<uint64>(123));
+
+	return true;
+}